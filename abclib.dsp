@@ -1751,6 +1751,14 @@ SOURCE=.\src\sat\bsat\satClause.h
 # End Source File
 # Begin Source File
 
+SOURCE=.\src\sat\bsat\satIface.c
+# End Source File
+# Begin Source File
+
+SOURCE=.\src\sat\bsat\satIface.h
+# End Source File
+# Begin Source File
+
 SOURCE=.\src\sat\bsat\satInter.c
 # End Source File
 # Begin Source File
@@ -1775,6 +1783,10 @@ SOURCE=.\src\sat\bsat\satMem.h
 # End Source File
 # Begin Source File
 
+SOURCE=.\src\sat\bsat\satPort.c
+# End Source File
+# Begin Source File
+
 SOURCE=.\src\sat\bsat\satProof.c
 # End Source File
 # Begin Source File
@@ -2675,6 +2687,10 @@ SOURCE=.\src\opt\mfs\mfsSat.c
 # End Source File
 # Begin Source File
 
+SOURCE=.\src\opt\mfs\mfsSim.c
+# End Source File
+# Begin Source File
+
 SOURCE=.\src\opt\mfs\mfsStrash.c
 # End Source File
 # Begin Source File
@@ -3331,6 +3347,10 @@ SOURCE=.\src\map\if\ifMap.c
 # End Source File
 # Begin Source File
 
+SOURCE=.\src\map\if\ifMapPar.c
+# End Source File
+# Begin Source File
+
 SOURCE=.\src\map\if\ifMatch2.c
 # End Source File
 # Begin Source File
@@ -3511,6 +3531,10 @@ SOURCE=.\src\map\scl\sclLiberty.c
 # End Source File
 # Begin Source File
 
+SOURCE=.\src\map\scl\sclLibCache.c
+# End Source File
+# Begin Source File
+
 SOURCE=.\src\map\scl\sclLibScl.c
 # End Source File
 # Begin Source File
@@ -3903,6 +3927,22 @@ SOURCE=.\src\misc\util\utilSignal.h
 # End Source File
 # Begin Source File
 
+SOURCE=.\src\misc\util\utilSimd.c
+# End Source File
+# Begin Source File
+
+SOURCE=.\src\misc\util\utilSimd.h
+# End Source File
+# Begin Source File
+
+SOURCE=.\src\misc\util\utilTask.c
+# End Source File
+# Begin Source File
+
+SOURCE=.\src\misc\util\utilTask.h
+# End Source File
+# Begin Source File
+
 SOURCE=.\src\misc\util\utilSort.c
 # End Source File
 # Begin Source File
@@ -4639,6 +4679,10 @@ SOURCE=.\src\aig\gia\giaAigerExt.c
 # End Source File
 # Begin Source File
 
+SOURCE=.\src\aig\gia\giaAigerZip.c
+# End Source File
+# Begin Source File
+
 SOURCE=.\src\aig\gia\giaBalAig.c
 # End Source File
 # Begin Source File
@@ -4803,6 +4847,10 @@ SOURCE=.\src\aig\gia\giaKf.c
 # End Source File
 # Begin Source File
 
+SOURCE=.\src\aig\gia\giaLevel.c
+# End Source File
+# Begin Source File
+
 SOURCE=.\src\aig\gia\giaLf.c
 # End Source File
 # Begin Source File
@@ -4855,6 +4903,10 @@ SOURCE=.\src\aig\gia\giaQbf.c
 # End Source File
 # Begin Source File
 
+SOURCE=.\src\aig\gia\giaReorder.c
+# End Source File
+# Begin Source File
+
 SOURCE=.\src\aig\gia\giaResub.c
 # End Source File
 # Begin Source File
@@ -4923,6 +4975,10 @@ SOURCE=.\src\aig\gia\giaSim2.c
 # End Source File
 # Begin Source File
 
+SOURCE=.\src\aig\gia\giaSimPar.c
+# End Source File
+# Begin Source File
+
 SOURCE=.\src\aig\gia\giaSort.c
 # End Source File
 # Begin Source File
@@ -5619,6 +5675,10 @@ SOURCE=.\src\proof\pdr\pdrMan.c
 # End Source File
 # Begin Source File
 
+SOURCE=.\src\proof\pdr\pdrPar.c
+# End Source File
+# Begin Source File
+
 SOURCE=.\src\proof\pdr\pdrSat.c
 # End Source File
 # Begin Source File
@@ -90,6 +90,13 @@ struct Gia_Obj_t_
 // Value is currently used to store several types of information
 // - pointer to the next node in the hash table during structural hashing
 // - pointer to the node copy during duplication 
+// The code using Gia_ManObjValue() and Gia_ManObjSetValue() instead of 
+// pObj->Value can keep the values in a side array of the manager, which 
+// is started by Gia_ManObjValuesStart() while the values are needed. 
+// The code accessing pObj->Value directly or through the helpers taking 
+// only the object, such as Gia_ObjFanin0Copy(), still uses the field,
+// so the side array should be used only around the procedures that are
+// fully migrated (Gia_ManDup, Gia_ManDupDfs, Gia_ManRehash).
 
 // new AIG manager
 typedef struct Gia_Man_t_ Gia_Man_t;
@@ -102,6 +109,7 @@ struct Gia_Man_t_
     int            nObjs;         // number of objects
     int            nObjsAlloc;    // number of allocated objects
     Gia_Obj_t *    pObjs;         // the array of objects
+    Vec_Int_t *    vObjValues;    // the values of the objects kept in a side array (optional)
     unsigned *     pMuxes;        // control signals of MUXes
     int            nXors;         // the number of XORs
     int            nMuxes;        // the number of MUXes 
@@ -113,6 +121,8 @@ struct Gia_Man_t_
     int            fAddStrash;    // performs additional structural hashing
     int            fSweeper;      // sweeper is running
     int            fGiaSimple;    // simple mode (no const-propagation and strashing)
+    void *         pHashPar;      // concurrent structural hashing
+    Gia_MmFlex_t * pArena;        // memory for the auxiliary arrays (optional)
     Vec_Int_t      vRefs;         // the reference count
     int *          pRefs;         // the reference count
     int *          pLutRefs;      // the reference count
@@ -240,6 +250,7 @@ struct Gps_Par_t_
     int            fMiter;
     int            fSkipMap;
     int            fSlacks;
+    int            fArena;
     char *         pDumpFile;
 };
 
@@ -281,10 +292,13 @@ struct Gia_ParSim_t_
     int            RandSeed;      // seed to generate random numbers
     int            TimeLimit;     // time limit in seconds
     int            fCheckMiter;   // check if miter outputs are non-zero
+    int            nThreads;      // the number of threads
     int            fVerbose;      // enables verbose output
     int            iOutFail;      // index of the failed output
 };
 
+typedef struct Gia_SimPar_t_ Gia_SimPar_t;
+
 typedef struct Gia_ManSim_t_ Gia_ManSim_t;
 struct Gia_ManSim_t_
 {
@@ -462,6 +476,8 @@ static inline int          Gia_ObjCioId( Gia_Obj_t * pObj )                    {
 static inline void         Gia_ObjSetCioId( Gia_Obj_t * pObj, int v )          { assert( pObj->fTerm ); pObj->iDiff1 = v;                    }
 static inline int          Gia_ObjValue( Gia_Obj_t * pObj )                    { return pObj->Value;                                         }
 static inline void         Gia_ObjSetValue( Gia_Obj_t * pObj, int i )          { pObj->Value = i;                                            }
+static inline int          Gia_ManObjValue( Gia_Man_t * p, Gia_Obj_t * pObj )  { return p->vObjValues ? Vec_IntEntry(p->vObjValues, Gia_ObjId(p, pObj)) : (int)pObj->Value;     }
+static inline void         Gia_ManObjSetValue( Gia_Man_t * p, Gia_Obj_t * pObj, int i ) { if ( p->vObjValues ) Vec_IntWriteEntry(p->vObjValues, Gia_ObjId(p, pObj), i); else pObj->Value = i; }
 static inline int          Gia_ObjPhase( Gia_Obj_t * pObj )                    { return pObj->fPhase;                                        }
 static inline int          Gia_ObjPhaseReal( Gia_Obj_t * pObj )                { return Gia_Regular(pObj)->fPhase ^ Gia_IsComplement(pObj);  }
 
@@ -535,6 +551,8 @@ static inline int          Gia_ObjLitCopy( Gia_Man_t * p, int iLit )           {
 static inline int          Gia_ObjFanin0Copy( Gia_Obj_t * pObj )               { return Abc_LitNotCond( Gia_ObjFanin0(pObj)->Value, Gia_ObjFaninC0(pObj) );     }
 static inline int          Gia_ObjFanin1Copy( Gia_Obj_t * pObj )               { return Abc_LitNotCond( Gia_ObjFanin1(pObj)->Value, Gia_ObjFaninC1(pObj) );     }
 static inline int          Gia_ObjFanin2Copy( Gia_Man_t * p, Gia_Obj_t * pObj ){ return Abc_LitNotCond(Gia_ObjFanin2(p, pObj)->Value, Gia_ObjFaninC2(p, pObj)); }
+static inline int          Gia_ManObjFanin0Copy( Gia_Man_t * p, Gia_Obj_t * pObj ) { return Abc_LitNotCond( Gia_ManObjValue(p, Gia_ObjFanin0(pObj)), Gia_ObjFaninC0(pObj) ); }
+static inline int          Gia_ManObjFanin1Copy( Gia_Man_t * p, Gia_Obj_t * pObj ) { return Abc_LitNotCond( Gia_ManObjValue(p, Gia_ObjFanin1(pObj)), Gia_ObjFaninC1(pObj) ); }
 
 static inline int          Gia_ObjCopyF( Gia_Man_t * p, int f, Gia_Obj_t * pObj )               { return Vec_IntEntry(&p->vCopies, Gia_ManObjNum(p) * f + Gia_ObjId(p,pObj));      }
 static inline void         Gia_ObjSetCopyF( Gia_Man_t * p, int f, Gia_Obj_t * pObj, int iLit )  { Vec_IntWriteEntry(&p->vCopies, Gia_ManObjNum(p) * f + Gia_ObjId(p,pObj), iLit);  }
@@ -1182,8 +1200,23 @@ static inline int         Gia_ObjCellId( Gia_Man_t * p, int iLit )          { re
 
 /*=== giaAiger.c ===========================================================*/
 extern int                 Gia_FileSize( char * pFileName );
+/*=== giaAigerZip.c ===========================================================*/
+typedef struct Gia_AigerOut_t_ Gia_AigerOut_t;
+extern int                 Gia_AigerFileIsZip( char * pFileName );
+extern char *              Gia_AigerLoadFileZip( char * pFileName, int * pFileSize );
+extern Gia_AigerOut_t *    Gia_AigerOutStart( char * pFileName );
+extern void                Gia_AigerOutFlush( Gia_AigerOut_t * p );
+extern void                Gia_AigerOutWrite( Gia_AigerOut_t * p, void * pData, int nBytes );
+extern void                Gia_AigerOutWriteInt( Gia_AigerOut_t * p, int Value );
+extern void                Gia_AigerOutWriteUnsigned( Gia_AigerOut_t * p, unsigned x );
+extern void                Gia_AigerOutPrintf( Gia_AigerOut_t * p, const char * pFormat, ... );
+extern int                 Gia_AigerOutStop( Gia_AigerOut_t * p );
+extern char *              Gia_FileMap( char * pFileName, int nFileSize );
+extern void                Gia_FileUnmap( char * pContents, int nFileSize );
 extern Gia_Man_t *         Gia_AigerReadFromMemory( char * pContents, int nFileSize, int fGiaSimple, int fSkipStrash, int fCheck );
+extern Gia_Man_t *         Gia_AigerReadFromMemoryPar( char * pContents, int nFileSize, int fGiaSimple, int fSkipStrash, int fCheck, int nThreads );
 extern Gia_Man_t *         Gia_AigerRead( char * pFileName, int fGiaSimple, int fSkipStrash, int fCheck );
+extern Gia_Man_t *         Gia_AigerReadPar( char * pFileName, int fGiaSimple, int fSkipStrash, int fCheck, int nThreads );
 extern void                Gia_AigerWrite( Gia_Man_t * p, char * pFileName, int fWriteSymbols, int fCompact );
 extern void                Gia_DumpAiger( Gia_Man_t * p, char * pFilePrefix, int iFileNum, int nFileNumDigits );
 extern Vec_Str_t *         Gia_AigerWriteIntoMemoryStr( Gia_Man_t * p );
@@ -1394,6 +1427,10 @@ extern int                 Gia_ManHashMux( Gia_Man_t * p, int iCtrl, int iData1,
 extern int                 Gia_ManHashMaj( Gia_Man_t * p, int iData0, int iData1, int iData2 );
 extern int                 Gia_ManHashAndTry( Gia_Man_t * p, int iLit0, int iLit1 );
 extern Gia_Man_t *         Gia_ManRehash( Gia_Man_t * p, int fAddStrash );
+extern void                Gia_ManHashParStart( Gia_Man_t * p, int nObjsMax, int nLocks );
+extern void                Gia_ManHashParStop( Gia_Man_t * p );
+extern int                 Gia_ManHashParAnd( Gia_Man_t * p, int iLit0, int iLit1 );
+extern Gia_Man_t *         Gia_ManRehashPar( Gia_Man_t * p, int nThreads, int fVerbose );
 extern void                Gia_ManHashProfile( Gia_Man_t * p );
 extern int                 Gia_ManHashLookupInt( Gia_Man_t * p, int iLit0, int iLit1 );
 extern int                 Gia_ManHashLookup( Gia_Man_t * p, Gia_Obj_t * p0, Gia_Obj_t * p1 );
@@ -1427,6 +1464,26 @@ extern Gia_Man_t *         Jf_ManDeriveCnf( Gia_Man_t * p, int fCnfObjIds );
 extern Gia_Man_t *         Gia_ManIsoCanonicize( Gia_Man_t * p, int fVerbose );
 extern Gia_Man_t *         Gia_ManIsoReduce( Gia_Man_t * p, Vec_Ptr_t ** pvPosEquivs, Vec_Ptr_t ** pvPiPerms, int fEstimate, int fDualOut, int fVerbose, int fVeryVerbose );
 extern Gia_Man_t *         Gia_ManIsoReduce2( Gia_Man_t * p, Vec_Ptr_t ** pvPosEquivs, Vec_Ptr_t ** pvPiPerms, int fEstimate, int fBetterQual, int fDualOut, int fVerbose, int fVeryVerbose );
+/*=== giaLevel.c ===========================================================*/
+typedef struct Gia_Lev_t_ Gia_Lev_t;
+extern Gia_Lev_t *         Gia_LevStart( Gia_Man_t * pGia );
+extern void                Gia_LevStop( Gia_Lev_t * p );
+extern int                 Gia_LevLevel( Gia_Lev_t * p, int iObj );
+extern int                 Gia_LevLevelR( Gia_Lev_t * p, int iObj );
+extern int                 Gia_LevLevelMax( Gia_Lev_t * p );
+extern int                 Gia_LevRequired( Gia_Lev_t * p, int iObj );
+extern int                 Gia_LevSlack( Gia_Lev_t * p, int iObj );
+extern void                Gia_LevSetRequired( Gia_Lev_t * p, int LevelReq );
+extern int                 Gia_LevLit( Gia_Lev_t * p, int iLit );
+extern int                 Gia_LevFaninLit( Gia_Lev_t * p, int iObj, int n );
+extern int                 Gia_LevFanoutNum( Gia_Lev_t * p, int iObj );
+extern void                Gia_LevAppend( Gia_Lev_t * p );
+extern void                Gia_LevDelete( Gia_Lev_t * p, int iObj );
+extern void                Gia_LevReplace( Gia_Lev_t * p, int iObj, int iLitNew );
+extern int                 Gia_LevVerify( Gia_Lev_t * p );
+extern Gia_Man_t *         Gia_LevDeriveAig( Gia_Lev_t * p );
+extern void                Gia_LevPrintStats( Gia_Lev_t * p );
+extern int                 Gia_LevTest( Gia_Man_t * pGia, int nSteps, int nSeed, int fCheckAll, int fVerbose );
 /*=== giaLf.c ===========================================================*/
 extern void                Lf_ManSetDefaultPars( Jf_Par_t * pPars );
 extern Gia_Man_t *         Lf_ManPerformMapping( Gia_Man_t * pGia, Jf_Par_t * pPars );
@@ -1459,11 +1516,20 @@ extern void                Gia_MmFlexStop( Gia_MmFlex_t * p, int fVerbose );
 extern char *              Gia_MmFlexEntryFetch( Gia_MmFlex_t * p, int nBytes );
 extern void                Gia_MmFlexRestart( Gia_MmFlex_t * p );
 extern int                 Gia_MmFlexReadMemUsage( Gia_MmFlex_t * p );
+extern int                 Gia_MmFlexContains( Gia_MmFlex_t * p, char * pEntry );
 extern Gia_MmStep_t *      Gia_MmStepStart( int nSteps );
 extern void                Gia_MmStepStop( Gia_MmStep_t * p, int fVerbose );
 extern char *              Gia_MmStepEntryFetch( Gia_MmStep_t * p, int nBytes );
 extern void                Gia_MmStepEntryRecycle( Gia_MmStep_t * p, char * pEntry, int nBytes );
 extern int                 Gia_MmStepReadMemUsage( Gia_MmStep_t * p );
+extern void                Gia_ManArenaSetDefault( int fEnable );
+extern int                 Gia_ManArenaDefault();
+extern void                Gia_ManArenaStart( Gia_Man_t * p );
+extern void                Gia_ManArenaStop( Gia_Man_t * p );
+extern int *               Gia_ManAuxIntStart( Gia_Man_t * p, int nEntries );
+extern int *               Gia_ManAuxIntGrow( Gia_Man_t * p, int * pArray, int nEntries, int nEntriesNew );
+extern void                Gia_ManAuxIntFreeP( Gia_Man_t * p, int ** ppArray );
+extern void                Gia_ManArenaPrintStats( Gia_Man_t * p );
 /*=== giaMf.c ===========================================================*/
 extern void                Mf_ManSetDefaultPars( Jf_Par_t * pPars );
 extern Gia_Man_t *         Mf_ManPerformMapping( Gia_Man_t * pGia, Jf_Par_t * pPars );
@@ -1480,6 +1546,9 @@ extern Gia_Man_t *         Gia_ManDupMuxes( Gia_Man_t * p, int Limit );
 extern Gia_Man_t *         Gia_ManDupNoMuxes( Gia_Man_t * p );
 /*=== giaPat.c ===========================================================*/
 extern void                Gia_SatVerifyPattern( Gia_Man_t * p, Gia_Obj_t * pRoot, Vec_Int_t * vCex, Vec_Int_t * vVisit );
+/*=== giaReorder.c ===========================================================*/
+extern double              Gia_ManReorderFaninDist( Gia_Man_t * p, int nBlock, double * pNear );
+extern Gia_Man_t *         Gia_ManReorderLocality( Gia_Man_t * p, int Mode, int nBlock, int fVerbose );
 /*=== giaRetime.c ===========================================================*/
 extern Gia_Man_t *         Gia_ManRetimeForward( Gia_Man_t * p, int nMaxIters, int fVerbose );
 /*=== giaSat.c ============================================================*/
@@ -1518,6 +1587,19 @@ extern int                 Gia_ManBuiltInSimCheckEqual( Gia_Man_t * p, int iLit0
 extern void                Gia_ManBuiltInSimResimulateCone( Gia_Man_t * p, int iLit0, int iLit1 );
 extern void                Gia_ManBuiltInSimResimulate( Gia_Man_t * p );
 extern int                 Gia_ManBuiltInSimAddPat( Gia_Man_t * p, Vec_Int_t * vPat );
+/*=== giaSimPar.c ============================================================*/
+extern Gia_SimPar_t *      Gia_SimParStart( Gia_Man_t * pAig, word * pSims, int nWords, int nThreads );
+extern void                Gia_SimParStop( Gia_SimPar_t * p );
+extern word *              Gia_SimParSims( Gia_SimPar_t * p, int iObj );
+extern int                 Gia_SimParWordNum( Gia_SimPar_t * p );
+extern int                 Gia_SimParThreadNum( Gia_SimPar_t * p );
+extern void                Gia_SimParSimulate( Gia_SimPar_t * p );
+extern void                Gia_SimParRandomPis( Gia_SimPar_t * p );
+extern void                Gia_SimParResetRegs( Gia_SimPar_t * p );
+extern void                Gia_SimParTransfer( Gia_SimPar_t * p );
+extern double              Gia_SimParPatsPerSec( Gia_SimPar_t * p );
+extern void                Gia_SimParPrintStats( Gia_SimPar_t * p );
+extern int                 Gia_ManSimSimulatePar( Gia_Man_t * pAig, Gia_ParSim_t * pPars );
 /*=== giaSpeedup.c ============================================================*/
 extern float               Gia_ManDelayTraceLut( Gia_Man_t * p );
 extern float               Gia_ManDelayTraceLutPrint( Gia_Man_t * p, int fVerbose );
@@ -1622,6 +1704,8 @@ extern void                Gia_ManCleanValue( Gia_Man_t * p );
 extern void                Gia_ManCleanLevels( Gia_Man_t * p, int Size );
 extern void                Gia_ManCleanTruth( Gia_Man_t * p );
 extern void                Gia_ManFillValue( Gia_Man_t * p );
+extern void                Gia_ManObjValuesStart( Gia_Man_t * p );
+extern void                Gia_ManObjValuesStop( Gia_Man_t * p );
 extern void                Gia_ObjSetPhase( Gia_Man_t * p, Gia_Obj_t * pObj );
 extern void                Gia_ManSetPhase( Gia_Man_t * p );
 extern void                Gia_ManSetPhasePattern( Gia_Man_t * p, Vec_Int_t * vCiValues );
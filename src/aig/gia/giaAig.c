@@ -142,7 +142,7 @@ Gia_Man_t * Gia_ManFromAigChoices( Aig_Man_t * p )
     pNew->pSpec = Abc_UtilStrsav( p->pSpec );
     pNew->nConstrs = p->nConstrs;
     // create room to store equivalences
-    pNew->pSibls = ABC_CALLOC( int, Aig_ManObjNum(p) );
+    pNew->pSibls = Gia_ManAuxIntStart( pNew, Aig_ManObjNum(p) );
     // create the PIs
     Aig_ManCleanData( p );
     Aig_ManConst1(p)->iData = 1;
@@ -23,10 +23,28 @@
 #include "misc/tim/tim.h"
 #include "base/main/main.h"
 
+#ifndef _WIN32
+#include <sys/mman.h>
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+#ifdef ABC_USE_PTHREADS
+
+#ifdef _WIN32
+#include "../lib/pthread.h"
+#else
+#include <pthread.h>
+#endif
+
+#endif
+
 ABC_NAMESPACE_IMPL_START
 
 #define XAIG_VERBOSE 0
 
+#define PAR_THR_MAX 100
+
 ////////////////////////////////////////////////////////////////////////
 ///                        DECLARATIONS                              ///
 ////////////////////////////////////////////////////////////////////////
@@ -76,6 +94,51 @@ int Gia_FileSize( char * pFileName )
     fclose( pFile );
     return nFileSize;
 }
+
+/**Function*************************************************************
+
+  Synopsis    [Maps the file into memory.]
+
+  Description [Returns the private writable mapping of the file, or NULL 
+  if the file cannot be mapped; in the latter case, the caller reads the 
+  file into an allocated buffer. Pages are copied by the OS only if 
+  the parser writes into them (which happens when signal names are 
+  zero-terminated in place). Mapping is not used when the file size is 
+  a multiple of the page size, because the parser may look at the byte 
+  following the last one, which is only guaranteed to be readable (and 
+  zero) inside the last partially used page.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+char * Gia_FileMap( char * pFileName, int nFileSize )
+{
+#ifndef _WIN32
+    char * pContents;
+    int fd;
+    if ( nFileSize <= 0 || nFileSize % (int)sysconf(_SC_PAGESIZE) == 0 )
+        return NULL;
+    fd = open( pFileName, O_RDONLY );
+    if ( fd == -1 )
+        return NULL;
+    pContents = (char *)mmap( NULL, (size_t)nFileSize, PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, 0 );
+    close( fd );
+    if ( pContents == (char *)MAP_FAILED )
+        return NULL;
+    madvise( pContents, (size_t)nFileSize, MADV_SEQUENTIAL );
+    return pContents;
+#else
+    return NULL;
+#endif
+}
+void Gia_FileUnmap( char * pContents, int nFileSize )
+{
+#ifndef _WIN32
+    munmap( pContents, (size_t)nFileSize );
+#endif
+}
 void Gia_FileWriteBufferSize( FILE * pFile, int nSize )
 {
     unsigned char Buffer[5];
@@ -161,6 +224,189 @@ Vec_Str_t * Gia_AigerWriteLiterals( Vec_Int_t * vLits )
 */
     return vBinary;
 }
+
+/**Function*************************************************************
+
+  Synopsis    [Wraps the extension section without copying it.]
+
+  Description [The resulting string points into the file contents and 
+  should not be freed or resized.]
+  
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static inline Vec_Str_t * Gia_AigerReadSection( Vec_Str_t * vStr, int nSize, unsigned char * pCur )
+{
+    vStr->nCap   = nSize;
+    vStr->nSize  = nSize;
+    vStr->pArray = (char *)pCur;
+    return vStr;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Decodes the AND section of binary AIGER using several threads.]
+
+  Description [Works only when structural hashing is not performed, so that 
+  the AIGER variable of each AND node is its object ID and the nodes can 
+  be decoded independently. The bytes from the beginning of the section 
+  to the end of the file are divided into chunks. The first pass counts 
+  the bytes that end a varint (the high bit is not set) in each chunk, 
+  which gives the index of the first varint in each chunk. The second pass 
+  decodes the nodes whose first varint starts in the chunk, reading 
+  past the end of the chunk if needed. The varints after the AND section 
+  (symbols and extensions) are counted in the first pass but never decoded. 
+  If fCheck is set, makes sure the fanin literals precede the node. Returns 
+  0 if the check has failed. Updates the current position to point to 
+  the end of the AND section.]
+  
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+typedef struct Gia_AigerParThData_t_
+{
+    Gia_Man_t *     pNew;
+    unsigned char * pStart;       // the beginning of the AND section
+    unsigned char * pChunk;       // the beginning of the chunk
+    unsigned char * pLimit;       // the end of the chunk
+    unsigned char * pEnd;         // the end of the AND section (if found by this thread)
+    int             nAnds;        // the number of AND nodes
+    int             iVarint;      // the number of varints before the chunk
+    int             nVarints;     // the number of varints ending in the chunk
+    int             nBufs;        // the number of buffers created
+    int             fCheck;       // perform the check
+    int             fError;       // the check has failed
+} Gia_AigerParThData_t;
+static void * Gia_AigerReadCountThread( void * pArg )
+{
+    Gia_AigerParThData_t * pThData = (Gia_AigerParThData_t *)pArg;
+    unsigned char * pCur;
+    int Counter = 0;
+    for ( pCur = pThData->pChunk; pCur < pThData->pLimit; pCur++ )
+        Counter += !(*pCur & 0x80);
+    pThData->nVarints = Counter;
+    return NULL;
+}
+static void * Gia_AigerReadDecodeThread( void * pArg )
+{
+    Gia_AigerParThData_t * pThData = (Gia_AigerParThData_t *)pArg;
+    Gia_Man_t * pNew = pThData->pNew;
+    unsigned char * pCur = pThData->pChunk;
+    int iVarint = pThData->iVarint;
+    int nCiNum  = Gia_ManCiNum(pNew);
+    unsigned uLit, uLit0, uLit1;
+    // skip the tail of the varint started in the previous chunk
+    if ( pCur > pThData->pStart && (pCur[-1] & 0x80) )
+    {
+        while ( *pCur++ & 0x80 );
+        iVarint++;
+    }
+    // skip the second varint of the node started in the previous chunk
+    if ( (iVarint & 1) && pCur < pThData->pLimit && iVarint < 2 * pThData->nAnds )
+    {
+        Gia_AigerReadUnsigned( &pCur );
+        iVarint++;
+    }
+    for ( ; pCur < pThData->pLimit && iVarint < 2 * pThData->nAnds; iVarint += 2 )
+    {
+        int iObj = 1 + nCiNum + iVarint / 2;
+        Gia_Obj_t * pObj = pNew->pObjs + iObj;
+        uLit  = (unsigned)iObj << 1;
+        uLit1 = uLit  - Gia_AigerReadUnsigned( &pCur );
+        uLit0 = uLit1 - Gia_AigerReadUnsigned( &pCur );
+        if ( pThData->fCheck && (uLit1 >= uLit || uLit0 > uLit1) )
+        {
+            pThData->fError = 1;
+            return NULL;
+        }
+        pObj->iDiff0  = iObj - (uLit0 >> 1);
+        pObj->fCompl0 = uLit0 & 1;
+        pObj->iDiff1  = iObj - (uLit1 >> 1);
+        pObj->fCompl1 = uLit1 & 1;
+        pThData->nBufs += (uLit0 == uLit1);
+        if ( iVarint + 2 == 2 * pThData->nAnds )
+            pThData->pEnd = pCur;
+    }
+    return NULL;
+}
+int Gia_AigerReadAndsPar( Gia_Man_t * pNew, unsigned char ** ppCur, unsigned char * pLimit, int nAnds, int fCheck, int nThreads )
+{
+#ifdef ABC_USE_PTHREADS
+    pthread_t WorkerThread[PAR_THR_MAX];
+    Gia_AigerParThData_t ThData[PAR_THR_MAX];
+    unsigned char * pEnd = NULL;
+    int i, status, nChunk, iVarint = 0, fError = 0;
+    assert( Gia_ManObjNum(pNew) == 1 + Gia_ManCiNum(pNew) );
+    assert( Gia_ManObjNum(pNew) + nAnds <= pNew->nObjsAlloc );
+    if ( nAnds == 0 )
+        return 1;
+    nThreads = Abc_MaxInt( 1, Abc_MinInt(nThreads, PAR_THR_MAX) );
+    nChunk = (int)((pLimit - *ppCur) + nThreads - 1) / nThreads;
+    for ( i = 0; i < nThreads; i++ )
+    {
+        memset( ThData + i, 0, sizeof(Gia_AigerParThData_t) );
+        ThData[i].pNew   = pNew;
+        ThData[i].pStart = *ppCur;
+        ThData[i].pChunk = Abc_MinInt( i * nChunk, pLimit - *ppCur ) + *ppCur;
+        ThData[i].pLimit = Abc_MinInt( (i + 1) * nChunk, pLimit - *ppCur ) + *ppCur;
+        ThData[i].nAnds  = nAnds;
+        ThData[i].fCheck = fCheck;
+    }
+    // count the varints in each chunk
+    for ( i = 0; i < nThreads; i++ )
+    {
+        status = pthread_create( WorkerThread + i, NULL, Gia_AigerReadCountThread, (void *)(ThData + i) );  assert( status == 0 );
+    }
+    for ( i = 0; i < nThreads; i++ )
+    {
+        status = pthread_join( WorkerThread[i], NULL );  assert( status == 0 );
+        ThData[i].iVarint = iVarint;
+        iVarint += ThData[i].nVarints;
+    }
+    if ( iVarint < 2 * nAnds )
+        return 0;
+    // decode the nodes
+    for ( i = 0; i < nThreads; i++ )
+    {
+        status = pthread_create( WorkerThread + i, NULL, Gia_AigerReadDecodeThread, (void *)(ThData + i) );  assert( status == 0 );
+    }
+    for ( i = 0; i < nThreads; i++ )
+    {
+        status = pthread_join( WorkerThread[i], NULL );  assert( status == 0 );
+        pNew->nBufs += ThData[i].nBufs;
+        fError |= ThData[i].fError;
+        if ( ThData[i].pEnd )
+            pEnd = ThData[i].pEnd;
+    }
+    if ( fError )
+        return 0;
+    assert( pEnd != NULL );
+    pNew->nObjs += nAnds;
+    *ppCur = pEnd;
+    return 1;
+#else
+    Gia_AigerParThData_t ThData;
+    memset( &ThData, 0, sizeof(Gia_AigerParThData_t) );
+    ThData.pNew   = pNew;
+    ThData.pStart = ThData.pChunk = *ppCur;
+    ThData.pLimit = pLimit;
+    ThData.nAnds  = nAnds;
+    ThData.fCheck = fCheck;
+    if ( nAnds == 0 )
+        return 1;
+    Gia_AigerReadDecodeThread( &ThData );
+    if ( ThData.fError || ThData.pEnd == NULL )
+        return 0;
+    pNew->nBufs += ThData.nBufs;
+    pNew->nObjs += nAnds;
+    *ppCur = ThData.pEnd;
+    return 1;
+#endif
+}
 
 /**Function*************************************************************
 
@@ -174,6 +420,23 @@ Vec_Str_t * Gia_AigerWriteLiterals( Vec_Int_t * vLits )
 
 ***********************************************************************/
 Gia_Man_t * Gia_AigerReadFromMemory( char * pContents, int nFileSize, int fGiaSimple, int fSkipStrash, int fCheck )
+{
+    return Gia_AigerReadFromMemoryPar( pContents, nFileSize, fGiaSimple, fSkipStrash, fCheck, 1 );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Reads the AIG in the binary AIGER format.]
+
+  Description [When nThreads > 1 and structural hashing is skipped, 
+  the AND section is decoded by several threads.]
+  
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Gia_Man_t * Gia_AigerReadFromMemoryPar( char * pContents, int nFileSize, int fGiaSimple, int fSkipStrash, int fCheck, int nThreads )
 {
     Gia_Man_t * pNew, * pTemp;
     Vec_Int_t * vLits = NULL, * vPoTypes = NULL;
@@ -283,9 +546,23 @@ Gia_Man_t * Gia_AigerReadFromMemory( char * pContents, int nFileSize, int fGiaSi
     }
 
     // create the AND gates
+    if ( nThreads > 1 && !fGiaSimple && fSkipStrash )
+    {
+        if ( !Gia_AigerReadAndsPar( pNew, &pCur, (unsigned char *)pContents + nFileSize, nAnds, fCheck, nThreads ) )
+        {
+            fprintf( stdout, "The AND section is in a wrong format.\n" );
+            Vec_IntFreeP( &vLits );
+            Vec_IntFree( vNodes );
+            Gia_ManStop( pNew );
+            return NULL;
+        }
+        for ( i = 0; i < nAnds; i++ )
+            Vec_IntPush( vNodes, Abc_Var2Lit(1 + nInputs + nLatches + i, 0) );
+    }
     if ( !fGiaSimple && !fSkipStrash )
         Gia_ManHashAlloc( pNew );
-    for ( i = 0; i < nAnds; i++ )
+    // (the nodes decoded above are skipped)
+    for ( i = Vec_IntSize(vNodes) - 1 - nInputs - nLatches; i < nAnds; i++ )
     {
         uLit = ((i + 1 + nInputs + nLatches) << 1);
         uLit1 = uLit  - Gia_AigerReadUnsigned( &pCur );
@@ -512,7 +789,7 @@ Gia_Man_t * Gia_AigerReadFromMemory( char * pContents, int nFileSize, int fGiaSi
     if ( pCur + 1 < (unsigned char *)pContents + nFileSize && *pCur == 'c' )
     {
         int fVerbose = XAIG_VERBOSE;
-        Vec_Str_t * vStr;
+        Vec_Str_t * vStr, StrTemp;
         unsigned char * pCurTemp;
         pCur++;
         // skip new line if present
@@ -523,12 +800,11 @@ Gia_Man_t * Gia_AigerReadFromMemory( char * pContents, int nFileSize, int fGiaSi
             // read extra AIG
             if ( *pCur == 'a' )
             {
+                int nSize;
                 pCur++;
-                vStr = Vec_StrStart( Gia_AigerReadInt(pCur) );             pCur += 4;
-                memcpy( Vec_StrArray(vStr), pCur, Vec_StrSize(vStr) );
-                pCur += Vec_StrSize(vStr);
-                pNew->pAigExtra = Gia_AigerReadFromMemory( Vec_StrArray(vStr), Vec_StrSize(vStr), 0, 0, 0 );
-                Vec_StrFree( vStr );
+                nSize = Gia_AigerReadInt(pCur);                            pCur += 4;
+                pNew->pAigExtra = Gia_AigerReadFromMemory( (char *)pCur, nSize, 0, 0, 0 );
+                pCur += nSize;
                 if ( fVerbose ) printf( "Finished reading extension \"a\".\n" );
             }
             // read number of constraints
@@ -596,11 +872,9 @@ Gia_Man_t * Gia_AigerReadFromMemory( char * pContents, int nFileSize, int fGiaSi
             else if ( *pCur == 'h' )
             {
                 pCur++;
-                vStr = Vec_StrStart( Gia_AigerReadInt(pCur) );          pCur += 4;
-                memcpy( Vec_StrArray(vStr), pCur, Vec_StrSize(vStr) );
+                vStr = Gia_AigerReadSection( &StrTemp, Gia_AigerReadInt(pCur), pCur + 4 );  pCur += 4;
                 pCur += Vec_StrSize(vStr);
                 pNew->pManTime = Tim_ManLoad( vStr, 1 );
-                Vec_StrFree( vStr );
                 fHieOnly = 1;
                 if ( fVerbose ) printf( "Finished reading extension \"h\".\n" );
             }
@@ -707,7 +981,7 @@ Gia_Man_t * Gia_AigerReadFromMemory( char * pContents, int nFileSize, int fGiaSi
             {
                 int i, nPairs, iRepr, iNode;
                 assert( !Gia_ManHasChoices(pNew) );
-                pNew->pSibls = ABC_CALLOC( int, Gia_ManObjNum(pNew) );
+                pNew->pSibls = Gia_ManAuxIntStart( pNew, Gia_ManObjNum(pNew) );
                 pCur++;
                 pCurTemp = pCur + Gia_AigerReadInt(pCur) + 4;           pCur += 4;
                 nPairs = Gia_AigerReadInt(pCur);                        pCur += 4;
@@ -736,10 +1010,9 @@ Gia_Man_t * Gia_AigerReadFromMemory( char * pContents, int nFileSize, int fGiaSi
             else if ( *pCur == 't' )
             {
                 pCur++;
-                vStr = Vec_StrStart( Gia_AigerReadInt(pCur) );          pCur += 4;
-                memcpy( Vec_StrArray(vStr), pCur, Vec_StrSize(vStr) );  pCur += Vec_StrSize(vStr);
+                vStr = Gia_AigerReadSection( &StrTemp, Gia_AigerReadInt(pCur), pCur + 4 );  pCur += 4;
+                pCur += Vec_StrSize(vStr);
                 pNew->pManTime = Tim_ManLoad( vStr, 0 );
-                Vec_StrFree( vStr );
                 if ( fVerbose ) printf( "Finished reading extension \"t\".\n" );
             }
             // read object classes
@@ -874,6 +1147,10 @@ Gia_Man_t * Gia_AigerReadFromMemory( char * pContents, int nFileSize, int fGiaSi
 
 ***********************************************************************/
 Gia_Man_t * Gia_AigerRead( char * pFileName, int fGiaSimple, int fSkipStrash, int fCheck )
+{
+    return Gia_AigerReadPar( pFileName, fGiaSimple, fSkipStrash, fCheck, 1 );
+}
+Gia_Man_t * Gia_AigerReadPar( char * pFileName, int fGiaSimple, int fSkipStrash, int fCheck, int nThreads )
 {
     FILE * pFile;
     Gia_Man_t * pNew;
@@ -881,16 +1158,30 @@ Gia_Man_t * Gia_AigerRead( char * pFileName, int fGiaSimple, int fSkipStrash, in
     int nFileSize;
     int RetValue;
 
-    // read the file into the buffer
+    // map the file into memory or read it into the buffer
     Gia_FileFixName( pFileName );
-    nFileSize = Gia_FileSize( pFileName );
-    pFile = fopen( pFileName, "rb" );
-    pContents = ABC_ALLOC( char, nFileSize );
-    RetValue = fread( pContents, nFileSize, 1, pFile );
-    fclose( pFile );
-
-    pNew = Gia_AigerReadFromMemory( pContents, nFileSize, fGiaSimple, fSkipStrash, fCheck );
-    ABC_FREE( pContents );
+    if ( Gia_AigerFileIsZip(pFileName) )
+    {
+        pContents = Gia_AigerLoadFileZip( pFileName, &nFileSize );
+        if ( pContents == NULL )
+            return NULL;
+        pNew = Gia_AigerReadFromMemoryPar( pContents, nFileSize, fGiaSimple, fSkipStrash, fCheck, nThreads );
+        ABC_FREE( pContents );
+    }
+    else if ( (pContents = Gia_FileMap( pFileName, (nFileSize = Gia_FileSize(pFileName)) )) )
+    {
+        pNew = Gia_AigerReadFromMemoryPar( pContents, nFileSize, fGiaSimple, fSkipStrash, fCheck, nThreads );
+        Gia_FileUnmap( pContents, nFileSize );
+    }
+    else
+    {
+        pFile = fopen( pFileName, "rb" );
+        pContents = ABC_ALLOC( char, nFileSize );
+        RetValue = fread( pContents, nFileSize, 1, pFile );
+        fclose( pFile );
+        pNew = Gia_AigerReadFromMemoryPar( pContents, nFileSize, fGiaSimple, fSkipStrash, fCheck, nThreads );
+        ABC_FREE( pContents );
+    }
     if ( pNew )
     {
         ABC_FREE( pNew->pName );
@@ -1079,12 +1370,11 @@ Vec_Str_t * Gia_AigerWriteIntoMemoryStrPart( Gia_Man_t * p, Vec_Int_t * vCis, Ve
 void Gia_AigerWrite( Gia_Man_t * pInit, char * pFileName, int fWriteSymbols, int fCompact )
 {
     int fVerbose = XAIG_VERBOSE;
-    FILE * pFile;
+    Gia_AigerOut_t * pFile;
     Gia_Man_t * p;
     Gia_Obj_t * pObj;
     Vec_Str_t * vStrExt;
-    int i, nBufferSize, Pos;
-    unsigned char * pBuffer;
+    int i;
     unsigned uLit0, uLit1, uLit;
     assert( pInit->nXors == 0 && pInit->nMuxes == 0 );
 
@@ -1095,7 +1385,7 @@ void Gia_AigerWrite( Gia_Man_t * pInit, char * pFileName, int fWriteSymbols, int
     }
 
     // start the output stream
-    pFile = fopen( pFileName, "wb" );
+    pFile = Gia_AigerOutStart( pFileName );
     if ( pFile == NULL )
     {
         fprintf( stdout, "Gia_AigerWrite(): Cannot open the output file \"%s\".\n", pFileName );
@@ -1118,7 +1408,7 @@ void Gia_AigerWrite( Gia_Man_t * pInit, char * pFileName, int fWriteSymbols, int
         p = pInit;
 
     // write the header "M I L O A" where M = I + L + A
-    fprintf( pFile, "aig%s %u %u %u %u %u", 
+    Gia_AigerOutPrintf( pFile, "aig%s %u %u %u %u %u", 
         fCompact? "2" : "",
         Gia_ManCiNum(p) + Gia_ManAndNum(p), 
         Gia_ManPiNum(p),
@@ -1127,55 +1417,39 @@ void Gia_AigerWrite( Gia_Man_t * pInit, char * pFileName, int fWriteSymbols, int
         Gia_ManAndNum(p) );
     // write the extended header "B C J F"
     if ( Gia_ManConstrNum(p) )
-        fprintf( pFile, " %u %u", Gia_ManPoNum(p) - Gia_ManConstrNum(p), Gia_ManConstrNum(p) );
-    fprintf( pFile, "\n" ); 
+        Gia_AigerOutPrintf( pFile, " %u %u", Gia_ManPoNum(p) - Gia_ManConstrNum(p), Gia_ManConstrNum(p) );
+    Gia_AigerOutPrintf( pFile, "\n" ); 
 
     Gia_ManInvertConstraints( p );
     if ( !fCompact ) 
     {
         // write latch drivers
         Gia_ManForEachRi( p, pObj, i )
-            fprintf( pFile, "%u\n", Gia_ObjFaninLit0p(p, pObj) );
+            Gia_AigerOutPrintf( pFile, "%u\n", Gia_ObjFaninLit0p(p, pObj) );
         // write PO drivers
         Gia_ManForEachPo( p, pObj, i )
-            fprintf( pFile, "%u\n", Gia_ObjFaninLit0p(p, pObj) );
+            Gia_AigerOutPrintf( pFile, "%u\n", Gia_ObjFaninLit0p(p, pObj) );
     }
     else
     {
         Vec_Int_t * vLits = Gia_AigerCollectLiterals( p );
         Vec_Str_t * vBinary = Gia_AigerWriteLiterals( vLits );
-        fwrite( Vec_StrArray(vBinary), 1, Vec_StrSize(vBinary), pFile );
+        Gia_AigerOutWrite( pFile, Vec_StrArray(vBinary), Vec_StrSize(vBinary) );
         Vec_StrFree( vBinary );
         Vec_IntFree( vLits );
     }
     Gia_ManInvertConstraints( p );
 
-    // write the nodes into the buffer
-    Pos = 0;
-    nBufferSize = 8 * Gia_ManAndNum(p) + 100; // skeptically assuming 3 chars per one AIG edge
-    pBuffer = ABC_ALLOC( unsigned char, nBufferSize );
+    // write the nodes through the buffer of the stream
     Gia_ManForEachAnd( p, pObj, i )
     {
         uLit  = Abc_Var2Lit( i, 0 );
         uLit0 = Gia_ObjFaninLit0( pObj, i );
         uLit1 = Gia_ObjFaninLit1( pObj, i );
         assert( p->fGiaSimple || Gia_ManBufNum(p) || uLit0 < uLit1 );
-        Pos = Gia_AigerWriteUnsignedBuffer( pBuffer, Pos, uLit  - uLit1 );
-        Pos = Gia_AigerWriteUnsignedBuffer( pBuffer, Pos, uLit1 - uLit0 );
-        if ( Pos > nBufferSize - 10 )
-        {
-            printf( "Gia_AigerWrite(): AIGER generation has failed because the allocated buffer is too small.\n" );
-	        fclose( pFile );
-            if ( p != pInit )
-                Gia_ManStop( p );
-            return;
-        }
+        Gia_AigerOutWriteUnsigned( pFile, uLit  - uLit1 );
+        Gia_AigerOutWriteUnsigned( pFile, uLit1 - uLit0 );
     }
-    assert( Pos < nBufferSize );
-
-    // write the buffer
-    fwrite( pBuffer, 1, Pos, pFile );
-    ABC_FREE( pBuffer );
 
     // write the symbol table
     if ( p->vNamesIn && p->vNamesOut )
@@ -1184,42 +1458,42 @@ void Gia_AigerWrite( Gia_Man_t * pInit, char * pFileName, int fWriteSymbols, int
         assert( Vec_PtrSize(p->vNamesOut) == Gia_ManCoNum(p) );
         // write PIs
         Gia_ManForEachPi( p, pObj, i )
-            fprintf( pFile, "i%d %s\n", i, (char *)Vec_PtrEntry(p->vNamesIn, i) );
+            Gia_AigerOutPrintf( pFile, "i%d %s\n", i, (char *)Vec_PtrEntry(p->vNamesIn, i) );
         // write latches
         Gia_ManForEachRo( p, pObj, i )
-            fprintf( pFile, "l%d %s\n", i, (char *)Vec_PtrEntry(p->vNamesIn, Gia_ManPiNum(p) + i) );
+            Gia_AigerOutPrintf( pFile, "l%d %s\n", i, (char *)Vec_PtrEntry(p->vNamesIn, Gia_ManPiNum(p) + i) );
         // write POs
         Gia_ManForEachPo( p, pObj, i )
-            fprintf( pFile, "o%d %s\n", i, (char *)Vec_PtrEntry(p->vNamesOut, i) );
+            Gia_AigerOutPrintf( pFile, "o%d %s\n", i, (char *)Vec_PtrEntry(p->vNamesOut, i) );
     }
 
     // write the comment
-//    fprintf( pFile, "c\n" );
-    fprintf( pFile, "c" );
+//    Gia_AigerOutPrintf( pFile, "c\n" );
+    Gia_AigerOutPrintf( pFile, "c" );
 
     // write additional AIG
     if ( p->pAigExtra )
     {
-        fprintf( pFile, "a" );
+        Gia_AigerOutPrintf( pFile, "a" );
         vStrExt = Gia_AigerWriteIntoMemoryStr( p->pAigExtra );
-        Gia_FileWriteBufferSize( pFile, Vec_StrSize(vStrExt) );
-        fwrite( Vec_StrArray(vStrExt), 1, Vec_StrSize(vStrExt), pFile );
+        Gia_AigerOutWriteInt( pFile, Vec_StrSize(vStrExt) );
+        Gia_AigerOutWrite( pFile, Vec_StrArray(vStrExt), Vec_StrSize(vStrExt) );
         Vec_StrFree( vStrExt );
         if ( fVerbose ) printf( "Finished writing extension \"a\".\n" );
     }
     // write constraints
     if ( p->nConstrs )
     {
-        fprintf( pFile, "c" );
-        Gia_FileWriteBufferSize( pFile, 4 );
-        Gia_FileWriteBufferSize( pFile, p->nConstrs );
+        Gia_AigerOutPrintf( pFile, "c" );
+        Gia_AigerOutWriteInt( pFile, 4 );
+        Gia_AigerOutWriteInt( pFile, p->nConstrs );
     }
     // write timing information
     if ( p->nAnd2Delay )
     {
-        fprintf( pFile, "d" );
-        Gia_FileWriteBufferSize( pFile, 4 );
-        Gia_FileWriteBufferSize( pFile, p->nAnd2Delay );
+        Gia_AigerOutPrintf( pFile, "d" );
+        Gia_AigerOutWriteInt( pFile, 4 );
+        Gia_AigerOutWriteInt( pFile, p->nAnd2Delay );
     }
     if ( p->pManTime )
     {
@@ -1227,18 +1501,18 @@ void Gia_AigerWrite( Gia_Man_t * pInit, char * pFileName, int fWriteSymbols, int
         pTimes = Tim_ManGetArrTimes( (Tim_Man_t *)p->pManTime );
         if ( pTimes )
         {
-            fprintf( pFile, "i" );
-            Gia_FileWriteBufferSize( pFile, 4*Tim_ManPiNum((Tim_Man_t *)p->pManTime) );
-            fwrite( pTimes, 1, 4*Tim_ManPiNum((Tim_Man_t *)p->pManTime), pFile );
+            Gia_AigerOutPrintf( pFile, "i" );
+            Gia_AigerOutWriteInt( pFile, 4*Tim_ManPiNum((Tim_Man_t *)p->pManTime) );
+            Gia_AigerOutWrite( pFile, pTimes, 4*Tim_ManPiNum((Tim_Man_t *)p->pManTime) );
             ABC_FREE( pTimes );
             if ( fVerbose ) printf( "Finished writing extension \"i\".\n" );
         }
         pTimes = Tim_ManGetReqTimes( (Tim_Man_t *)p->pManTime );
         if ( pTimes )
         {
-            fprintf( pFile, "o" );
-            Gia_FileWriteBufferSize( pFile, 4*Tim_ManPoNum((Tim_Man_t *)p->pManTime) );
-            fwrite( pTimes, 1, 4*Tim_ManPoNum((Tim_Man_t *)p->pManTime), pFile );
+            Gia_AigerOutPrintf( pFile, "o" );
+            Gia_AigerOutWriteInt( pFile, 4*Tim_ManPoNum((Tim_Man_t *)p->pManTime) );
+            Gia_AigerOutWrite( pFile, pTimes, 4*Tim_ManPoNum((Tim_Man_t *)p->pManTime) );
             ABC_FREE( pTimes );
             if ( fVerbose ) printf( "Finished writing extension \"o\".\n" );
         }
@@ -1247,35 +1521,35 @@ void Gia_AigerWrite( Gia_Man_t * pInit, char * pFileName, int fWriteSymbols, int
     if ( p->pReprs && p->pNexts )
     {
         extern Vec_Str_t * Gia_WriteEquivClasses( Gia_Man_t * p );
-        fprintf( pFile, "e" );
+        Gia_AigerOutPrintf( pFile, "e" );
         vStrExt = Gia_WriteEquivClasses( p );
-        Gia_FileWriteBufferSize( pFile, Vec_StrSize(vStrExt) );
-        fwrite( Vec_StrArray(vStrExt), 1, Vec_StrSize(vStrExt), pFile );
+        Gia_AigerOutWriteInt( pFile, Vec_StrSize(vStrExt) );
+        Gia_AigerOutWrite( pFile, Vec_StrArray(vStrExt), Vec_StrSize(vStrExt) );
         Vec_StrFree( vStrExt );
     }
     // write flop classes
     if ( p->vFlopClasses )
     {
-        fprintf( pFile, "f" );
-        Gia_FileWriteBufferSize( pFile, 4*Gia_ManRegNum(p) );
+        Gia_AigerOutPrintf( pFile, "f" );
+        Gia_AigerOutWriteInt( pFile, 4*Gia_ManRegNum(p) );
         assert( Vec_IntSize(p->vFlopClasses) == Gia_ManRegNum(p) );
-        fwrite( Vec_IntArray(p->vFlopClasses), 1, 4*Gia_ManRegNum(p), pFile );
+        Gia_AigerOutWrite( pFile, Vec_IntArray(p->vFlopClasses), 4*Gia_ManRegNum(p) );
     }
     // write gate classes
     if ( p->vGateClasses )
     {
-        fprintf( pFile, "g" );
-        Gia_FileWriteBufferSize( pFile, 4*Gia_ManObjNum(p) );
+        Gia_AigerOutPrintf( pFile, "g" );
+        Gia_AigerOutWriteInt( pFile, 4*Gia_ManObjNum(p) );
         assert( Vec_IntSize(p->vGateClasses) == Gia_ManObjNum(p) );
-        fwrite( Vec_IntArray(p->vGateClasses), 1, 4*Gia_ManObjNum(p), pFile );
+        Gia_AigerOutWrite( pFile, Vec_IntArray(p->vGateClasses), 4*Gia_ManObjNum(p) );
     }
     // write hierarchy info
     if ( p->pManTime )
     {
-        fprintf( pFile, "h" );
+        Gia_AigerOutPrintf( pFile, "h" );
         vStrExt = Tim_ManSave( (Tim_Man_t *)p->pManTime, 1 );
-        Gia_FileWriteBufferSize( pFile, Vec_StrSize(vStrExt) );
-        fwrite( Vec_StrArray(vStrExt), 1, Vec_StrSize(vStrExt), pFile );
+        Gia_AigerOutWriteInt( pFile, Vec_StrSize(vStrExt) );
+        Gia_AigerOutWrite( pFile, Vec_StrArray(vStrExt), Vec_StrSize(vStrExt) );
         Vec_StrFree( vStrExt );
         if ( fVerbose ) printf( "Finished writing extension \"h\".\n" );
     }
@@ -1283,10 +1557,10 @@ void Gia_AigerWrite( Gia_Man_t * pInit, char * pFileName, int fWriteSymbols, int
     if ( p->vPacking )
     {
         extern Vec_Str_t * Gia_WritePacking( Vec_Int_t * vPacking );
-        fprintf( pFile, "k" );
+        Gia_AigerOutPrintf( pFile, "k" );
         vStrExt = Gia_WritePacking( p->vPacking );
-        Gia_FileWriteBufferSize( pFile, Vec_StrSize(vStrExt) );
-        fwrite( Vec_StrArray(vStrExt), 1, Vec_StrSize(vStrExt), pFile );
+        Gia_AigerOutWriteInt( pFile, Vec_StrSize(vStrExt) );
+        Gia_AigerOutWrite( pFile, Vec_StrArray(vStrExt), Vec_StrSize(vStrExt) );
         Vec_StrFree( vStrExt );
         if ( fVerbose ) printf( "Finished writing extension \"k\".\n" );
     }
@@ -1295,11 +1569,11 @@ void Gia_AigerWrite( Gia_Man_t * pInit, char * pFileName, int fWriteSymbols, int
     {
         Vec_Int_t * vPairs = Gia_ManEdgeToArray( p );
         int i;
-        fprintf( pFile, "w" );
-        Gia_FileWriteBufferSize( pFile, 4*(Vec_IntSize(vPairs)+1) );
-        Gia_FileWriteBufferSize( pFile, Vec_IntSize(vPairs)/2 );
+        Gia_AigerOutPrintf( pFile, "w" );
+        Gia_AigerOutWriteInt( pFile, 4*(Vec_IntSize(vPairs)+1) );
+        Gia_AigerOutWriteInt( pFile, Vec_IntSize(vPairs)/2 );
         for ( i = 0; i < Vec_IntSize(vPairs); i++ )
-            Gia_FileWriteBufferSize( pFile, Vec_IntEntry(vPairs, i) );
+            Gia_AigerOutWriteInt( pFile, Vec_IntEntry(vPairs, i) );
         Vec_IntFree( vPairs );
     }
     // write mapping
@@ -1308,107 +1582,108 @@ void Gia_AigerWrite( Gia_Man_t * pInit, char * pFileName, int fWriteSymbols, int
         extern Vec_Str_t * Gia_AigerWriteMapping( Gia_Man_t * p );
         extern Vec_Str_t * Gia_AigerWriteMappingSimple( Gia_Man_t * p );
         extern Vec_Str_t * Gia_AigerWriteMappingDoc( Gia_Man_t * p );
-        fprintf( pFile, "m" );
+        Gia_AigerOutPrintf( pFile, "m" );
         vStrExt = Gia_AigerWriteMappingDoc( p );
-        Gia_FileWriteBufferSize( pFile, Vec_StrSize(vStrExt) );
-        fwrite( Vec_StrArray(vStrExt), 1, Vec_StrSize(vStrExt), pFile );
+        Gia_AigerOutWriteInt( pFile, Vec_StrSize(vStrExt) );
+        Gia_AigerOutWrite( pFile, Vec_StrArray(vStrExt), Vec_StrSize(vStrExt) );
         Vec_StrFree( vStrExt );
         if ( fVerbose ) printf( "Finished writing extension \"m\".\n" );
     }
     // write placement
     if ( p->pPlacement )
     {
-        fprintf( pFile, "p" );
-        Gia_FileWriteBufferSize( pFile, 4*Gia_ManObjNum(p) );
-        fwrite( p->pPlacement, 1, 4*Gia_ManObjNum(p), pFile );
+        Gia_AigerOutPrintf( pFile, "p" );
+        Gia_AigerOutWriteInt( pFile, 4*Gia_ManObjNum(p) );
+        Gia_AigerOutWrite( pFile, p->pPlacement, 4*Gia_ManObjNum(p) );
     }
     // write register classes
     if ( p->vRegClasses )
     {
         int i;
-        fprintf( pFile, "r" );
-        Gia_FileWriteBufferSize( pFile, 4*(Vec_IntSize(p->vRegClasses)+1) );
-        Gia_FileWriteBufferSize( pFile, Vec_IntSize(p->vRegClasses) );
+        Gia_AigerOutPrintf( pFile, "r" );
+        Gia_AigerOutWriteInt( pFile, 4*(Vec_IntSize(p->vRegClasses)+1) );
+        Gia_AigerOutWriteInt( pFile, Vec_IntSize(p->vRegClasses) );
         for ( i = 0; i < Vec_IntSize(p->vRegClasses); i++ )
-            Gia_FileWriteBufferSize( pFile, Vec_IntEntry(p->vRegClasses, i) );
+            Gia_AigerOutWriteInt( pFile, Vec_IntEntry(p->vRegClasses, i) );
     }
     // write register inits
     if ( p->vRegInits )
     {
         int i;
-        fprintf( pFile, "s" );
-        Gia_FileWriteBufferSize( pFile, 4*(Vec_IntSize(p->vRegInits)+1) );
-        Gia_FileWriteBufferSize( pFile, Vec_IntSize(p->vRegInits) );
+        Gia_AigerOutPrintf( pFile, "s" );
+        Gia_AigerOutWriteInt( pFile, 4*(Vec_IntSize(p->vRegInits)+1) );
+        Gia_AigerOutWriteInt( pFile, Vec_IntSize(p->vRegInits) );
         for ( i = 0; i < Vec_IntSize(p->vRegInits); i++ )
-            Gia_FileWriteBufferSize( pFile, Vec_IntEntry(p->vRegInits, i) );
+            Gia_AigerOutWriteInt( pFile, Vec_IntEntry(p->vRegInits, i) );
     }
     // write configuration data
     if ( p->vConfigs )
     {
-        fprintf( pFile, "b" );
+        Gia_AigerOutPrintf( pFile, "b" );
         assert( p->pCellStr != NULL );
-        Gia_FileWriteBufferSize( pFile, 4*Vec_IntSize(p->vConfigs) + strlen(p->pCellStr) + 1 );
-        fwrite( p->pCellStr, 1, strlen(p->pCellStr) + 1, pFile );
+        Gia_AigerOutWriteInt( pFile, 4*Vec_IntSize(p->vConfigs) + strlen(p->pCellStr) + 1 );
+        Gia_AigerOutWrite( pFile, p->pCellStr, strlen(p->pCellStr) + 1 );
 //        fwrite( Vec_IntArray(p->vConfigs), 1, 4*Vec_IntSize(p->vConfigs), pFile );
         for ( i = 0; i < Vec_IntSize(p->vConfigs); i++ )
-            Gia_FileWriteBufferSize( pFile, Vec_IntEntry(p->vConfigs, i) );
+            Gia_AigerOutWriteInt( pFile, Vec_IntEntry(p->vConfigs, i) );
     }
     // write choices
     if ( Gia_ManHasChoices(p) )
     {
         int i, nPairs = 0;
-        fprintf( pFile, "q" );
+        Gia_AigerOutPrintf( pFile, "q" );
         for ( i = 0; i < Gia_ManObjNum(p); i++ )
             nPairs += (Gia_ObjSibl(p, i) > 0);
-        Gia_FileWriteBufferSize( pFile, 4*(nPairs * 2 + 1) );
-        Gia_FileWriteBufferSize( pFile, nPairs );
+        Gia_AigerOutWriteInt( pFile, 4*(nPairs * 2 + 1) );
+        Gia_AigerOutWriteInt( pFile, nPairs );
         for ( i = 0; i < Gia_ManObjNum(p); i++ )
             if ( Gia_ObjSibl(p, i) )
             {
                 assert( i > Gia_ObjSibl(p, i) );
-                Gia_FileWriteBufferSize( pFile, i );
-                Gia_FileWriteBufferSize( pFile, Gia_ObjSibl(p, i) );
+                Gia_AigerOutWriteInt( pFile, i );
+                Gia_AigerOutWriteInt( pFile, Gia_ObjSibl(p, i) );
             }
         if ( fVerbose ) printf( "Finished writing extension \"q\".\n" );
     }
     // write switching activity
     if ( p->pSwitching )
     {
-        fprintf( pFile, "u" );
-        Gia_FileWriteBufferSize( pFile, Gia_ManObjNum(p) );
-        fwrite( p->pSwitching, 1, Gia_ManObjNum(p), pFile );
+        Gia_AigerOutPrintf( pFile, "u" );
+        Gia_AigerOutWriteInt( pFile, Gia_ManObjNum(p) );
+        Gia_AigerOutWrite( pFile, p->pSwitching, Gia_ManObjNum(p) );
     }
 /*
     // write timing information
     if ( p->pManTime )
     {
-        fprintf( pFile, "t" );
+        Gia_AigerOutPrintf( pFile, "t" );
         vStrExt = Tim_ManSave( (Tim_Man_t *)p->pManTime, 0 );
-        Gia_FileWriteBufferSize( pFile, Vec_StrSize(vStrExt) );
-        fwrite( Vec_StrArray(vStrExt), 1, Vec_StrSize(vStrExt), pFile );
+        Gia_AigerOutWriteInt( pFile, Vec_StrSize(vStrExt) );
+        Gia_AigerOutWrite( pFile, Vec_StrArray(vStrExt), Vec_StrSize(vStrExt) );
         Vec_StrFree( vStrExt );
     }
 */
     // write object classes
     if ( p->vObjClasses )
     {
-        fprintf( pFile, "v" );
-        Gia_FileWriteBufferSize( pFile, 4*Gia_ManObjNum(p) );
+        Gia_AigerOutPrintf( pFile, "v" );
+        Gia_AigerOutWriteInt( pFile, 4*Gia_ManObjNum(p) );
         assert( Vec_IntSize(p->vObjClasses) == Gia_ManObjNum(p) );
-        fwrite( Vec_IntArray(p->vObjClasses), 1, 4*Gia_ManObjNum(p), pFile );
+        Gia_AigerOutWrite( pFile, Vec_IntArray(p->vObjClasses), 4*Gia_ManObjNum(p) );
     }
     // write name
     if ( p->pName )
     {
-        fprintf( pFile, "n" );
-        Gia_FileWriteBufferSize( pFile, strlen(p->pName)+1 );
-        fwrite( p->pName, 1, strlen(p->pName), pFile );
-        fprintf( pFile, "%c", '\0' );
+        Gia_AigerOutPrintf( pFile, "n" );
+        Gia_AigerOutWriteInt( pFile, strlen(p->pName)+1 );
+        Gia_AigerOutWrite( pFile, p->pName, strlen(p->pName) );
+        Gia_AigerOutPrintf( pFile, "%c", '\0' );
     }
     // write comments
-    fprintf( pFile, "\nThis file was produced by the GIA package in ABC on %s\n", Gia_TimeStamp() );
-    fprintf( pFile, "For information about AIGER format, refer to %s\n", "http://fmv.jku.at/aiger" );
-	fclose( pFile );
+    Gia_AigerOutPrintf( pFile, "\nThis file was produced by the GIA package in ABC on %s\n", Gia_TimeStamp() );
+    Gia_AigerOutPrintf( pFile, "For information about AIGER format, refer to %s\n", "http://fmv.jku.at/aiger" );
+    if ( !Gia_AigerOutStop( pFile ) )
+        fprintf( stdout, "Gia_AigerWrite(): Writing the output file \"%s\" has failed.\n", pFileName );
     if ( p != pInit )
     {
         pInit->pManTime  = p->pManTime;  p->pManTime = NULL;
@@ -0,0 +1,366 @@
+/**CFile****************************************************************
+
+  FileName    [giaAigerZip.c]
+
+  SystemName  [ABC: Logic synthesis and verification system.]
+
+  PackageName [Scalable AIG package.]
+
+  Synopsis    [Compressed input/output of binary AIGER files.]
+
+  Author      [Alan Mishchenko]
+
+  Affiliation [UC Berkeley]
+
+  Date        [Ver. 1.0. Started - June 20, 2005.]
+
+  Revision    [$Id: giaAigerZip.c,v 1.00 2005/06/20 00:00:00 alanmi Exp $]
+
+***********************************************************************/
+
+#include <stdarg.h>
+
+#include "gia.h"
+#include "misc/bzlib/bzlib.h"
+#include "misc/zlib/zlib.h"
+
+ABC_NAMESPACE_IMPL_START
+
+
+////////////////////////////////////////////////////////////////////////
+///                        DECLARATIONS                              ///
+////////////////////////////////////////////////////////////////////////
+
+#define GIA_OUT_BUFFER (1 << 20)   // the size of the output buffer
+#define GIA_ZIP_MAX    ((size_t)0x7FFFFFFF) // the largest decompressed file (its size is returned as int)
+
+// output stream with a bounded buffer
+struct Gia_AigerOut_t_
+{
+    FILE *         pFile;         // the output file (plain or BZ2)
+    gzFile         pFileGz;       // the output file (GZ)
+    BZFILE *       pFileBz;       // the compressed stream (BZ2)
+    char *         pBuffer;       // the data not yet written
+    int            nBuffer;       // the number of bytes in the buffer
+    int            fError;        // the writing has failed
+};
+
+////////////////////////////////////////////////////////////////////////
+///                     FUNCTION DEFINITIONS                         ///
+////////////////////////////////////////////////////////////////////////
+
+/**Function*************************************************************
+
+  Synopsis    [Returns 1 (2) if the file name has extension .gz (.bz2).]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Gia_AigerFileIsZip( char * pFileName )
+{
+    int nLength = strlen(pFileName);
+    if ( nLength > 3 && !strcmp(pFileName + nLength - 3, ".gz") )
+        return 1;
+    if ( nLength > 4 && !strcmp(pFileName + nLength - 4, ".bz2") )
+        return 2;
+    return 0;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Doubles the decompression buffer.]
+
+  Description [Returns NULL and frees the buffer if it cannot grow 
+  because the file is too large or the memory is exhausted.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static char * Gia_AigerZipGrow( char * pContents, size_t * pnBuffer, char * pFileName )
+{
+    char * pContentsNew = NULL;
+    size_t nBufferNew = *pnBuffer < GIA_ZIP_MAX / 2 ? 2 * *pnBuffer : GIA_ZIP_MAX;
+    if ( *pnBuffer < GIA_ZIP_MAX )
+        pContentsNew = ABC_REALLOC( char, pContents, nBufferNew );
+    if ( pContentsNew == NULL )
+    {
+        printf( "Gia_AigerLoadFileZip(): The decompressed file \"%s\" is too large.\n", pFileName );
+        ABC_FREE( pContents );
+        return NULL;
+    }
+    *pnBuffer = nBufferNew;
+    return pContentsNew;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Decompresses the file into the memory buffer.]
+
+  Description [The file is decompressed incrementally into the buffer,
+  which grows geometrically. The compressed file is never loaded
+  into memory. Returns the buffer, which should be freed by the user,
+  or NULL if the file cannot be read.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+char * Gia_AigerLoadFileZip( char * pFileName, int * pFileSize )
+{
+    char * pContents = NULL;
+    size_t nBuffer = GIA_OUT_BUFFER, nFileSize = 0;
+    int nRead = 0;
+    if ( Gia_AigerFileIsZip(pFileName) == 1 )
+    {
+        gzFile pFile = gzopen( pFileName, "rb" );
+        if ( pFile == NULL )
+        {
+            printf( "Gia_AigerLoadFileZip(): Cannot open file \"%s\".\n", pFileName );
+            return NULL;
+        }
+        pContents = ABC_ALLOC( char, nBuffer );
+        while ( (nRead = gzread(pFile, pContents + nFileSize, (unsigned)(nBuffer - nFileSize))) > 0 )
+        {
+            nFileSize += nRead;
+            if ( nFileSize == nBuffer && (pContents = Gia_AigerZipGrow(pContents, &nBuffer, pFileName)) == NULL )
+            {
+                nRead = -1;
+                break;
+            }
+        }
+        gzclose( pFile );
+    }
+    else
+    {
+        int bzError;
+        BZFILE * pFileBz;
+        FILE * pFile = fopen( pFileName, "rb" );
+        if ( pFile == NULL )
+        {
+            printf( "Gia_AigerLoadFileZip(): Cannot open file \"%s\".\n", pFileName );
+            return NULL;
+        }
+        pFileBz = BZ2_bzReadOpen( &bzError, pFile, 0, 0, NULL, 0 );
+        if ( bzError != BZ_OK )
+        {
+            printf( "Gia_AigerLoadFileZip(): BZ2_bzReadOpen() failed with error %d.\n", bzError );
+            fclose( pFile );
+            return NULL;
+        }
+        pContents = ABC_ALLOC( char, nBuffer );
+        do {
+            nRead = BZ2_bzRead( &bzError, pFileBz, pContents + nFileSize, (int)(nBuffer - nFileSize) );
+            if ( bzError != BZ_OK && bzError != BZ_STREAM_END )
+                break;
+            nFileSize += nRead;
+            if ( nFileSize == nBuffer && (pContents = Gia_AigerZipGrow(pContents, &nBuffer, pFileName)) == NULL )
+                break;
+        } while ( bzError == BZ_OK );
+        if ( bzError != BZ_STREAM_END || pContents == NULL )
+            nRead = -1;
+        BZ2_bzReadClose( &bzError, pFileBz );
+        fclose( pFile );
+    }
+    if ( nRead < 0 || nFileSize == 0 )
+    {
+        printf( "Gia_AigerLoadFileZip(): Cannot decompress file \"%s\".\n", pFileName );
+        ABC_FREE( pContents );
+        return NULL;
+    }
+    // leave a zero byte after the contents for the parser
+    if ( nFileSize == nBuffer )
+        pContents = ABC_REALLOC( char, pContents, nBuffer + 1 );
+    pContents[nFileSize] = 0;
+    *pFileSize = (int)nFileSize;
+    return pContents;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Starts the output stream.]
+
+  Description [Depending on the file extension (.gz, .bz2, or other),
+  the data is compressed or written as is. In all cases, the data goes
+  through the bounded buffer of the stream.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Gia_AigerOut_t * Gia_AigerOutStart( char * pFileName )
+{
+    Gia_AigerOut_t * p;
+    int bzError, Type = Gia_AigerFileIsZip( pFileName );
+    p = ABC_CALLOC( Gia_AigerOut_t, 1 );
+    if ( Type == 1 )
+        p->pFileGz = gzopen( pFileName, "wb" );
+    else
+        p->pFile = fopen( pFileName, "wb" );
+    if ( p->pFileGz == NULL && p->pFile == NULL )
+    {
+        ABC_FREE( p );
+        return NULL;
+    }
+    if ( Type == 2 )
+    {
+        p->pFileBz = BZ2_bzWriteOpen( &bzError, p->pFile, 9, 0, 0 );
+        if ( bzError != BZ_OK )
+        {
+            BZ2_bzWriteClose( &bzError, p->pFileBz, 0, NULL, NULL );
+            fclose( p->pFile );
+            ABC_FREE( p );
+            return NULL;
+        }
+    }
+    p->pBuffer = ABC_ALLOC( char, GIA_OUT_BUFFER );
+    return p;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Writes the buffer into the file.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static void Gia_AigerOutWriteRaw( Gia_AigerOut_t * p, char * pData, int nBytes )
+{
+    int bzError;
+    if ( nBytes == 0 || p->fError )
+        return;
+    if ( p->pFileGz )
+        p->fError = (gzwrite( p->pFileGz, pData, nBytes ) != nBytes);
+    else if ( p->pFileBz )
+    {
+        BZ2_bzWrite( &bzError, p->pFileBz, pData, nBytes );
+        p->fError = (bzError != BZ_OK);
+    }
+    else
+        p->fError = ((int)fwrite( pData, 1, nBytes, p->pFile ) != nBytes);
+}
+void Gia_AigerOutFlush( Gia_AigerOut_t * p )
+{
+    Gia_AigerOutWriteRaw( p, p->pBuffer, p->nBuffer );
+    p->nBuffer = 0;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Writes data into the output stream.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Gia_AigerOutWrite( Gia_AigerOut_t * p, void * pData, int nBytes )
+{
+    if ( p->nBuffer + nBytes > GIA_OUT_BUFFER )
+        Gia_AigerOutFlush( p );
+    if ( nBytes > GIA_OUT_BUFFER )
+        Gia_AigerOutWriteRaw( p, (char *)pData, nBytes );
+    else
+    {
+        memcpy( p->pBuffer + p->nBuffer, pData, nBytes );
+        p->nBuffer += nBytes;
+    }
+}
+void Gia_AigerOutWriteInt( Gia_AigerOut_t * p, int Value )
+{
+    unsigned char Buffer[4];
+    Gia_AigerWriteInt( Buffer, Value );
+    Gia_AigerOutWrite( p, Buffer, 4 );
+}
+void Gia_AigerOutWriteUnsigned( Gia_AigerOut_t * p, unsigned x )
+{
+    if ( p->nBuffer + 5 > GIA_OUT_BUFFER )
+        Gia_AigerOutFlush( p );
+    p->nBuffer = Gia_AigerWriteUnsignedBuffer( (unsigned char *)p->pBuffer, p->nBuffer, x );
+}
+void Gia_AigerOutPrintf( Gia_AigerOut_t * p, const char * pFormat, ... )
+{
+    va_list args;
+    int nBytes;
+    va_start( args, pFormat );
+    nBytes = vsnprintf( p->pBuffer + p->nBuffer, GIA_OUT_BUFFER - p->nBuffer, pFormat, args );
+    va_end( args );
+    if ( nBytes >= 0 && p->nBuffer + nBytes < GIA_OUT_BUFFER )
+    {
+        p->nBuffer += nBytes;
+        return;
+    }
+    if ( nBytes < 0 )
+    {
+        p->fError = 1;
+        return;
+    }
+    // the string did not fit into the buffer
+    Gia_AigerOutFlush( p );
+    if ( nBytes >= GIA_OUT_BUFFER )
+    {
+        char * pTemp = ABC_ALLOC( char, nBytes + 1 );
+        va_start( args, pFormat );
+        vsnprintf( pTemp, nBytes + 1, pFormat, args );
+        va_end( args );
+        Gia_AigerOutWriteRaw( p, pTemp, nBytes );
+        ABC_FREE( pTemp );
+        return;
+    }
+    va_start( args, pFormat );
+    p->nBuffer = vsnprintf( p->pBuffer, GIA_OUT_BUFFER, pFormat, args );
+    va_end( args );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Stops the output stream.]
+
+  Description [Returns 1 if all data has been written successfully.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Gia_AigerOutStop( Gia_AigerOut_t * p )
+{
+    int bzError, RetValue;
+    Gia_AigerOutFlush( p );
+    if ( p->pFileGz )
+        p->fError |= (gzclose( p->pFileGz ) != Z_OK);
+    else
+    {
+        if ( p->pFileBz )
+        {
+            BZ2_bzWriteClose( &bzError, p->pFileBz, 0, NULL, NULL );
+            p->fError |= (bzError != BZ_OK);
+        }
+        p->fError |= (fclose( p->pFile ) != 0);
+    }
+    RetValue = !p->fError;
+    ABC_FREE( p->pBuffer );
+    ABC_FREE( p );
+    return RetValue;
+}
+
+////////////////////////////////////////////////////////////////////////
+///                       END OF FILE                                ///
+////////////////////////////////////////////////////////////////////////
+
+
+ABC_NAMESPACE_IMPL_END
+
@@ -549,7 +549,7 @@ void Dam_ManCollectSets( Dam_Man_t * p )
     Vec_IntClear( p->vVisit );
     Gia_ManForEachCo( p->pGia, pObj, i )
         Dam_ManCollectSets_rec( p, Gia_ObjFaninId0p(p->pGia, pObj) );
-    ABC_FREE( p->pGia->pRefs );
+    Gia_ManAuxIntFreeP( p->pGia, &p->pGia->pRefs );
     Gia_ManForEachObjVec( p->vVisit, p->pGia, pObj, i )
         pObj->fMark0 = 0;
 }
@@ -136,7 +136,7 @@ Cof_Man_t * Cof_ManCreateLogicSimple( Gia_Man_t * pGia )
     p->vCos = Vec_IntAlloc( Gia_ManCoNum(pGia) );
     p->nObjData = (sizeof(Cof_Obj_t) / 4) * Gia_ManObjNum(pGia) + 4 * Gia_ManAndNum(pGia) + 2 * Gia_ManCoNum(pGia);
     p->pObjData = ABC_CALLOC( int, p->nObjData );
-    ABC_FREE( pGia->pRefs );
+    Gia_ManAuxIntFreeP( pGia, &pGia->pRefs );
     Gia_ManCreateRefs( pGia );
     Gia_ManForEachObj( pGia, pObj, i )
     {
@@ -885,13 +885,13 @@ Vec_Int_t * Gia_ManCofVars( Gia_Man_t * p, int nFanLim )
     Vec_Int_t * vVars;
     Gia_Obj_t * pObj;
     int i;
-    ABC_FREE( p->pRefs );
+    Gia_ManAuxIntFreeP( p, &p->pRefs );
     Gia_ManCreateRefs( p );
     vVars = Vec_IntAlloc( 100 );
     Gia_ManForEachObj( p, pObj, i )
         if ( Gia_ObjIsCand(pObj) && Gia_ObjRefNum(p, pObj) >= nFanLim )
             Vec_IntPush( vVars, i );
-    ABC_FREE( p->pRefs );
+    Gia_ManAuxIntFreeP( p, &p->pRefs );
     return vVars;
 }
 
@@ -358,7 +358,7 @@ Vec_Int_t * Gia_ManFindPivots( Gia_Man_t * p, int SelectShift, int fOnlyCis, int
 */
     // count references
     Gia_ManCreateRefs( p );
-    vCount = Vec_IntAllocArray( p->pRefs, Gia_ManObjNum(p) ); p->pRefs = NULL;
+    vCount = Vec_IntAllocArrayCopy( p->pRefs, Gia_ManObjNum(p) ); Gia_ManAuxIntFreeP( p, &p->pRefs );
 
     // collect nodes 
     vPivots  = Vec_IntAlloc( 100 );
@@ -696,22 +696,22 @@ Gia_Man_t * Gia_ManDup( Gia_Man_t * p )
     pNew->pName = Abc_UtilStrsav( p->pName );
     pNew->pSpec = Abc_UtilStrsav( p->pSpec );
     if ( Gia_ManHasChoices(p) )
-        pNew->pSibls = ABC_CALLOC( int, Gia_ManObjNum(p) );
-    Gia_ManConst0(p)->Value = 0;
+        pNew->pSibls = Gia_ManAuxIntStart( pNew, Gia_ManObjNum(p) );
+    Gia_ManObjSetValue( p, Gia_ManConst0(p), 0 );
     Gia_ManForEachObj1( p, pObj, i )
     {
         if ( Gia_ObjIsBuf(pObj) )
-            pObj->Value = Gia_ManAppendBuf( pNew, Gia_ObjFanin0Copy(pObj) );
+            Gia_ManObjSetValue( p, pObj, Gia_ManAppendBuf( pNew, Gia_ManObjFanin0Copy(p, pObj) ) );
         else if ( Gia_ObjIsAnd(pObj) )
         {
-            pObj->Value = Gia_ManAppendAnd( pNew, Gia_ObjFanin0Copy(pObj), Gia_ObjFanin1Copy(pObj) );
+            Gia_ManObjSetValue( p, pObj, Gia_ManAppendAnd( pNew, Gia_ManObjFanin0Copy(p, pObj), Gia_ManObjFanin1Copy(p, pObj) ) );
             if ( Gia_ObjSibl(p, Gia_ObjId(p, pObj)) )
-                pNew->pSibls[Abc_Lit2Var(pObj->Value)] = Abc_Lit2Var(Gia_ObjSiblObj(p, Gia_ObjId(p, pObj))->Value);  
+                pNew->pSibls[Abc_Lit2Var(Gia_ManObjValue(p, pObj))] = Abc_Lit2Var(Gia_ManObjValue(p, Gia_ObjSiblObj(p, Gia_ObjId(p, pObj))));  
         }
         else if ( Gia_ObjIsCi(pObj) )
-            pObj->Value = Gia_ManAppendCi( pNew );
+            Gia_ManObjSetValue( p, pObj, Gia_ManAppendCi( pNew ) );
         else if ( Gia_ObjIsCo(pObj) )
-            pObj->Value = Gia_ManAppendCo( pNew, Gia_ObjFanin0Copy(pObj) );
+            Gia_ManObjSetValue( p, pObj, Gia_ManAppendCo( pNew, Gia_ManObjFanin0Copy(p, pObj) ) );
     }
     Gia_ManSetRegNum( pNew, Gia_ManRegNum(p) );
     if ( p->pCexSeq )
@@ -1299,7 +1299,7 @@ Gia_Man_t * Gia_ManDupMarked( Gia_Man_t * p )
     if ( Gia_ManHasChoices(p) )
     {
         Gia_Obj_t * pSibl;
-        pNew->pSibls = ABC_CALLOC( int, Gia_ManObjNum(pNew) );
+        pNew->pSibls = Gia_ManAuxIntStart( pNew, Gia_ManObjNum(pNew) );
         Gia_ManForEachObj1( p, pObj, i )
         {
             if ( !~pObj->Value )
@@ -1481,12 +1481,12 @@ Gia_Man_t * Gia_ManDupDfs2( Gia_Man_t * p )
 ***********************************************************************/
 void Gia_ManDupDfs_rec( Gia_Man_t * pNew, Gia_Man_t * p, Gia_Obj_t * pObj )
 {
-    if ( ~pObj->Value )
+    if ( ~Gia_ManObjValue(p, pObj) )
         return;
     assert( Gia_ObjIsAnd(pObj) );
     Gia_ManDupDfs_rec( pNew, p, Gia_ObjFanin0(pObj) );
     Gia_ManDupDfs_rec( pNew, p, Gia_ObjFanin1(pObj) );
-    pObj->Value = Gia_ManAppendAnd( pNew, Gia_ObjFanin0Copy(pObj), Gia_ObjFanin1Copy(pObj) );
+    Gia_ManObjSetValue( p, pObj, Gia_ManAppendAnd( pNew, Gia_ManObjFanin0Copy(p, pObj), Gia_ManObjFanin1Copy(p, pObj) ) );
 }
 Gia_Man_t * Gia_ManDupDfs( Gia_Man_t * p )
 {
@@ -1497,13 +1497,13 @@ Gia_Man_t * Gia_ManDupDfs( Gia_Man_t * p )
     pNew->pName = Abc_UtilStrsav( p->pName );
     pNew->pSpec = Abc_UtilStrsav( p->pSpec );
     Gia_ManFillValue( p );
-    Gia_ManConst0(p)->Value = 0;
+    Gia_ManObjSetValue( p, Gia_ManConst0(p), 0 );
     Gia_ManForEachCi( p, pObj, i )
-        pObj->Value = Gia_ManAppendCi(pNew);
+        Gia_ManObjSetValue( p, pObj, Gia_ManAppendCi(pNew) );
     Gia_ManForEachCo( p, pObj, i )
         Gia_ManDupDfs_rec( pNew, p, Gia_ObjFanin0(pObj) );
     Gia_ManForEachCo( p, pObj, i )
-        pObj->Value = Gia_ManAppendCo( pNew, Gia_ObjFanin0Copy(pObj) );
+        Gia_ManObjSetValue( p, pObj, Gia_ManAppendCo( pNew, Gia_ManObjFanin0Copy(p, pObj) ) );
     Gia_ManSetRegNum( pNew, Gia_ManRegNum(p) );
     pNew->nConstrs = p->nConstrs;
     if ( p->pCexSeq )
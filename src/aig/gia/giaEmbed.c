@@ -266,7 +266,7 @@ Emb_Man_t * Emb_ManStartSimple( Gia_Man_t * pGia )
         assert( pObjLog->nFanouts == pObjLog->iFanout || Gia_ObjIsCo(pObj) );
         pObjLog->iFanin = pObjLog->iFanout = 0;
     }
-    ABC_FREE( pGia->pRefs );
+    Gia_ManAuxIntFreeP( pGia, &pGia->pRefs );
     return p;
 }
 
@@ -406,8 +406,8 @@ void Emb_ManTransformRefs( Gia_Man_t * p, int * pnObjs, int * pnFanios )
     *pnObjs = Counter + Gia_ManCoNum(p);
 
     // reset the references
-    ABC_FREE( p->pRefs );
-    p->pRefs = ABC_CALLOC( int, Gia_ManObjNum(p) );
+    Gia_ManAuxIntFreeP( p, &p->pRefs );
+    p->pRefs = Gia_ManAuxIntStart( p, Gia_ManObjNum(p) );
     // reference from internal nodes
     Counter = 0;
     vSuper = Vec_IntAlloc( 100 );
@@ -604,7 +604,7 @@ Emb_Man_t * Emb_ManStart( Gia_Man_t * pGia )
         assert( pObjLog->nFanouts == pObjLog->iFanout || Gia_ObjIsCo(pObj) );
         pObjLog->iFanin = pObjLog->iFanout = 0;
     }
-    ABC_FREE( pGia->pRefs );
+    Gia_ManAuxIntFreeP( pGia, &pGia->pRefs );
     return p;
 }
 
@@ -192,7 +192,7 @@ void Gia_ManDetectSeqSignals( Gia_Man_t * p, int fSetReset, int fVerbose )
             }
     }
     Vec_IntFree( vSuper );
-    ABC_FREE( p->pRefs );
+    Gia_ManAuxIntFreeP( p, &p->pRefs );
     Gia_ManCreateRefs( p );
     if ( fVerbose )
     {
@@ -204,7 +204,7 @@ void Gia_ManDetectSeqSignals( Gia_Man_t * p, int fSetReset, int fVerbose )
         }
         Gia_ManPrintSignals( p, pEnables, "Enable signals" );
     }
-    ABC_FREE( p->pRefs );
+    Gia_ManAuxIntFreeP( p, &p->pRefs );
     ABC_FREE( pSets );
     ABC_FREE( pResets );
     ABC_FREE( pEnables );
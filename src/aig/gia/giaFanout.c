@@ -246,7 +246,8 @@ void Gia_ManStaticFanoutStart( Gia_Man_t * p )
     // recompute reference counters
     pRefsOld = p->pRefs; p->pRefs = NULL;
     Gia_ManCreateRefs(p);
-    p->vFanoutNums = Vec_IntAllocArray( p->pRefs, Gia_ManObjNum(p) );
+    p->vFanoutNums = Vec_IntAllocArrayCopy( p->pRefs, Gia_ManObjNum(p) );
+    Gia_ManAuxIntFreeP( p, &p->pRefs );
     p->pRefs = pRefsOld;
     // start the fanout maps
     p->vFanout = Gia_ManStartFanoutMap( p, p->vFanoutNums );
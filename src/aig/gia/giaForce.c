@@ -243,7 +243,7 @@ Frc_Man_t * Frc_ManStartSimple( Gia_Man_t * pGia )
         assert( pObjLog->nFanouts == pObjLog->iFanout );
         pObjLog->iFanin = pObjLog->iFanout = 0;
     }
-    ABC_FREE( pGia->pRefs );
+    Gia_ManAuxIntFreeP( pGia, &pGia->pRefs );
     return p;
 }
 
@@ -383,8 +383,8 @@ void Frc_ManTransformRefs( Gia_Man_t * p, int * pnObjs, int * pnFanios )
     *pnObjs = Counter + Gia_ManCoNum(p);
 
     // reset the references
-    ABC_FREE( p->pRefs );
-    p->pRefs = ABC_CALLOC( int, Gia_ManObjNum(p) );
+    Gia_ManAuxIntFreeP( p, &p->pRefs );
+    p->pRefs = Gia_ManAuxIntStart( p, Gia_ManObjNum(p) );
     // reference from internal nodes
     Counter = 0;
     vSuper = Vec_IntAlloc( 100 );
@@ -539,7 +539,7 @@ Frc_Man_t * Frc_ManStart( Gia_Man_t * pGia )
         assert( pObjLog->nFanouts == pObjLog->iFanout );
         pObjLog->iFanin = pObjLog->iFanout = 0;
     }
-    ABC_FREE( pGia->pRefs );
+    Gia_ManAuxIntFreeP( pGia, &pGia->pRefs );
     return p;
 }
 
@@ -20,6 +20,17 @@
 
 #include "gia.h"
 
+#ifdef ABC_USE_PTHREADS
+
+#ifdef _WIN32
+#include "../lib/pthread.h"
+#else
+#include <pthread.h>
+#include <unistd.h>
+#endif
+
+#endif
+
 ABC_NAMESPACE_IMPL_START
 
 
@@ -27,6 +38,26 @@ ABC_NAMESPACE_IMPL_START
 ///                        DECLARATIONS                              ///
 ////////////////////////////////////////////////////////////////////////
 
+#ifdef ABC_USE_PTHREADS
+
+#define PAR_THR_MAX 100
+
+// state of the concurrent hashing mode
+// (the table itself is the usual vHTable/vHash pair; buckets are guarded 
+// by a fixed array of locks and new objects are reserved by atomic increment)
+typedef struct Gia_HashPar_t_ Gia_HashPar_t;
+struct Gia_HashPar_t_
+{
+    int                nLocks;        // the number of bucket locks
+    pthread_mutex_t *  pLocks;        // bucket locks (bucket i is guarded by lock i % nLocks)
+    pthread_mutex_t    MutexObj;      // object allocation (used without atomic builtins)
+    word *             pHits;         // hash table hits per lock
+    word *             pMisses;       // hash table misses per lock
+    volatile int       fOverflow;     // the pre-allocated object array is exhausted
+};
+
+#endif
+
 ////////////////////////////////////////////////////////////////////////
 ///                     FUNCTION DEFINITIONS                         ///
 ////////////////////////////////////////////////////////////////////////
@@ -746,18 +777,18 @@ Gia_Man_t * Gia_ManRehash( Gia_Man_t * p, int fAddStrash )
     pNew->pSpec = Abc_UtilStrsav( p->pSpec );
     pNew->fAddStrash = fAddStrash;
     Gia_ManHashAlloc( pNew );
-    Gia_ManConst0(p)->Value = 0;
+    Gia_ManObjSetValue( p, Gia_ManConst0(p), 0 );
     Gia_ManForEachObj( p, pObj, i )
     {
         //if ( Gia_ObjIsBuf(pObj) )
         //    pObj->Value = Gia_ManAppendBuf( pNew, Gia_ObjFanin0Copy(pObj) );
         //else 
         if ( Gia_ObjIsAnd(pObj) )
-            pObj->Value = Gia_ManHashAnd( pNew, Gia_ObjFanin0Copy(pObj), Gia_ObjFanin1Copy(pObj) );
+            Gia_ManObjSetValue( p, pObj, Gia_ManHashAnd( pNew, Gia_ManObjFanin0Copy(p, pObj), Gia_ManObjFanin1Copy(p, pObj) ) );
         else if ( Gia_ObjIsCi(pObj) )
-            pObj->Value = Gia_ManAppendCi( pNew );
+            Gia_ManObjSetValue( p, pObj, Gia_ManAppendCi( pNew ) );
         else if ( Gia_ObjIsCo(pObj) )
-            pObj->Value = Gia_ManAppendCo( pNew, Gia_ObjFanin0Copy(pObj) );
+            Gia_ManObjSetValue( p, pObj, Gia_ManAppendCo( pNew, Gia_ManObjFanin0Copy(p, pObj) ) );
     }
     Gia_ManHashStop( pNew );
     pNew->fAddStrash = 0;
@@ -769,6 +800,296 @@ Gia_Man_t * Gia_ManRehash( Gia_Man_t * p, int fAddStrash )
 }
 
 
+/**Function*************************************************************
+
+  Synopsis    [Starts concurrent structural hashing.]
+
+  Description [After this call, Gia_ManHashParAnd() can be called from 
+  several threads at the same time. The object array is pre-allocated to 
+  hold nObjsMax objects and never reallocated, which is why the hash table 
+  is sized once for this number of objects. Object IDs are reserved by 
+  an atomic counter, so each new node gets an ID larger than those of its 
+  fanins and the topological order is preserved. Serial construction 
+  (Gia_ManAppendCi, Gia_ManHashAnd, etc) should not be used until 
+  Gia_ManHashParStop() is called.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+#ifdef ABC_USE_PTHREADS
+
+void Gia_ManHashParStart( Gia_Man_t * p, int nObjsMax, int nLocks )
+{
+    Gia_HashPar_t * pPar;
+    Gia_Obj_t * pObj;
+    int i, * pPlace;
+    assert( p->pHashPar == NULL );
+    assert( p->pMuxes == NULL && p->pFanData == NULL && p->vSuppWords == NULL );
+    assert( !p->fAddStrash && !p->fGiaSimple && !p->fSweeper && !p->fBuiltInSim );
+    nObjsMax = Abc_MaxInt( nObjsMax, Gia_ManObjNum(p) + 1 );
+    if ( p->nObjsAlloc < nObjsMax )
+    {
+        p->pObjs = ABC_REALLOC( Gia_Obj_t, p->pObjs, nObjsMax );
+        memset( p->pObjs + p->nObjsAlloc, 0, sizeof(Gia_Obj_t) * (nObjsMax - p->nObjsAlloc) );
+        p->nObjsAlloc = nObjsMax;
+    }
+    // create the table large enough to never be resized
+    if ( Vec_IntSize(&p->vHTable) )
+        Gia_ManHashStop( p );
+    Vec_IntFill( &p->vHTable, Abc_PrimeCudd( p->nObjsAlloc ), 0 );
+    Vec_IntFill( &p->vHash, p->nObjsAlloc, 0 );
+    Gia_ManForEachAnd( p, pObj, i )
+    {
+        pPlace = Vec_IntEntryP( &p->vHTable, Gia_ManHashOne( Gia_ObjFaninLit0(pObj, i), Gia_ObjFaninLit1(pObj, i), -1, Vec_IntSize(&p->vHTable) ) );
+        Vec_IntWriteEntry( &p->vHash, i, *pPlace );
+        *pPlace = i;
+    }
+    // create the locks
+    pPar = ABC_CALLOC( Gia_HashPar_t, 1 );
+    pPar->nLocks  = Abc_MaxInt( nLocks, 1 );
+    pPar->pLocks  = ABC_ALLOC( pthread_mutex_t, pPar->nLocks );
+    pPar->pHits   = ABC_CALLOC( word, pPar->nLocks );
+    pPar->pMisses = ABC_CALLOC( word, pPar->nLocks );
+    for ( i = 0; i < pPar->nLocks; i++ )
+        pthread_mutex_init( pPar->pLocks + i, NULL );
+    pthread_mutex_init( &pPar->MutexObj, NULL );
+    p->pHashPar = pPar;
+}
+void Gia_ManHashParStop( Gia_Man_t * p )
+{
+    Gia_HashPar_t * pPar = (Gia_HashPar_t *)p->pHashPar;
+    int i;
+    assert( pPar != NULL );
+    for ( i = 0; i < pPar->nLocks; i++ )
+    {
+        p->nHashHit  += pPar->pHits[i];
+        p->nHashMiss += pPar->pMisses[i];
+        pthread_mutex_destroy( pPar->pLocks + i );
+    }
+    pthread_mutex_destroy( &pPar->MutexObj );
+    ABC_FREE( pPar->pLocks );
+    ABC_FREE( pPar->pHits );
+    ABC_FREE( pPar->pMisses );
+    ABC_FREE( p->pHashPar );
+    // failed reservations may have advanced the counter past the array
+    p->nObjs = Abc_MinInt( p->nObjs, p->nObjsAlloc );
+    // the table remains valid for serial hashing
+    Vec_IntShrink( &p->vHash, Gia_ManObjNum(p) );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Hashes AND gate in the concurrent mode.]
+
+  Description [The bucket is locked while its chain is searched and, if 
+  the node is not found, while the new node is created and linked, so 
+  two threads asking for the same node always get the same literal.
+  Returns -1 if a new node is needed but the pre-allocated object array 
+  is exhausted; in this case, the caller should stop, call 
+  Gia_ManHashParStop(), and discard the result.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static inline int Gia_ManHashParObjAlloc( Gia_Man_t * p, Gia_HashPar_t * pPar )
+{
+    int iObj;
+    if ( pPar->fOverflow )
+        return -1;
+#if defined(__GNUC__)
+    iObj = __sync_fetch_and_add( &p->nObjs, 1 );
+#else
+    pthread_mutex_lock( &pPar->MutexObj );
+    iObj = p->nObjs < p->nObjsAlloc ? p->nObjs++ : p->nObjsAlloc;
+    pthread_mutex_unlock( &pPar->MutexObj );
+#endif
+    if ( iObj >= p->nObjsAlloc )
+    {
+        pPar->fOverflow = 1;
+        return -1;
+    }
+    return iObj;
+}
+int Gia_ManHashParAnd( Gia_Man_t * p, int iLit0, int iLit1 )
+{
+    Gia_HashPar_t * pPar = (Gia_HashPar_t *)p->pHashPar;
+    Gia_Obj_t * pThis;
+    int iKey, iLock, iThis, * pPlace;
+    if ( iLit0 < 0 || iLit1 < 0 )
+        return -1;
+    if ( iLit0 < 2 )
+        return iLit0 ? iLit1 : 0;
+    if ( iLit1 < 2 )
+        return iLit1 ? iLit0 : 0;
+    if ( iLit0 == iLit1 )
+        return iLit1;
+    if ( iLit0 == Abc_LitNot(iLit1) )
+        return 0;
+    if ( iLit0 > iLit1 )
+        iLit0 ^= iLit1, iLit1 ^= iLit0, iLit0 ^= iLit1;
+    assert( pPar != NULL );
+    iKey  = Gia_ManHashOne( iLit0, iLit1, -1, Vec_IntSize(&p->vHTable) );
+    iLock = iKey % pPar->nLocks;
+    pthread_mutex_lock( pPar->pLocks + iLock );
+    // p->nObjs changes concurrently, so objects are accessed directly
+    pPlace = Vec_IntEntryP( &p->vHTable, iKey );
+    for ( ; (iThis = *pPlace); pPlace = Vec_IntEntryP(&p->vHash, iThis) )
+    {
+        pThis = p->pObjs + iThis;
+        if ( Gia_ObjFaninLit0(pThis, iThis) == iLit0 && Gia_ObjFaninLit1(pThis, iThis) == iLit1 )
+            break;
+    }
+    if ( iThis )
+        pPar->pHits[iLock]++;
+    else
+    {
+        iThis = Gia_ManHashParObjAlloc( p, pPar );
+        if ( iThis == -1 )
+        {
+            pthread_mutex_unlock( pPar->pLocks + iLock );
+            return -1;
+        }
+        pThis = p->pObjs + iThis;
+        pThis->iDiff0  = iThis - Abc_Lit2Var(iLit0);
+        pThis->fCompl0 = Abc_LitIsCompl(iLit0);
+        pThis->iDiff1  = iThis - Abc_Lit2Var(iLit1);
+        pThis->fCompl1 = Abc_LitIsCompl(iLit1);
+        *pPlace = iThis;
+        pPar->pMisses[iLock]++;
+    }
+    pthread_mutex_unlock( pPar->pLocks + iLock );
+    return Abc_Var2Lit( iThis, 0 );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Rehashes AIG using several threads.]
+
+  Description [The COs are divided into contiguous ranges, one per thread, 
+  and each thread builds the cones of its COs in the shared manager. 
+  The copy array is shared: because hashing is canonical, every thread 
+  that copies a node derives the same literal, so a thread reading a 
+  literal written by another thread is always correct, and a thread that 
+  does not yet see it simply looks up the same node again. The node 
+  order in the result depends on thread scheduling. If the object array 
+  pre-allocated for concurrent hashing is exhausted, the partial result 
+  is discarded and the AIG is rehashed serially.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+typedef struct Gia_RehashParThData_t_
+{
+    Gia_Man_t *    pNew;
+    Gia_Man_t *    p;
+    volatile int * pCopies;
+    int            iCoStart;
+    int            iCoStop;
+} Gia_RehashParThData_t;
+static int Gia_ManRehashPar_rec( Gia_Man_t * pNew, Gia_Man_t * p, volatile int * pCopies, int iObj )
+{
+    Gia_Obj_t * pObj = Gia_ManObj( p, iObj );
+    int iLit0, iLit1;
+    if ( pCopies[iObj] >= 0 )
+        return pCopies[iObj];
+    assert( Gia_ObjIsAnd(pObj) );
+    iLit0 = Gia_ManRehashPar_rec( pNew, p, pCopies, Gia_ObjFaninId0(pObj, iObj) );
+    if ( iLit0 == -1 )
+        return -1;
+    iLit1 = Gia_ManRehashPar_rec( pNew, p, pCopies, Gia_ObjFaninId1(pObj, iObj) );
+    if ( iLit1 == -1 )
+        return -1;
+    iLit0 = Abc_LitNotCond( iLit0, Gia_ObjFaninC0(pObj) );
+    iLit1 = Abc_LitNotCond( iLit1, Gia_ObjFaninC1(pObj) );
+    return (pCopies[iObj] = Gia_ManHashParAnd( pNew, iLit0, iLit1 ));
+}
+static void * Gia_ManRehashParThread( void * pArg )
+{
+    Gia_RehashParThData_t * pThData = (Gia_RehashParThData_t *)pArg;
+    Gia_Obj_t * pObj; int i;
+    for ( i = pThData->iCoStart; i < pThData->iCoStop; i++ )
+    {
+        pObj = Gia_ManCo( pThData->p, i );
+        if ( Gia_ManRehashPar_rec( pThData->pNew, pThData->p, pThData->pCopies, Gia_ObjFaninId0p(pThData->p, pObj) ) == -1 )
+            break;
+    }
+    return NULL;
+}
+Gia_Man_t * Gia_ManRehashPar( Gia_Man_t * p, int nThreads, int fVerbose )
+{
+    pthread_t WorkerThread[PAR_THR_MAX];
+    Gia_RehashParThData_t ThData[PAR_THR_MAX];
+    Gia_Man_t * pNew;
+    Gia_Obj_t * pObj;
+    volatile int * pCopies;
+    int i, status, nCoChunk, fOverflow;
+    abctime clk = Abc_Clock();
+    nThreads = Abc_MaxInt( 1, Abc_MinInt(nThreads, PAR_THR_MAX) );
+    if ( p->pMuxes )
+        return Gia_ManRehash( p, 0 );
+    pNew = Gia_ManStart( Gia_ManObjNum(p) );
+    pNew->pName = Abc_UtilStrsav( p->pName );
+    pNew->pSpec = Abc_UtilStrsav( p->pSpec );
+    pCopies = ABC_FALLOC( int, Gia_ManObjNum(p) );
+    pCopies[0] = 0;
+    Gia_ManForEachCi( p, pObj, i )
+        pCopies[Gia_ObjId(p, pObj)] = Gia_ManAppendCi( pNew );
+    Gia_ManHashParStart( pNew, Gia_ManObjNum(p), 1 << 12 );
+    // build the cones of CO ranges concurrently
+    nCoChunk = (Gia_ManCoNum(p) + nThreads - 1) / nThreads;
+    for ( i = 0; i < nThreads; i++ )
+    {
+        ThData[i].pNew     = pNew;
+        ThData[i].p        = p;
+        ThData[i].pCopies  = pCopies;
+        ThData[i].iCoStart = Abc_MinInt( i * nCoChunk, Gia_ManCoNum(p) );
+        ThData[i].iCoStop  = Abc_MinInt( (i + 1) * nCoChunk, Gia_ManCoNum(p) );
+        status = pthread_create( WorkerThread + i, NULL, Gia_ManRehashParThread, (void *)(ThData + i) );  assert( status == 0 );
+    }
+    for ( i = 0; i < nThreads; i++ )
+    {
+        status = pthread_join( WorkerThread[i], NULL );  assert( status == 0 );
+    }
+    fOverflow = ((Gia_HashPar_t *)pNew->pHashPar)->fOverflow;
+    Gia_ManHashParStop( pNew );
+    if ( fOverflow )
+    {
+        if ( fVerbose )
+            printf( "Concurrent hashing exceeded the pre-allocated %d objects. Rehashing serially.\n", pNew->nObjsAlloc );
+        Gia_ManStop( pNew );
+        ABC_FREE( pCopies );
+        return Gia_ManRehash( p, 0 );
+    }
+    Gia_ManForEachCo( p, pObj, i )
+        Gia_ManAppendCo( pNew, Abc_LitNotCond(pCopies[Gia_ObjFaninId0p(p, pObj)], Gia_ObjFaninC0(pObj)) );
+    Gia_ManHashStop( pNew );
+    Gia_ManSetRegNum( pNew, Gia_ManRegNum(p) );
+    ABC_FREE( pCopies );
+    if ( fVerbose )
+    {
+        printf( "Rehashed %d nodes into %d nodes using %d threads.  ", Gia_ManAndNum(p), Gia_ManAndNum(pNew), nThreads );
+        printf( "Hits = %.0f. Misses = %.0f.  ", (double)pNew->nHashHit, (double)pNew->nHashMiss );
+        Abc_PrintTime( 1, "Time", Abc_Clock() - clk );
+    }
+    return pNew;
+}
+
+#else
+
+void Gia_ManHashParStart( Gia_Man_t * p, int nObjsMax, int nLocks ) { if ( !Vec_IntSize(&p->vHTable) ) Gia_ManHashAlloc( p ); }
+void Gia_ManHashParStop( Gia_Man_t * p )                            {}
+int Gia_ManHashParAnd( Gia_Man_t * p, int iLit0, int iLit1 )        { return Gia_ManHashAnd( p, iLit0, iLit1 ); }
+Gia_Man_t * Gia_ManRehashPar( Gia_Man_t * p, int nThreads, int fVerbose ) { return Gia_ManRehash( p, 0 ); }
+
+#endif // pthreads are used
+
+
 /**Function*************************************************************
 
   Synopsis    [Creates well-balanced AND gate.]
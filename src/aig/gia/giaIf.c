@@ -67,6 +67,7 @@ void Gia_ManSetIfParsDefault( void * pp )
     p->nCutsMax    =  8;
     p->nFlowIters  =  1;
     p->nAreaIters  =  2;
+    p->nThreads    =  1;
     p->DelayTarget = -1;
     p->Epsilon     =  (float)0.005;
     p->fPreprocess =  1;
@@ -252,8 +253,8 @@ void Gia_ManSetRefsMapped( Gia_Man_t * p )
 {
     Gia_Obj_t * pObj;
     int i, k, iFan;
-    ABC_FREE( p->pRefs );
-    p->pRefs = ABC_CALLOC( int, Gia_ManObjNum(p) );
+    Gia_ManAuxIntFreeP( p, &p->pRefs );
+    p->pRefs = Gia_ManAuxIntStart( p, Gia_ManObjNum(p) );
     Gia_ManForEachCo( p, pObj, i )
         Gia_ObjRefIncId( p, Gia_ObjFaninId0p(p, pObj) );
     Gia_ManForEachLut( p, i )
@@ -276,8 +277,8 @@ void Gia_ManSetLutRefs( Gia_Man_t * p )
 {
     Gia_Obj_t * pObj;
     int i, k, iFan;
-    ABC_FREE( p->pLutRefs );
-    p->pLutRefs = ABC_CALLOC( int, Gia_ManObjNum(p) );
+    Gia_ManAuxIntFreeP( p, &p->pLutRefs );
+    p->pLutRefs = Gia_ManAuxIntStart( p, Gia_ManObjNum(p) );
     Gia_ManForEachCo( p, pObj, i )
         Gia_ObjLutRefIncId( p, Gia_ObjFaninId0p(p, pObj) );
     Gia_ManForEachLut( p, i )
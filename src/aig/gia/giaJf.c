@@ -248,7 +248,7 @@ float * Jf_ManInitRefs( Jf_Man_t * pMan )
     Gia_Obj_t * pObj, * pCtrl, * pData0, * pData1;
     float * pRes; int i;
     assert( p->pRefs == NULL );
-    p->pRefs = ABC_CALLOC( int, Gia_ManObjNum(p) );
+    p->pRefs = Gia_ManAuxIntStart( p, Gia_ManObjNum(p) );
     Gia_ManForEachAnd( p, pObj, i )
     {
         Gia_ObjRefFanin0Inc( p, pObj );
@@ -406,7 +406,7 @@ void Jf_ManFree( Jf_Man_t * p )
         Jf_ManProfileClasses( p );
     if ( p->pPars->fCoarsen )
         Gia_ManCleanMark0( p->pGia );
-    ABC_FREE( p->pGia->pRefs );
+    Gia_ManAuxIntFreeP( p->pGia, &p->pGia->pRefs );
     ABC_FREE( p->vCuts.pArray );
     ABC_FREE( p->vArr.pArray );
     ABC_FREE( p->vDep.pArray );
@@ -1238,7 +1238,7 @@ Kf_Man_t * Kf_ManAlloc( Gia_Man_t * pGia, Jf_Par_t * pPars )
     Vec_FltFill( &p->vArea, Gia_ManObjNum(pGia), 0 );
     Kf_ManSetInitRefs( pGia, &p->vRefs );
     p->vTemp     = Vec_IntAlloc( 1000 );
-    pGia->pRefs  = ABC_CALLOC( int, Gia_ManObjNum(pGia) );
+    pGia->pRefs  = Gia_ManAuxIntStart( pGia, Gia_ManObjNum(pGia) );
     // prepare cut sets
     for ( i = 0; i < Abc_MaxInt(1, pPars->nProcNum); i++ )
     {
@@ -1251,7 +1251,7 @@ Kf_Man_t * Kf_ManAlloc( Gia_Man_t * pGia, Jf_Par_t * pPars )
 }
 void Kf_ManFree( Kf_Man_t * p )
 {
-    ABC_FREE( p->pGia->pRefs );
+    Gia_ManAuxIntFreeP( p->pGia, &p->pGia->pRefs );
     ABC_FREE( p->vCuts.pArray );
     ABC_FREE( p->vTime.pArray );
     ABC_FREE( p->vArea.pArray );
@@ -0,0 +1,745 @@
+/**CFile****************************************************************
+
+  FileName    [giaLevel.c]
+
+  SystemName  [ABC: Logic synthesis and verification system.]
+
+  PackageName [Scalable AIG package.]
+
+  Synopsis    [Incremental maintenance of levels and required levels.]
+
+  Author      [Alan Mishchenko]
+
+  Affiliation [UC Berkeley]
+
+  Date        [Ver. 1.0. Started - June 20, 2005.]
+
+  Revision    [$Id: giaLevel.c,v 1.00 2005/06/20 00:00:00 alanmi Exp $]
+
+***********************************************************************/
+
+#include "gia.h"
+
+ABC_NAMESPACE_IMPL_START
+
+
+////////////////////////////////////////////////////////////////////////
+///                        DECLARATIONS                              ///
+////////////////////////////////////////////////////////////////////////
+
+// The objects of a GIA manager cannot be modified in place, so the engine
+// keeps its own copy of the fanins and the fanouts of every object. When
+// a node is replaced by a literal, its fanouts are redirected to the literal,
+// its MFFC is dereferenced, and only the levels in the TFO of the fanouts and
+// the reverse levels in the TFI of the changed nodes are updated, using the
+// queue of objects bucketed by their old levels. The forward levels are stored
+// in the manager (p->vLevels), so that Gia_ObjLevel() can be used as usual.
+//
+// At present, the only user of this engine is the command &levtest, which
+// checks the incremental levels against recomputation from scratch after
+// random replacements. The balancing, mapping, and resubstitution passes
+// still compute levels in their own way; switching them to this engine
+// requires changing how they modify the AIG and is not done here.
+
+struct Gia_Lev_t_
+{
+    Gia_Man_t *    pGia;         // the AIG manager
+    Vec_Int_t *    vFanins;      // the current fanin literals (two entries per object)
+    Vec_Wec_t *    vFanouts;     // the current fanouts (one entry per fanin edge)
+    Vec_Int_t *    vLevelR;      // the reverse levels
+    Vec_Int_t *    vRepl;        // the replacement literals (-1 for live objects; -2 for deleted ones)
+    Vec_Int_t *    vCoLevels;    // the number of COs on each level
+    Vec_Wec_t *    vBuckets;     // the objects to be updated, bucketed by their old levels
+    Vec_Int_t *    vStamps;      // the last pass when the object was queued
+    Vec_Int_t *    vTemp;        // temporary storage
+    int            nStamp;       // the current pass
+    int            nLevelMax;    // the largest CO level
+    int            nLevelReq;    // the required level (0 if the largest CO level is used)
+    // statistics
+    int            nReplaced;    // the number of replaced nodes
+    int            nDeleted;     // the number of deleted nodes
+    int            nAppended;    // the number of appended nodes
+    int            nVisits;      // the number of objects whose levels were recomputed
+};
+
+static inline int   Gia_LevFanin( Gia_Lev_t * p, int i, int n )     { return Vec_IntEntry(p->vFanins, 2*i+n);           }
+static inline int   Gia_LevIsDeleted( Gia_Lev_t * p, int i )        { return Vec_IntEntry(p->vRepl, i) != -1;           }
+static inline int   Gia_LevIsCo( Gia_Lev_t * p, int i )             { return Gia_ObjIsCo(Gia_ManObj(p->pGia, i));       }
+static inline int   Gia_LevIsAnd( Gia_Lev_t * p, int i )            { return Gia_ObjIsAnd(Gia_ManObj(p->pGia, i));      }
+
+////////////////////////////////////////////////////////////////////////
+///                     FUNCTION DEFINITIONS                         ///
+////////////////////////////////////////////////////////////////////////
+
+/**Function*************************************************************
+
+  Synopsis    [Starts the incremental level manager.]
+
+  Description [The levels of the CIs are preserved if they are already
+  assigned (see Gia_ManSetLevels). The AIG should not contain MUXes,
+  XORs, buffers, or choices.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Gia_Lev_t * Gia_LevStart( Gia_Man_t * pGia )
+{
+    Gia_Lev_t * p;
+    Gia_Obj_t * pObj;
+    Vec_Int_t * vCiLevels;
+    int i, Level;
+    assert( pGia->pMuxes == NULL );
+    assert( pGia->pSibls == NULL );
+    assert( Gia_ManBufNum(pGia) == 0 );
+    vCiLevels = Gia_ManGetCiLevels( pGia );
+    Gia_ManSetLevels( pGia, vCiLevels );
+    Vec_IntFreeP( &vCiLevels );
+    p = ABC_CALLOC( Gia_Lev_t, 1 );
+    p->pGia      = pGia;
+    p->vFanins   = Vec_IntStartFull( 2 * Gia_ManObjNum(pGia) );
+    p->vFanouts  = Vec_WecStart( Gia_ManObjNum(pGia) );
+    p->vLevelR   = Gia_ManReverseLevel( pGia );
+    p->vRepl     = Vec_IntStartFull( Gia_ManObjNum(pGia) );
+    p->vCoLevels = Vec_IntStart( pGia->nLevels + 1 );
+    p->vBuckets  = Vec_WecStart( pGia->nLevels + 1 );
+    p->vStamps   = Vec_IntStart( Gia_ManObjNum(pGia) );
+    p->vTemp     = Vec_IntAlloc( 100 );
+    p->nStamp    = 1;
+    Gia_ManForEachObj1( pGia, pObj, i )
+    {
+        if ( Gia_ObjIsAnd(pObj) )
+        {
+            Vec_IntWriteEntry( p->vFanins, 2*i+0, Gia_ObjFaninLit0(pObj, i) );
+            Vec_IntWriteEntry( p->vFanins, 2*i+1, Gia_ObjFaninLit1(pObj, i) );
+            Vec_WecPush( p->vFanouts, Gia_ObjFaninId0(pObj, i), i );
+            Vec_WecPush( p->vFanouts, Gia_ObjFaninId1(pObj, i), i );
+        }
+        else if ( Gia_ObjIsCo(pObj) )
+        {
+            Vec_IntWriteEntry( p->vFanins, 2*i+0, Gia_ObjFaninLit0(pObj, i) );
+            Vec_WecPush( p->vFanouts, Gia_ObjFaninId0(pObj, i), i );
+            Level = Gia_ObjLevelId( pGia, i );
+            Vec_IntAddToEntry( p->vCoLevels, Level, 1 );
+            p->nLevelMax = Abc_MaxInt( p->nLevelMax, Level );
+        }
+    }
+    return p;
+}
+void Gia_LevStop( Gia_Lev_t * p )
+{
+    Vec_IntFree( p->vFanins );
+    Vec_WecFree( p->vFanouts );
+    Vec_IntFree( p->vLevelR );
+    Vec_IntFree( p->vRepl );
+    Vec_IntFree( p->vCoLevels );
+    Vec_WecFree( p->vBuckets );
+    Vec_IntFree( p->vStamps );
+    Vec_IntFree( p->vTemp );
+    ABC_FREE( p );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Returns the timing information of the object.]
+
+  Description [The required level is the user-given required level or,
+  if it is not given, the largest CO level. The slack of the node is
+  the difference between its required level and its level.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Gia_LevLevel( Gia_Lev_t * p, int iObj )
+{
+    return Gia_ObjLevelId( p->pGia, iObj );
+}
+int Gia_LevLevelR( Gia_Lev_t * p, int iObj )
+{
+    return Vec_IntEntry( p->vLevelR, iObj );
+}
+int Gia_LevLevelMax( Gia_Lev_t * p )
+{
+    return p->nLevelMax;
+}
+int Gia_LevRequired( Gia_Lev_t * p, int iObj )
+{
+    int LevelReq = p->nLevelReq ? p->nLevelReq : p->nLevelMax;
+    return LevelReq - Vec_IntEntry( p->vLevelR, iObj );
+}
+int Gia_LevSlack( Gia_Lev_t * p, int iObj )
+{
+    return Gia_LevRequired( p, iObj ) - Gia_ObjLevelId( p->pGia, iObj );
+}
+void Gia_LevSetRequired( Gia_Lev_t * p, int LevelReq )
+{
+    p->nLevelReq = LevelReq;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Returns the current literal of the given literal.]
+
+  Description [Follows the chain of replacements.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Gia_LevLit( Gia_Lev_t * p, int iLit )
+{
+    int iRepl;
+    while ( (iRepl = Vec_IntEntry(p->vRepl, Abc_Lit2Var(iLit))) >= 0 )
+        iLit = Abc_LitNotCond( iRepl, Abc_LitIsCompl(iLit) );
+    assert( iRepl == -1 );
+    return iLit;
+}
+int Gia_LevFaninLit( Gia_Lev_t * p, int iObj, int n )
+{
+    return Gia_LevFanin( p, iObj, n );
+}
+int Gia_LevFanoutNum( Gia_Lev_t * p, int iObj )
+{
+    return Vec_IntSize( Vec_WecEntry(p->vFanouts, iObj) );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Recomputes the level or the reverse level of one object.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static inline int Gia_LevObjLevel( Gia_Lev_t * p, int iObj )
+{
+    int Level0 = Gia_ObjLevelId( p->pGia, Abc_Lit2Var(Gia_LevFanin(p, iObj, 0)) );
+    if ( Gia_LevIsCo(p, iObj) )
+        return Level0;
+    return 1 + Abc_MaxInt( Level0, Gia_ObjLevelId(p->pGia, Abc_Lit2Var(Gia_LevFanin(p, iObj, 1))) );
+}
+static inline int Gia_LevObjLevelR( Gia_Lev_t * p, int iObj )
+{
+    int i, iFanout, LevelR = 0;
+    Vec_IntForEachEntry( Vec_WecEntry(p->vFanouts, iObj), iFanout, i )
+        if ( !Gia_LevIsCo(p, iFanout) )
+            LevelR = Abc_MaxInt( LevelR, Vec_IntEntry(p->vLevelR, iFanout) + 1 );
+    return LevelR;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Updates the CO level histogram.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static inline void Gia_LevUpdateCo( Gia_Lev_t * p, int LevelOld, int LevelNew )
+{
+    Vec_IntAddToEntry( p->vCoLevels, LevelOld, -1 );
+    Vec_IntFillExtra( p->vCoLevels, LevelNew + 1, 0 );
+    Vec_IntAddToEntry( p->vCoLevels, LevelNew, 1 );
+    if ( LevelNew > p->nLevelMax )
+        p->nLevelMax = LevelNew;
+    else
+        while ( p->nLevelMax > 0 && Vec_IntEntry(p->vCoLevels, p->nLevelMax) == 0 )
+            p->nLevelMax--;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Adds the object to the queue.]
+
+  Description [Each object is added at most once during one pass.
+  The passes are numbered starting from 1, so that the objects with 
+  the zero stamps are never considered as queued.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static inline void Gia_LevQueue( Gia_Lev_t * p, int iObj, int Level )
+{
+    if ( Vec_IntEntry(p->vStamps, iObj) == p->nStamp )
+        return;
+    Vec_IntWriteEntry( p->vStamps, iObj, p->nStamp );
+    Vec_WecPush( p->vBuckets, Level, iObj );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Propagates the level changes through the TFO.]
+
+  Description [The queued objects are bucketed by their old levels.
+  Because the old levels are consistent, each object is processed after
+  all of its queued fanins, and the fanouts of the changed objects are
+  always queued in the buckets above the current one.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static void Gia_LevPropagateLevels( Gia_Lev_t * p )
+{
+    int l, k, f, iObj, iFanout, LevelOld, LevelNew;
+    for ( l = 0; l < Vec_WecSize(p->vBuckets); l++ )
+    {
+        // the bucket array may be reallocated when the fanouts are queued
+        for ( k = 0; k < Vec_IntSize(Vec_WecEntry(p->vBuckets, l)); k++ )
+        {
+            iObj = Vec_IntEntry( Vec_WecEntry(p->vBuckets, l), k );
+            if ( Gia_LevIsDeleted(p, iObj) )
+                continue;
+            p->nVisits++;
+            LevelOld = Gia_ObjLevelId( p->pGia, iObj );
+            LevelNew = Gia_LevObjLevel( p, iObj );
+            if ( LevelOld == LevelNew )
+                continue;
+            Gia_ObjSetLevelId( p->pGia, iObj, LevelNew );
+            if ( Gia_LevIsCo(p, iObj) )
+            {
+                Gia_LevUpdateCo( p, LevelOld, LevelNew );
+                continue;
+            }
+            Vec_IntForEachEntry( Vec_WecEntry(p->vFanouts, iObj), iFanout, f )
+                Gia_LevQueue( p, iFanout, Gia_ObjLevelId(p->pGia, iFanout) );
+        }
+        Vec_IntClear( Vec_WecEntry(p->vBuckets, l) );
+    }
+    p->nStamp++;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Propagates the reverse level changes through the TFI.]
+
+  Description [Same as above, using the old reverse levels as the keys.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static void Gia_LevPropagateLevelsR( Gia_Lev_t * p )
+{
+    int l, k, n, iObj, iFanin, LevelOld, LevelNew;
+    for ( l = 0; l < Vec_WecSize(p->vBuckets); l++ )
+    {
+        for ( k = 0; k < Vec_IntSize(Vec_WecEntry(p->vBuckets, l)); k++ )
+        {
+            iObj = Vec_IntEntry( Vec_WecEntry(p->vBuckets, l), k );
+            if ( Gia_LevIsDeleted(p, iObj) )
+                continue;
+            p->nVisits++;
+            LevelOld = Vec_IntEntry( p->vLevelR, iObj );
+            LevelNew = Gia_LevObjLevelR( p, iObj );
+            if ( LevelOld == LevelNew )
+                continue;
+            Vec_IntWriteEntry( p->vLevelR, iObj, LevelNew );
+            if ( !Gia_LevIsAnd(p, iObj) )
+                continue;
+            for ( n = 0; n < 2; n++ )
+            {
+                iFanin = Abc_Lit2Var( Gia_LevFanin(p, iObj, n) );
+                Gia_LevQueue( p, iFanin, Vec_IntEntry(p->vLevelR, iFanin) );
+            }
+        }
+        Vec_IntClear( Vec_WecEntry(p->vBuckets, l) );
+    }
+    p->nStamp++;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Deletes the node with no fanouts and its MFFC.]
+
+  Description [Collects the surviving fanins, which lost a fanout.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static void Gia_LevDelete_rec( Gia_Lev_t * p, int iObj, Vec_Int_t * vLost )
+{
+    int n, iFanin;
+    assert( Gia_LevIsAnd(p, iObj) );
+    assert( Gia_LevFanoutNum(p, iObj) == 0 );
+    if ( Vec_IntEntry(p->vRepl, iObj) == -1 )
+        Vec_IntWriteEntry( p->vRepl, iObj, -2 );
+    p->nDeleted++;
+    for ( n = 0; n < 2; n++ )
+    {
+        iFanin = Abc_Lit2Var( Gia_LevFanin(p, iObj, n) );
+        Vec_IntRemove( Vec_WecEntry(p->vFanouts, iFanin), iObj );
+        if ( Gia_LevIsAnd(p, iFanin) && Gia_LevFanoutNum(p, iFanin) == 0 )
+            Gia_LevDelete_rec( p, iFanin, vLost );
+        else
+            Vec_IntPush( vLost, iFanin );
+    }
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Adds the nodes recently created in the AIG manager.]
+
+  Description [The fanins of the nodes are taken from the manager and
+  mapped through the replacements. The new nodes are only used by other
+  new nodes until one of them replaces an old node. The unused new nodes
+  should be removed using Gia_LevDelete() to keep the reverse levels of
+  their fanins exact.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Gia_LevAppend( Gia_Lev_t * p )
+{
+    Gia_Obj_t * pObj;
+    int i, n, iFanin, iLits[2], iFirst = Vec_IntSize(p->vRepl);
+    for ( i = iFirst; i < Gia_ManObjNum(p->pGia); i++ )
+    {
+        pObj = Gia_ManObj( p->pGia, i );
+        assert( Gia_ObjIsAnd(pObj) && !Gia_ObjIsBuf(pObj) );
+        iLits[0] = Gia_LevLit( p, Gia_ObjFaninLit0(pObj, i) );
+        iLits[1] = Gia_LevLit( p, Gia_ObjFaninLit1(pObj, i) );
+        Vec_IntPush( p->vFanins, iLits[0] );
+        Vec_IntPush( p->vFanins, iLits[1] );
+        Vec_WecPushLevel( p->vFanouts );
+        Vec_IntPush( p->vLevelR, 0 );
+        Vec_IntPush( p->vRepl, -1 );
+        Vec_IntPush( p->vStamps, 0 );
+        Vec_WecPush( p->vFanouts, Abc_Lit2Var(iLits[0]), i );
+        Vec_WecPush( p->vFanouts, Abc_Lit2Var(iLits[1]), i );
+        Gia_ObjSetLevelId( p->pGia, i, Gia_LevObjLevel(p, i) );
+        p->nAppended++;
+    }
+    // the new nodes are in a topological order and only fan out to each other
+    for ( i = Gia_ManObjNum(p->pGia) - 1; i >= iFirst; i-- )
+        Vec_IntWriteEntry( p->vLevelR, i, Gia_LevObjLevelR(p, i) );
+    // the old fanins are updated incrementally
+    for ( i = iFirst; i < Gia_ManObjNum(p->pGia); i++ )
+        for ( n = 0; n < 2; n++ )
+            if ( (iFanin = Abc_Lit2Var(Gia_LevFanin(p, i, n))) < iFirst )
+                Gia_LevQueue( p, iFanin, Vec_IntEntry(p->vLevelR, iFanin) );
+    Gia_LevPropagateLevelsR( p );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Deletes the node without fanouts and its MFFC.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Gia_LevDelete( Gia_Lev_t * p, int iObj )
+{
+    int i, iFanin;
+    assert( Gia_LevIsAnd(p, iObj) && !Gia_LevIsDeleted(p, iObj) );
+    assert( Gia_LevFanoutNum(p, iObj) == 0 );
+    Vec_IntClear( p->vTemp );
+    Gia_LevDelete_rec( p, iObj, p->vTemp );
+    Vec_IntForEachEntry( p->vTemp, iFanin, i )
+        if ( !Gia_LevIsDeleted(p, iFanin) )
+            Gia_LevQueue( p, iFanin, Vec_IntEntry(p->vLevelR, iFanin) );
+    Gia_LevPropagateLevelsR( p );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Replaces the node by the literal.]
+
+  Description [The fanouts of the node are redirected to the literal and
+  the MFFC of the node is deleted. The fanout using the node as both
+  fanins is listed twice and has both fanins redirected. The literal should not depend on
+  the node, and the node should have fanouts. Updates the levels in the
+  TFO of the fanouts and the reverse levels in the TFI of the literal
+  and of the deleted MFFC.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Gia_LevReplace( Gia_Lev_t * p, int iObj, int iLitNew )
+{
+    Vec_Int_t * vFanouts;
+    int i, n, iFanout, iLit, iObjNew;
+    assert( Gia_LevIsAnd(p, iObj) && !Gia_LevIsDeleted(p, iObj) );
+    assert( Gia_LevFanoutNum(p, iObj) > 0 );
+    iLitNew = Gia_LevLit( p, iLitNew );
+    iObjNew = Abc_Lit2Var( iLitNew );
+    assert( iObjNew != iObj );
+    // redirect the fanouts
+    vFanouts = Vec_WecEntry( p->vFanouts, iObj );
+    Vec_IntClear( p->vTemp );
+    Vec_IntAppend( p->vTemp, vFanouts );
+    Vec_IntClear( vFanouts );
+    Vec_IntUniqify( p->vTemp );
+    Vec_IntForEachEntry( p->vTemp, iFanout, i )
+    {
+        for ( n = 0; n < 2 - Gia_LevIsCo(p, iFanout); n++ )
+        {
+            iLit = Gia_LevFanin( p, iFanout, n );
+            if ( Abc_Lit2Var(iLit) != iObj )
+                continue;
+            Vec_IntWriteEntry( p->vFanins, 2*iFanout+n, Abc_LitNotCond(iLitNew, Abc_LitIsCompl(iLit)) );
+            Vec_WecPush( p->vFanouts, iObjNew, iFanout );
+        }
+        Gia_LevQueue( p, iFanout, Gia_ObjLevelId(p->pGia, iFanout) );
+    }
+    Vec_IntWriteEntry( p->vRepl, iObj, iLitNew );
+    p->nReplaced++;
+    // update the levels in the TFO
+    Gia_LevPropagateLevels( p );
+    // delete the MFFC and update the reverse levels in the TFI
+    Vec_IntClear( p->vTemp );
+    Gia_LevDelete_rec( p, iObj, p->vTemp );
+    Vec_IntPush( p->vTemp, iObjNew );
+    Vec_IntForEachEntry( p->vTemp, iLit, i )
+        if ( !Gia_LevIsDeleted(p, iLit) )
+            Gia_LevQueue( p, iLit, Vec_IntEntry(p->vLevelR, iLit) );
+    Gia_LevPropagateLevelsR( p );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Compares the levels with those computed from scratch.]
+
+  Description [Returns the number of mismatches.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static void Gia_LevCollect_rec( Gia_Lev_t * p, int iObj, Vec_Int_t * vOrder, Vec_Int_t * vVisited )
+{
+    int n;
+    if ( Vec_IntEntry(vVisited, iObj) )
+        return;
+    Vec_IntWriteEntry( vVisited, iObj, 1 );
+    if ( Gia_LevIsAnd(p, iObj) || Gia_LevIsCo(p, iObj) )
+        for ( n = 0; n < 2 - Gia_LevIsCo(p, iObj); n++ )
+            Gia_LevCollect_rec( p, Abc_Lit2Var(Gia_LevFanin(p, iObj, n)), vOrder, vVisited );
+    Vec_IntPush( vOrder, iObj );
+}
+int Gia_LevVerify( Gia_Lev_t * p )
+{
+    Vec_Int_t * vOrder   = Vec_IntAlloc( Vec_IntSize(p->vRepl) );
+    Vec_Int_t * vVisited = Vec_IntStart( Vec_IntSize(p->vRepl) );
+    Vec_Int_t * vLevel   = Vec_IntStart( Vec_IntSize(p->vRepl) );
+    Vec_Int_t * vLevelR  = Vec_IntStart( Vec_IntSize(p->vRepl) );
+    int i, n, iObj, iFanin, LevelMax = 0, nErrors = 0;
+    // order the live objects topologically
+    for ( iObj = 0; iObj < Vec_IntSize(p->vRepl); iObj++ )
+        if ( !Gia_LevIsDeleted(p, iObj) )
+            Gia_LevCollect_rec( p, iObj, vOrder, vVisited );
+    Vec_IntForEachEntry( vOrder, iObj, i )
+    {
+        if ( Gia_LevIsAnd(p, iObj) || Gia_LevIsCo(p, iObj) )
+        {
+            for ( n = 0; n < 2 - Gia_LevIsCo(p, iObj); n++ )
+            {
+                iFanin = Abc_Lit2Var( Gia_LevFanin(p, iObj, n) );
+                if ( Gia_LevIsDeleted(p, iFanin) )
+                    printf( "Object %d has deleted fanin %d.\n", iObj, iFanin ), nErrors++;
+                Vec_IntUpdateEntry( vLevel, iObj, Vec_IntEntry(vLevel, iFanin) + Gia_LevIsAnd(p, iObj) );
+            }
+        }
+        else
+            Vec_IntWriteEntry( vLevel, iObj, Gia_ObjLevelId(p->pGia, iObj) );
+        if ( Gia_LevIsCo(p, iObj) )
+            LevelMax = Abc_MaxInt( LevelMax, Vec_IntEntry(vLevel, iObj) );
+    }
+    Vec_IntForEachEntryReverse( vOrder, iObj, i )
+    {
+        if ( !Gia_LevIsAnd(p, iObj) )
+            continue;
+        for ( n = 0; n < 2; n++ )
+            Vec_IntUpdateEntry( vLevelR, Abc_Lit2Var(Gia_LevFanin(p, iObj, n)), Vec_IntEntry(vLevelR, iObj) + 1 );
+    }
+    // compare
+    Vec_IntForEachEntry( vOrder, iObj, i )
+    {
+        if ( Vec_IntEntry(vLevel, iObj) != Gia_ObjLevelId(p->pGia, iObj) )
+            printf( "Object %d has level %d instead of %d.\n", iObj, Gia_ObjLevelId(p->pGia, iObj), Vec_IntEntry(vLevel, iObj) ), nErrors++;
+        if ( Vec_IntEntry(vLevelR, iObj) != Vec_IntEntry(p->vLevelR, iObj) )
+            printf( "Object %d has reverse level %d instead of %d.\n", iObj, Vec_IntEntry(p->vLevelR, iObj), Vec_IntEntry(vLevelR, iObj) ), nErrors++;
+    }
+    if ( LevelMax != p->nLevelMax )
+        printf( "The largest CO level is %d instead of %d.\n", p->nLevelMax, LevelMax ), nErrors++;
+    Vec_IntFree( vOrder );
+    Vec_IntFree( vVisited );
+    Vec_IntFree( vLevel );
+    Vec_IntFree( vLevelR );
+    return nErrors;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Derives the AIG reflecting the replacements.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static int Gia_LevDerive_rec( Gia_Man_t * pNew, Gia_Lev_t * p, int iObj )
+{
+    Gia_Obj_t * pObj = Gia_ManObj( p->pGia, iObj );
+    int iLit0, iLit1;
+    if ( ~pObj->Value )
+        return pObj->Value;
+    assert( Gia_ObjIsAnd(pObj) && !Gia_LevIsDeleted(p, iObj) );
+    iLit0 = Gia_LevFanin( p, iObj, 0 );
+    iLit1 = Gia_LevFanin( p, iObj, 1 );
+    iLit0 = Abc_LitNotCond( Gia_LevDerive_rec(pNew, p, Abc_Lit2Var(iLit0)), Abc_LitIsCompl(iLit0) );
+    iLit1 = Abc_LitNotCond( Gia_LevDerive_rec(pNew, p, Abc_Lit2Var(iLit1)), Abc_LitIsCompl(iLit1) );
+    return pObj->Value = Gia_ManHashAnd( pNew, iLit0, iLit1 );
+}
+Gia_Man_t * Gia_LevDeriveAig( Gia_Lev_t * p )
+{
+    Gia_Man_t * pNew;
+    Gia_Obj_t * pObj;
+    int i, iLit;
+    pNew = Gia_ManStart( Gia_ManObjNum(p->pGia) );
+    pNew->pName = Abc_UtilStrsav( p->pGia->pName );
+    pNew->pSpec = Abc_UtilStrsav( p->pGia->pSpec );
+    Gia_ManFillValue( p->pGia );
+    Gia_ManConst0(p->pGia)->Value = 0;
+    Gia_ManForEachCi( p->pGia, pObj, i )
+        pObj->Value = Gia_ManAppendCi( pNew );
+    Gia_ManHashAlloc( pNew );
+    Gia_ManForEachCo( p->pGia, pObj, i )
+    {
+        iLit = Gia_LevFanin( p, Gia_ObjId(p->pGia, pObj), 0 );
+        iLit = Abc_LitNotCond( Gia_LevDerive_rec(pNew, p, Abc_Lit2Var(iLit)), Abc_LitIsCompl(iLit) );
+        pObj->Value = Gia_ManAppendCo( pNew, iLit );
+    }
+    Gia_ManHashStop( pNew );
+    Gia_ManSetRegNum( pNew, Gia_ManRegNum(p->pGia) );
+    return pNew;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Prints the statistics.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Gia_LevPrintStats( Gia_Lev_t * p )
+{
+    printf( "Levels = %d.  Replaced = %d.  Deleted = %d.  Appended = %d.  Visited = %d.\n",
+        p->nLevelMax, p->nReplaced, p->nDeleted, p->nAppended, p->nVisits );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Tests the incremental level manager.]
+
+  Description [Performs random replacements in a copy of the AIG. At each 
+  step, a random node is replaced either by one of its fanins or by a new 
+  node, which is built from one fanin of the node and one fanin of its 
+  other fanin. The levels and the reverse levels are compared with those 
+  computed from scratch after each step (if fCheckAll is set) and at the 
+  end. Returns the number of mismatches.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static int Gia_LevTestPick( Gia_Lev_t * p )
+{
+    int k, iObj;
+    for ( k = 0; k < 1000; k++ )
+    {
+        iObj = 1 + Gia_ManRandom(0) % (Gia_ManObjNum(p->pGia) - 1);
+        if ( Gia_LevIsAnd(p, iObj) && !Gia_LevIsDeleted(p, iObj) && Gia_LevFanoutNum(p, iObj) > 0 )
+            return iObj;
+    }
+    return -1;
+}
+int Gia_LevTest( Gia_Man_t * pGia, int nSteps, int nSeed, int fCheckAll, int fVerbose )
+{
+    Gia_Man_t * pCopy, * pNew;
+    Gia_Lev_t * p;
+    abctime clk = Abc_Clock();
+    int i, n, iObj, iLit0, iLit1, iLitNew, nErrors = 0;
+    pCopy = Gia_ManDup( pGia );
+    p = Gia_LevStart( pCopy );
+    Gia_ManRandom( 1 );
+    for ( i = 0; i < nSeed; i++ )
+        Gia_ManRandom( 0 );
+    for ( i = 0; i < nSteps; i++ )
+    {
+        if ( (iObj = Gia_LevTestPick(p)) == -1 )
+            break;
+        n = Gia_ManRandom(0) & 1;
+        iLit0 = Gia_LevFaninLit( p, iObj, n );
+        iLit1 = Gia_LevFaninLit( p, iObj, !n );
+        if ( (Gia_ManRandom(0) & 1) && Gia_LevIsAnd(p, Abc_Lit2Var(iLit1)) )
+        {
+            iLit1 = Gia_LevFaninLit( p, Abc_Lit2Var(iLit1), Gia_ManRandom(0) & 1 );
+            if ( Abc_Lit2Var(iLit0) != Abc_Lit2Var(iLit1) )
+            {
+                iLitNew = Gia_ManAppendAnd( pCopy, iLit0, iLit1 );
+                Gia_LevAppend( p );
+                if ( Gia_ManRandom(0) & 1 )
+                    iLit0 = Abc_LitNotCond( iLitNew, Gia_ManRandom(0) & 1 );
+                else
+                    Gia_LevDelete( p, Abc_Lit2Var(iLitNew) );
+            }
+        }
+        Gia_LevReplace( p, iObj, iLit0 );
+        if ( fCheckAll )
+            nErrors += Gia_LevVerify( p );
+    }
+    nErrors += Gia_LevVerify( p );
+    pNew = Gia_LevDeriveAig( p );
+    if ( fVerbose )
+    {
+        Gia_LevPrintStats( p );
+        printf( "The derived AIG has %d nodes and %d levels.  ", Gia_ManAndNum(pNew), Gia_ManLevelNum(pNew) );
+        Abc_PrintTime( 1, "Time", Abc_Clock() - clk );
+    }
+    printf( "Performed %d replacements with %d mismatches in the levels.\n", i, nErrors );
+    Gia_ManStop( pNew );
+    Gia_LevStop( p );
+    Gia_ManStop( pCopy );
+    return nErrors;
+}
+
+////////////////////////////////////////////////////////////////////////
+///                       END OF FILE                                ///
+////////////////////////////////////////////////////////////////////////
+
+
+ABC_NAMESPACE_IMPL_END
+
@@ -1905,7 +1905,7 @@ Lf_Man_t * Lf_ManAlloc( Gia_Man_t * pGia, Jf_Par_t * pPars )
     Lf_Man_t * p; int i, k = 0;
     assert( pPars->nCutNum > 1  && pPars->nCutNum <= LF_CUT_MAX );
     assert( pPars->nLutSize > 1 && pPars->nLutSize <= LF_LEAF_MAX );
-    ABC_FREE( pGia->pRefs );
+    Gia_ManAuxIntFreeP( pGia, &pGia->pRefs );
     Vec_IntFreeP( &pGia->vMapping );
     Gia_ManCleanValue( pGia );
     if ( Gia_ManHasChoices(pGia) )
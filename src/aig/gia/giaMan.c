@@ -62,6 +62,8 @@ Gia_Man_t * Gia_ManStart( int nObjsMax )
     p->nObjs = 1;
     p->vCis  = Vec_IntAlloc( nObjsMax / 20 );
     p->vCos  = Vec_IntAlloc( nObjsMax / 20 );
+    if ( Gia_ManArenaDefault() )
+        Gia_ManArenaStart( p );
     return p;
 }
 
@@ -80,12 +82,15 @@ void Gia_ManStop( Gia_Man_t * p )
 {
     if ( p->vSeqModelVec )
         Vec_PtrFreeFree( p->vSeqModelVec );
+    if ( p->pHashPar )
+        Gia_ManHashParStop( p );
     Gia_ManStaticFanoutStop( p );
     Tim_ManStopP( (Tim_Man_t **)&p->pManTime );
     assert( p->pManTime == NULL );
     Vec_PtrFreeFree( p->vNamesIn );
     Vec_PtrFreeFree( p->vNamesOut );
     Vec_IntFreeP( &p->vSwitching );
+    Vec_IntFreeP( &p->vObjValues );
     Vec_IntFreeP( &p->vSuper );
     Vec_IntFreeP( &p->vStore );
     Vec_IntFreeP( &p->vClassNew );
@@ -145,7 +150,7 @@ void Gia_ManStop( Gia_Man_t * p )
     Vec_IntErase( &p->vHTable );
     Vec_IntErase( &p->vRefs );
     ABC_FREE( p->pData2 );
-    ABC_FREE( p->pTravIds );
+    Gia_ManAuxIntFreeP( p, &p->pTravIds );
     ABC_FREE( p->pPlacement );
     ABC_FREE( p->pSwitching );
     ABC_FREE( p->pCexSeq );
@@ -156,9 +161,10 @@ void Gia_ManStop( Gia_Man_t * p )
     ABC_FREE( p->pReprsOld );
     ABC_FREE( p->pReprs );
     ABC_FREE( p->pNexts );
-    ABC_FREE( p->pSibls );
-    ABC_FREE( p->pRefs );
-    ABC_FREE( p->pLutRefs );
+    Gia_ManAuxIntFreeP( p, &p->pSibls );
+    Gia_ManAuxIntFreeP( p, &p->pRefs );
+    Gia_ManAuxIntFreeP( p, &p->pLutRefs );
+    Gia_ManArenaStop( p );
     ABC_FREE( p->pMuxes );
     ABC_FREE( p->pObjs );
     ABC_FREE( p->pSpec );
@@ -524,6 +530,8 @@ void Gia_ManPrintStats( Gia_Man_t * p, Gps_Par_t * pPars )
         Gia_ManPrintLutStats( p );
     if ( p->pPlacement )
         Gia_ManPrintPlacement( p );
+    if ( pPars && pPars->fArena )
+        Gia_ManArenaPrintStats( p );
 //    if ( p->pManTime )
 //        Tim_ManPrintStats( (Tim_Man_t *)p->pManTime, p->nAnd2Delay );
     Gia_ManPrintFlopClasses( p );
@@ -777,7 +785,7 @@ void Gia_ManPrintNpnClasses( Gia_Man_t * p )
         OtherClasses, 100.0 * OtherClasses / (nTotal+1) );
     // count the number of LUTs that have MUX function and two fanins with MUX functions
     OtherClasses = OtherClasses2 = 0;
-    ABC_FREE( p->pRefs );
+    Gia_ManAuxIntFreeP( p, &p->pRefs );
     Gia_ManSetRefsMapped( p );
     Gia_ManForEachLut( p, i )
     {
@@ -796,7 +804,7 @@ void Gia_ManPrintNpnClasses( Gia_Man_t * p )
 //                Abc_Print( 1, "%d ", pLutClass[iFan] );
 //            Abc_Print( 1, "\n" );
     }
-    ABC_FREE( p->pRefs );
+    Gia_ManAuxIntFreeP( p, &p->pRefs );
     Abc_Print( 1, "Approximate number of 4:1 MUX structures: All = %6d  (%7.2f %%)  MFFC = %6d  (%7.2f %%)\n", 
         OtherClasses,  100.0 * OtherClasses  / (nTotal+1),
         OtherClasses2, 100.0 * OtherClasses2 / (nTotal+1) );
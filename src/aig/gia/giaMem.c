@@ -20,6 +20,10 @@
 
 #include "gia.h"
 
+#if defined(_MSC_VER)
+#include <windows.h>
+#endif
+
 ABC_NAMESPACE_IMPL_START
 
 
@@ -59,10 +63,14 @@ struct Gia_MmFlex_t_
     int           nChunksAlloc;  // the maximum number of memory chunks 
     int           nChunks;       // the current number of memory chunks 
     char **       pChunks;       // the allocated memory
+    int *         pChunkSizes;   // the sizes of the allocated chunks
+    int *         pFree[32];     // the released arrays by the size class (used by the arena)
 
     // statistics
-    int           nMemoryUsed;   // memory used in the allocated entries
-    int           nMemoryAlloc;  // memory allocated
+    word          nMemoryUsed;   // memory used in the allocated entries
+    word          nMemoryAlloc;  // memory allocated
+    word          nMemoryFreed;  // memory in the entries released by the user
+    word          nMemoryReused; // memory in the entries reused after being released
 };
 
 struct Gia_MmStep_t_
@@ -77,6 +85,20 @@ struct Gia_MmStep_t_
     char **       pChunks;       // the allocated memory
 };
 
+// the arenas may be released by the managers living in different threads
+#if defined(__GNUC__)
+#define Gia_AtomicAdd( p, n )       __sync_fetch_and_add( (p), (n) )
+#elif defined(_MSC_VER)
+#define Gia_AtomicAdd( p, n )       InterlockedExchangeAdd64( (volatile LONGLONG *)(p), (LONGLONG)(n) )
+#else
+#define Gia_AtomicAdd( p, n )       (*(p) += (n))
+#endif
+
+static          int  s_fGiaArena      = 0;  // use the arena in the new managers
+static volatile word s_nGiaArenas     = 0;  // the number of arenas released
+static volatile word s_nGiaArenaChunk = 0;  // the number of chunks released
+static volatile word s_nGiaArenaMem   = 0;  // the memory released
+
 ////////////////////////////////////////////////////////////////////////
 ///                     FUNCTION DEFINITIONS                         ///
 ////////////////////////////////////////////////////////////////////////
@@ -317,6 +339,7 @@ Gia_MmFlex_t * Gia_MmFlexStart()
     p->nChunksAlloc  = 64;
     p->nChunks       = 0;
     p->pChunks       = ABC_ALLOC( char *, p->nChunksAlloc );
+    p->pChunkSizes   = ABC_ALLOC( int, p->nChunksAlloc );
 
     p->nMemoryUsed   = 0;
     p->nMemoryAlloc  = 0;
@@ -343,12 +366,13 @@ void Gia_MmFlexStop( Gia_MmFlex_t * p, int fVerbose )
     {
         printf( "Flexible memory manager: Chunk size = %d. Chunks used = %d.\n",
             p->nChunkSize, p->nChunks );
-        printf( "   Entries used = %d. Memory used = %d. Memory alloc = %d.\n",
-            p->nEntriesUsed, p->nMemoryUsed, p->nMemoryAlloc );
+        printf( "   Entries used = %d. Memory used = %.0f. Memory alloc = %.0f.\n",
+            p->nEntriesUsed, (double)p->nMemoryUsed, (double)p->nMemoryAlloc );
     }
     for ( i = 0; i < p->nChunks; i++ )
         ABC_FREE( p->pChunks[i] );
     ABC_FREE( p->pChunks );
+    ABC_FREE( p->pChunkSizes );
     ABC_FREE( p );
 }
 
@@ -373,6 +397,7 @@ char * Gia_MmFlexEntryFetch( Gia_MmFlex_t * p, int nBytes )
         {
             p->nChunksAlloc *= 2;
             p->pChunks = ABC_REALLOC( char *, p->pChunks, p->nChunksAlloc ); 
+            p->pChunkSizes = ABC_REALLOC( int, p->pChunkSizes, p->nChunksAlloc ); 
         }
         if ( nBytes > p->nChunkSize )
         {
@@ -384,6 +409,7 @@ char * Gia_MmFlexEntryFetch( Gia_MmFlex_t * p, int nBytes )
         p->pEnd     = p->pCurrent + p->nChunkSize;
         p->nMemoryAlloc += p->nChunkSize;
         // add the chunk to the chunk storage
+        p->pChunkSizes[ p->nChunks ] = p->nChunkSize;
         p->pChunks[ p->nChunks++ ] = p->pCurrent;
     }
     assert( p->pCurrent + nBytes <= p->pEnd );
@@ -417,12 +443,15 @@ void Gia_MmFlexRestart( Gia_MmFlex_t * p )
     for ( i = 1; i < p->nChunks; i++ )
         ABC_FREE( p->pChunks[i] );
     p->nChunks  = 1;
-    p->nMemoryAlloc = p->nChunkSize;
+    p->nMemoryAlloc = p->pChunkSizes[0];
     // transform these entries into a linked list
     p->pCurrent = p->pChunks[0];
-    p->pEnd     = p->pCurrent + p->nChunkSize;
+    p->pEnd     = p->pCurrent + p->pChunkSizes[0];
     p->nEntriesUsed = 0;
     p->nMemoryUsed = 0;
+    p->nMemoryFreed = 0;
+    p->nMemoryReused = 0;
+    memset( p->pFree, 0, sizeof(p->pFree) );
 }
 
 /**Function*************************************************************
@@ -438,7 +467,27 @@ void Gia_MmFlexRestart( Gia_MmFlex_t * p )
 ***********************************************************************/
 int Gia_MmFlexReadMemUsage( Gia_MmFlex_t * p )
 {
-    return p->nMemoryUsed;
+    return (int)p->nMemoryUsed;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Returns 1 if the entry belongs to one of the chunks.]
+
+  Description []
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Gia_MmFlexContains( Gia_MmFlex_t * p, char * pEntry )
+{
+    int i;
+    for ( i = p->nChunks - 1; i >= 0; i-- )
+        if ( pEntry >= p->pChunks[i] && pEntry < p->pChunks[i] + p->pChunkSizes[i] )
+            return 1;
+    return 0;
 }
 
 
@@ -591,6 +640,169 @@ int Gia_MmStepReadMemUsage( Gia_MmStep_t * p )
     return nMemTotal;
 }
 
+/**Function*************************************************************
+
+  Synopsis    [Enables the arena in the AIG managers started later.]
+
+  Description [When the arena is enabled, the auxiliary arrays of the 
+  manager (the reference counters, the choice links, and the traversal
+  IDs) are carved from a flexible memory manager owned by the AIG, which
+  is released in one shot by Gia_ManStop(). The arrays released earlier
+  are kept in the free lists of the arena and reused by the later arrays.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Gia_ManArenaSetDefault( int fEnable )
+{
+    s_fGiaArena = fEnable;
+}
+int Gia_ManArenaDefault()
+{
+    return s_fGiaArena;
+}
+void Gia_ManArenaStart( Gia_Man_t * p )
+{
+    assert( p->pArena == NULL );
+    p->pArena = Gia_MmFlexStart();
+}
+void Gia_ManArenaStop( Gia_Man_t * p )
+{
+    if ( p->pArena == NULL )
+        return;
+    Gia_AtomicAdd( &s_nGiaArenas, 1 );
+    Gia_AtomicAdd( &s_nGiaArenaChunk, (word)p->pArena->nChunks );
+    Gia_AtomicAdd( &s_nGiaArenaMem, p->pArena->nMemoryAlloc );
+    Gia_MmFlexStop( p->pArena, 0 );
+    p->pArena = NULL;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Allocates, resizes and releases the auxiliary arrays.]
+
+  Description [The arrays are zeroed. The capacity of the array carved 
+  from the arena is stored in front of it. The released array is linked 
+  into the free list of its size class (the class of capacity C is the 
+  smallest K such that C <= 2^K). The new array of N entries is taken from 
+  the class of N if one of its arrays is large enough, or from the next 
+  class, whose arrays are always large enough. The arrays not belonging 
+  to the arena (for example, those allocated before the arena was started 
+  or assigned by the user) are handled by the system allocator.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static inline int    Gia_ManAuxIntClass( int nEntries )      { return Abc_Base2Log( nEntries );            }
+static inline int ** Gia_ManAuxIntNext( int * pArray )       { return (int **)(pArray + 2);                }
+static int * Gia_ManAuxIntReuse( Gia_MmFlex_t * pArena, int nEntries )
+{
+    int ** ppPlace, * pArray;
+    int Class = Gia_ManAuxIntClass( nEntries );
+    // find the large enough array in the class of this size
+    for ( ppPlace = &pArena->pFree[Class]; *ppPlace; ppPlace = Gia_ManAuxIntNext(*ppPlace) )
+        if ( (*ppPlace)[0] >= nEntries )
+            break;
+    // otherwise, take any array of the next class
+    if ( *ppPlace == NULL && Class + 1 < 32 )
+        ppPlace = &pArena->pFree[Class + 1];
+    if ( (pArray = *ppPlace) == NULL )
+        return NULL;
+    *ppPlace = *Gia_ManAuxIntNext(pArray);
+    pArena->nMemoryFreed  -= sizeof(int) * (pArray[0] + 2);
+    pArena->nMemoryReused += sizeof(int) * (pArray[0] + 2);
+    return pArray;
+}
+int * Gia_ManAuxIntStart( Gia_Man_t * p, int nEntries )
+{
+    int * pArray;
+    if ( p->pArena == NULL )
+        return ABC_CALLOC( int, nEntries );
+    nEntries = Abc_MaxInt( (nEntries + 1) & ~1, 2 );
+    pArray = Gia_ManAuxIntReuse( p->pArena, nEntries );
+    if ( pArray == NULL )
+    {
+        pArray = (int *)Gia_MmFlexEntryFetch( p->pArena, sizeof(int) * (nEntries + 2) );
+        pArray[0] = nEntries;
+        pArray[1] = 0;
+    }
+    memset( pArray + 2, 0, sizeof(int) * nEntries );
+    return pArray + 2;
+}
+static inline int Gia_ManAuxIntIsArena( Gia_Man_t * p, int * pArray )
+{
+    return p->pArena && Gia_MmFlexContains( p->pArena, (char *)pArray );
+}
+int * Gia_ManAuxIntGrow( Gia_Man_t * p, int * pArray, int nEntries, int nEntriesNew )
+{
+    int * pArrayNew;
+    assert( nEntries <= nEntriesNew );
+    if ( pArray == NULL )
+        return Gia_ManAuxIntStart( p, nEntriesNew );
+    if ( !Gia_ManAuxIntIsArena(p, pArray) )
+    {
+        pArray = ABC_REALLOC( int, pArray, nEntriesNew );
+        memset( pArray + nEntries, 0, sizeof(int) * (nEntriesNew - nEntries) );
+        return pArray;
+    }
+    if ( nEntriesNew <= pArray[-2] )
+    {
+        memset( pArray + nEntries, 0, sizeof(int) * (nEntriesNew - nEntries) );
+        return pArray;
+    }
+    pArrayNew = Gia_ManAuxIntStart( p, nEntriesNew );
+    memcpy( pArrayNew, pArray, sizeof(int) * nEntries );
+    Gia_ManAuxIntFreeP( p, &pArray );
+    return pArrayNew;
+}
+void Gia_ManAuxIntFreeP( Gia_Man_t * p, int ** ppArray )
+{
+    if ( *ppArray == NULL )
+        return;
+    if ( Gia_ManAuxIntIsArena(p, *ppArray) )
+    {
+        int * pArray = *ppArray - 2;
+        int Class = Gia_ManAuxIntClass( pArray[0] );
+        *Gia_ManAuxIntNext(pArray) = p->pArena->pFree[Class];
+        p->pArena->pFree[Class] = pArray;
+        p->pArena->nMemoryFreed += sizeof(int) * (pArray[0] + 2);
+    }
+    else
+        ABC_FREE( *ppArray );
+    *ppArray = NULL;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Prints the statistics of the arena.]
+
+  Description []
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Gia_ManArenaPrintStats( Gia_Man_t * p )
+{
+    Gia_MmFlex_t * pArena = p->pArena;
+    if ( pArena == NULL )
+        Abc_Print( 1, "Arena    : not used by this AIG (enabled for new AIGs = %s)", s_fGiaArena ? "yes" : "no" );
+    else
+    {
+        Abc_Print( 1, "Arena    : chunks =%4d  alloc =%8.2f MB  used =%8.2f MB  free =%8.2f MB  reused =%8.2f MB  entries =%6d", 
+            pArena->nChunks, 1.0*pArena->nMemoryAlloc/(1<<20), 1.0*pArena->nMemoryUsed/(1<<20), 
+            1.0*pArena->nMemoryFreed/(1<<20), 1.0*pArena->nMemoryReused/(1<<20), pArena->nEntriesUsed );
+    }
+    Abc_Print( 1, "\n" );
+    Abc_Print( 1, "Released : arenas =%7d  chunks =%7d  memory =%10.2f MB\n", 
+        (int)s_nGiaArenas, (int)s_nGiaArenaChunk, 1.0*s_nGiaArenaMem/(1<<20) );
+}
+
 ////////////////////////////////////////////////////////////////////////
 ///                       END OF FILE                                ///
 ////////////////////////////////////////////////////////////////////////
@@ -1376,7 +1376,7 @@ Mf_Man_t * Mf_ManAlloc( Gia_Man_t * pGia, Jf_Par_t * pPars )
     int i, Entry;
     assert( pPars->nCutNum > 1  && pPars->nCutNum <= MF_CUT_MAX );
     assert( pPars->nLutSize > 1 && pPars->nLutSize <= MF_LEAF_MAX );
-    ABC_FREE( pGia->pRefs );
+    Gia_ManAuxIntFreeP( pGia, &pGia->pRefs );
     Vec_IntFreeP( &pGia->vMapping );
     if ( Gia_ManHasChoices(pGia) )
         Gia_ManSetPhase(pGia);
@@ -256,7 +256,7 @@ void Gia_ManComputeDomsTry( Gia_Man_t * p )
     Gia_Obj_t * pObj;
     int i, nSize, Entry, k;
     abctime clk = Abc_Clock();
-    ABC_FREE( p->pRefs );
+    Gia_ManAuxIntFreeP( p, &p->pRefs );
     Gia_ManLevelNum( p );
     Gia_ManCreateRefs( p );
     Gia_ManComputeDoms( p );
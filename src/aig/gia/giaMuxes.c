@@ -101,7 +101,7 @@ Gia_Man_t * Gia_ManDupMuxes( Gia_Man_t * p, int Limit )
     int i;
     assert( p->pMuxes == NULL );
     assert( Limit >= 0 ); // allows to create AIG with XORs without MUXes
-    ABC_FREE( p->pRefs );
+    Gia_ManAuxIntFreeP( p, &p->pRefs );
     Gia_ManCreateRefs( p ); 
     // start the new manager
     pNew = Gia_ManStart( Gia_ManObjNum(p) );
@@ -109,7 +109,7 @@ Gia_Man_t * Gia_ManDupMuxes( Gia_Man_t * p, int Limit )
     pNew->pSpec = Abc_UtilStrsav( p->pSpec );
     pNew->pMuxes = ABC_CALLOC( unsigned, pNew->nObjsAlloc );
     if ( Gia_ManHasChoices(p) )
-        pNew->pSibls = ABC_CALLOC( int, pNew->nObjsAlloc );
+        pNew->pSibls = Gia_ManAuxIntStart( pNew, pNew->nObjsAlloc );
     Gia_ManConst0(p)->Value = 0;
     Gia_ManHashStart( pNew );
     Gia_ManForEachObj1( p, pObj, i )
@@ -370,7 +370,7 @@ Nf_Man_t * Nf_StoCreate( Gia_Man_t * pGia, Jf_Par_t * pPars )
     int i, Entry;
     assert( pPars->nCutNum > 1  && pPars->nCutNum <= NF_CUT_MAX );
     assert( pPars->nLutSize > 1 && pPars->nLutSize <= NF_LEAF_MAX );
-    ABC_FREE( pGia->pRefs );
+    Gia_ManAuxIntFreeP( pGia, &pGia->pRefs );
     Vec_IntFreeP( &pGia->vCellMapping );
     if ( Gia_ManHasChoices(pGia) )
         Gia_ManSetPhase(pGia);
@@ -181,7 +181,7 @@ void Of_ManAreaFlow( Of_Man_t * p )
         Of_ObjSetFlow( p, Id, (Gia_ObjFanin0(pObj)->Value + Gia_ObjFanin1(pObj)->Value + AreaUnit) / Gia_ObjRefNum(p->pGia, pObj) );
     Gia_ManForEachCo( p->pGia, pObj, i )
         Total += Gia_ObjFanin0(pObj)->Value;
-    ABC_FREE( p->pGia->pRefs );
+    Gia_ManAuxIntFreeP( p->pGia, &p->pGia->pRefs );
     if ( 1 )
         return;
     printf( "CI = %5d.  ", Gia_ManCiNum(p->pGia) );
@@ -210,12 +210,12 @@ Of_Man_t * Of_StoCreate( Gia_Man_t * pGia, Jf_Par_t * pPars )
     int * pRefs = NULL;
     assert( pPars->nCutNum > 1  && pPars->nCutNum <= OF_CUT_MAX );
     assert( pPars->nLutSize > 1 && pPars->nLutSize <= OF_LEAF_MAX );
-    ABC_FREE( pGia->pRefs );
+    Gia_ManAuxIntFreeP( pGia, &pGia->pRefs );
     Vec_IntFreeP( &pGia->vCellMapping );
     if ( Gia_ManHasChoices(pGia) )
         Gia_ManSetPhase(pGia);
     // create references
-    ABC_FREE( pGia->pRefs );
+    Gia_ManAuxIntFreeP( pGia, &pGia->pRefs );
     vFlowRefs = Vec_IntAlloc(0);
     Mf_ManSetFlowRefs( pGia, vFlowRefs );
     pGia->pRefs= Vec_IntReleaseArray(vFlowRefs);
@@ -297,12 +297,12 @@ Pf_Man_t * Pf_StoCreate( Gia_Man_t * pGia, Jf_Par_t * pPars )
     Vec_Int_t * vFlowRefs;
     assert( pPars->nCutNum > 1  && pPars->nCutNum <= PF_CUT_MAX );
     assert( pPars->nLutSize > 1 && pPars->nLutSize <= PF_LEAF_MAX );
-    ABC_FREE( pGia->pRefs );
+    Gia_ManAuxIntFreeP( pGia, &pGia->pRefs );
     Vec_IntFreeP( &pGia->vCellMapping );
     if ( Gia_ManHasChoices(pGia) )
         Gia_ManSetPhase(pGia);
     // create references
-    ABC_FREE( pGia->pRefs );
+    Gia_ManAuxIntFreeP( pGia, &pGia->pRefs );
     vFlowRefs = Vec_IntAlloc(0);
     Mf_ManSetFlowRefs( pGia, vFlowRefs );
     pGia->pRefs= Vec_IntReleaseArray(vFlowRefs);
@@ -0,0 +1,327 @@
+/**CFile****************************************************************
+
+  FileName    [giaReorder.c]
+
+  SystemName  [ABC: Logic synthesis and verification system.]
+
+  PackageName [Scalable AIG package.]
+
+  Synopsis    [Reordering objects to improve the locality of traversals.]
+
+  Author      [Alan Mishchenko]
+
+  Affiliation [UC Berkeley]
+
+  Date        [Ver. 1.0. Started - June 20, 2005.]
+
+  Revision    [$Id: giaReorder.c,v 1.00 2005/06/20 00:00:00 alanmi Exp $]
+
+***********************************************************************/
+
+#include "gia.h"
+#include "misc/tim/tim.h"
+
+ABC_NAMESPACE_IMPL_START
+
+
+////////////////////////////////////////////////////////////////////////
+///                        DECLARATIONS                              ///
+////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////
+///                     FUNCTION DEFINITIONS                         ///
+////////////////////////////////////////////////////////////////////////
+
+/**Function*************************************************************
+
+  Synopsis    [Computes the locality of the fanins.]
+
+  Description [Returns the average distance between the IDs of the
+  objects and their fanins. The fanins of the COs are included. Also
+  returns the percentage of the fanins within the given distance.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+double Gia_ManReorderFaninDist( Gia_Man_t * p, int nBlock, double * pNear )
+{
+    Gia_Obj_t * pObj;
+    word Dist = 0;
+    int i, nFanins = 0, nNear = 0;
+    Gia_ManForEachAnd( p, pObj, i )
+    {
+        nNear += (int)(pObj->iDiff0 < (unsigned)nBlock) + (int)(pObj->iDiff1 < (unsigned)nBlock);
+        Dist  += pObj->iDiff0 + pObj->iDiff1;
+        nFanins += 2;
+    }
+    Gia_ManForEachCo( p, pObj, i )
+    {
+        nNear += (int)(pObj->iDiff0 < (unsigned)nBlock);
+        Dist  += pObj->iDiff0;
+        nFanins++;
+    }
+    if ( pNear )
+        *pNear = nFanins ? 100.0 * nNear / nFanins : 0;
+    return nFanins ? 1.0 * Dist / nFanins : 0;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Collects the internal nodes in the DFS order.]
+
+  Description [The nodes are visited starting from the COs, in the order
+  of the COs, with the first fanin visited before the second one. The
+  nodes not in the transitive fanin of the COs are visited at the end,
+  in the order of their IDs. The explicit stack is used, so that deep
+  AIGs do not exhaust the system stack.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Gia_ManReorderDfs_iter( Gia_Man_t * p, int iRoot, Vec_Int_t * vStack, Vec_Int_t * vOrder )
+{
+    Gia_Obj_t * pObj;
+    int iObj, iFan0, iFan1;
+    if ( Gia_ObjIsTravIdCurrentId(p, iRoot) )
+        return;
+    Vec_IntPush( vStack, iRoot );
+    while ( Vec_IntSize(vStack) )
+    {
+        iObj = Vec_IntEntryLast( vStack );
+        if ( Gia_ObjIsTravIdCurrentId(p, iObj) )
+        {
+            Vec_IntPop( vStack );
+            continue;
+        }
+        pObj  = Gia_ManObj( p, iObj );
+        assert( Gia_ObjIsAnd(pObj) );
+        iFan0 = Gia_ObjFaninId0( pObj, iObj );
+        iFan1 = Gia_ObjFaninId1( pObj, iObj );
+        if ( !Gia_ObjIsTravIdCurrentId(p, iFan0) || !Gia_ObjIsTravIdCurrentId(p, iFan1) )
+        {
+            if ( !Gia_ObjIsTravIdCurrentId(p, iFan1) )
+                Vec_IntPush( vStack, iFan1 );
+            if ( !Gia_ObjIsTravIdCurrentId(p, iFan0) )
+                Vec_IntPush( vStack, iFan0 );
+            continue;
+        }
+        Vec_IntPop( vStack );
+        Gia_ObjSetTravIdCurrentId( p, iObj );
+        Vec_IntPush( vOrder, iObj );
+    }
+}
+Vec_Int_t * Gia_ManReorderDfs( Gia_Man_t * p )
+{
+    Vec_Int_t * vOrder = Vec_IntAlloc( Gia_ManAndNum(p) );
+    Vec_Int_t * vStack = Vec_IntAlloc( 1000 );
+    Gia_Obj_t * pObj;
+    int i;
+    Gia_ManIncrementTravId( p );
+    Gia_ObjSetTravIdCurrentId( p, 0 );
+    Gia_ManForEachCi( p, pObj, i )
+        Gia_ObjSetTravIdCurrent( p, pObj );
+    Gia_ManForEachCo( p, pObj, i )
+        Gia_ManReorderDfs_iter( p, Gia_ObjFaninId0p(p, pObj), vStack, vOrder );
+    Gia_ManForEachAnd( p, pObj, i )
+        Gia_ManReorderDfs_iter( p, i, vStack, vOrder );
+    Vec_IntFree( vStack );
+    assert( Vec_IntSize(vOrder) == Gia_ManAndNum(p) );
+    return vOrder;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Collects the internal nodes in the level order.]
+
+  Description [The nodes on the same level follow in the order of IDs.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Vec_Int_t * Gia_ManReorderLevel( Gia_Man_t * p )
+{
+    Vec_Int_t * vOrder;
+    Gia_Obj_t * pObj;
+    int i, nLevels = Gia_ManLevelNum( p );
+    int * pCounts = ABC_CALLOC( int, nLevels + 1 );
+    Gia_ManForEachAnd( p, pObj, i )
+        pCounts[Gia_ObjLevel(p, pObj)]++;
+    for ( i = 1; i <= nLevels; i++ )
+        pCounts[i] += pCounts[i-1];
+    vOrder = Vec_IntStart( Gia_ManAndNum(p) );
+    Gia_ManForEachAnd( p, pObj, i )
+        Vec_IntWriteEntry( vOrder, pCounts[Gia_ObjLevel(p, pObj)-1]++, i );
+    ABC_FREE( pCounts );
+    return vOrder;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Collects the internal nodes in the blocked order.]
+
+  Description [The DFS order is divided into the blocks of the given
+  size and the nodes of each block are sorted by level. The order remains
+  topological because the fanins of a node are either in the previous
+  blocks or on the lower levels of the same block. The nodes sharing the
+  fanins tend to be placed next to each other, while the distance to the
+  fanins does not exceed that of the DFS order by more than the block size.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Vec_Int_t * Gia_ManReorderBlocks( Gia_Man_t * p, int nBlock )
+{
+    Vec_Int_t * vOrder = Gia_ManReorderDfs( p );
+    Vec_Wrd_t * vKeys = Vec_WrdAlloc( nBlock );
+    int i, k, iObj;
+    word Key;
+    assert( nBlock > 0 );
+    Gia_ManLevelNum( p );
+    for ( i = 0; i < Vec_IntSize(vOrder); i += nBlock )
+    {
+        Vec_WrdClear( vKeys );
+        for ( k = i; k < Abc_MinInt(i + nBlock, Vec_IntSize(vOrder)); k++ )
+        {
+            iObj = Vec_IntEntry( vOrder, k );
+            Vec_WrdPush( vKeys, ((word)Gia_ObjLevelId(p, iObj) << 32) | (word)iObj );
+        }
+        // the IDs are topologically ordered, so the sort is stable for the nodes on the same level
+        Vec_WrdSort( vKeys, 0 );
+        Vec_WrdForEachEntry( vKeys, Key, k )
+            Vec_IntWriteEntry( vOrder, i + k, (int)(Key & 0xFFFFFFFF) );
+    }
+    Vec_WrdFree( vKeys );
+    return vOrder;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Remaps the object-indexed array into the new AIG.]
+
+  Description [The objects of p point to the literals of pNew.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Vec_Int_t * Gia_ManReorderRemapObjs( Gia_Man_t * pNew, Gia_Man_t * p, Vec_Int_t * vObjs )
+{
+    Vec_Int_t * vObjsNew;
+    Gia_Obj_t * pObj;
+    int i;
+    if ( vObjs == NULL )
+        return NULL;
+    assert( Vec_IntSize(vObjs) == Gia_ManObjNum(p) );
+    vObjsNew = Vec_IntStart( Gia_ManObjNum(pNew) );
+    Gia_ManForEachObj( p, pObj, i )
+        Vec_IntWriteEntry( vObjsNew, Abc_Lit2Var(pObj->Value), Vec_IntEntry(vObjs, i) );
+    return vObjsNew;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Renumbers the objects to improve the locality.]
+
+  Description [The CIs are placed first and the COs are placed last,
+  in their original order. The internal nodes are placed in the DFS order
+  (Mode = 0), the level order (Mode = 1), or the DFS order with the blocks
+  of nBlock nodes sorted by level (Mode = 2). The structure of the AIG
+  is not changed. The names, equivalences, mapping, packing, timing,
+  and the object classes are transferred to the new AIG.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Gia_Man_t * Gia_ManReorderLocality( Gia_Man_t * p, int Mode, int nBlock, int fVerbose )
+{
+    Gia_Man_t * pNew;
+    Gia_Obj_t * pObj;
+    Vec_Int_t * vOrder;
+    double DistOld, DistNew, NearOld, NearNew;
+    abctime clk = Abc_Clock();
+    int i;
+    assert( !Gia_ManHasChoices(p) && p->pMuxes == NULL && Gia_ManBufNum(p) == 0 );
+    assert( Mode >= 0 && Mode <= 2 && nBlock > 0 );
+    if ( Mode == 0 )
+        vOrder = Gia_ManReorderDfs( p );
+    else if ( Mode == 1 )
+        vOrder = Gia_ManReorderLevel( p );
+    else
+        vOrder = Gia_ManReorderBlocks( p, nBlock );
+    // duplicate the AIG in the new order
+    Gia_ManFillValue( p );
+    pNew = Gia_ManStart( Gia_ManObjNum(p) );
+    pNew->pName = Abc_UtilStrsav( p->pName );
+    pNew->pSpec = Abc_UtilStrsav( p->pSpec );
+    Gia_ManConst0(p)->Value = 0;
+    Gia_ManForEachCi( p, pObj, i )
+        pObj->Value = Gia_ManAppendCi( pNew );
+    Gia_ManForEachObjVec( vOrder, p, pObj, i )
+        pObj->Value = Gia_ManAppendAnd( pNew, Gia_ObjFanin0Copy(pObj), Gia_ObjFanin1Copy(pObj) );
+    Gia_ManForEachCo( p, pObj, i )
+        pObj->Value = Gia_ManAppendCo( pNew, Gia_ObjFanin0Copy(pObj) );
+    Gia_ManSetRegNum( pNew, Gia_ManRegNum(p) );
+    pNew->nConstrs = p->nConstrs;
+    if ( p->pCexSeq )
+        pNew->pCexSeq = Abc_CexDup( p->pCexSeq, Gia_ManRegNum(p) );
+    assert( Gia_ManObjNum(pNew) == Gia_ManObjNum(p) );
+    Vec_IntFree( vOrder );
+    // transfer the object-indexed information
+    Gia_ManDupRemapEquiv( pNew, p );
+    Gia_ManTransferMapping( pNew, p );
+    Gia_ManTransferPacking( pNew, p );
+    pNew->vGateClasses = Gia_ManReorderRemapObjs( pNew, p, p->vGateClasses );
+    pNew->vObjClasses  = Gia_ManReorderRemapObjs( pNew, p, p->vObjClasses );
+    // copy the information related to the CIs and COs
+    if ( p->vNamesIn )
+        pNew->vNamesIn  = Vec_PtrDupStr( p->vNamesIn );
+    if ( p->vNamesOut )
+        pNew->vNamesOut = Vec_PtrDupStr( p->vNamesOut );
+    if ( p->pManTime )
+        pNew->pManTime  = Tim_ManDup( (Tim_Man_t *)p->pManTime, 0 );
+    if ( p->pAigExtra )
+        pNew->pAigExtra = Gia_ManDup( p->pAigExtra );
+    pNew->vFlopClasses = p->vFlopClasses ? Vec_IntDup( p->vFlopClasses ) : NULL;
+    pNew->vRegClasses  = p->vRegClasses  ? Vec_IntDup( p->vRegClasses )  : NULL;
+    pNew->vRegInits    = p->vRegInits    ? Vec_IntDup( p->vRegInits )    : NULL;
+    pNew->vConfigs     = p->vConfigs     ? Vec_IntDup( p->vConfigs )     : NULL;
+    pNew->pCellStr     = p->pCellStr     ? Abc_UtilStrsav( p->pCellStr ) : NULL;
+    pNew->vCiArrs      = p->vCiArrs      ? Vec_IntDup( p->vCiArrs )      : NULL;
+    pNew->vCoReqs      = p->vCoReqs      ? Vec_IntDup( p->vCoReqs )      : NULL;
+    pNew->vCoArrs      = p->vCoArrs      ? Vec_IntDup( p->vCoArrs )      : NULL;
+    pNew->vCoAttrs     = p->vCoAttrs     ? Vec_IntDup( p->vCoAttrs )     : NULL;
+    pNew->vInArrs      = p->vInArrs      ? Vec_FltDup( p->vInArrs )      : NULL;
+    pNew->vOutReqs     = p->vOutReqs     ? Vec_FltDup( p->vOutReqs )     : NULL;
+    pNew->And2Delay    = p->And2Delay;
+    pNew->nAnd2Delay   = p->nAnd2Delay;
+    pNew->DefInArrs    = p->DefInArrs;
+    pNew->DefOutReqs   = p->DefOutReqs;
+    if ( fVerbose )
+    {
+        DistOld = Gia_ManReorderFaninDist( p,    nBlock, &NearOld );
+        DistNew = Gia_ManReorderFaninDist( pNew, nBlock, &NearNew );
+        printf( "Ave fanin distance = %.2f -> %.2f (%.2f %%).  ", DistOld, DistNew, DistOld > 0 ? 100.0*(DistOld-DistNew)/DistOld : 0.0 );
+        printf( "Fanins closer than %d = %.2f %% -> %.2f %%.  ", nBlock, NearOld, NearNew );
+        Abc_PrintTime( 1, "Time", Abc_Clock() - clk );
+    }
+    return pNew;
+}
+
+////////////////////////////////////////////////////////////////////////
+///                       END OF FILE                                ///
+////////////////////////////////////////////////////////////////////////
+
+
+ABC_NAMESPACE_IMPL_END
+
@@ -96,7 +96,7 @@ Vec_Int_t * Seg_ManCountIntEdges( Gia_Man_t * p, Vec_Int_t * vPolars, Vec_Int_t
                 Vec_IntPushTwo( vEdges, iFanin, iLut );
             }
     if ( nFanouts )
-        ABC_FREE( p->pLutRefs );
+        Gia_ManAuxIntFreeP( p, &p->pLutRefs );
     return vEdges;
 }
 Vec_Wec_t * Seg_ManCollectObjEdges( Vec_Int_t * vEdges, int nObjs )
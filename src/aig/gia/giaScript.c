@@ -316,7 +316,7 @@ Gia_Man_t * Gia_ManDupToBarBufs( Gia_Man_t * p, int nBarBufs )
     pNew->pName = Abc_UtilStrsav( p->pName );
     pNew->pSpec = Abc_UtilStrsav( p->pSpec );
     if ( Gia_ManHasChoices(p) )
-        pNew->pSibls = ABC_CALLOC( int, Gia_ManObjNum(p) );
+        pNew->pSibls = Gia_ManAuxIntStart( pNew, Gia_ManObjNum(p) );
     Gia_ManFillValue(p);
     Gia_ManConst0(p)->Value = 0;
     for ( i = 0; i < nPiReal; i++ )
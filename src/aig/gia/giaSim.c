@@ -20,6 +20,7 @@
 
 #include "gia.h"
 #include "misc/util/utilTruth.h"
+#include "misc/util/utilSimd.h"
 
 ABC_NAMESPACE_IMPL_START
 
@@ -171,6 +172,7 @@ void Gia_ManSimSetDefaultParams( Gia_ParSim_t * p )
     p->RandSeed     =   0;    // the seed to generate random numbers
     p->TimeLimit    =  60;    // time limit in seconds
     p->fCheckMiter  =   0;    // check if miter outputs are non-zero 
+    p->nThreads     =   1;    // the number of threads
     p->fVerbose     =   0;    // enables verbose output
     p->iOutFail     =  -1;    // index of the failed output
 }
@@ -396,6 +398,11 @@ static inline void Gia_ManSimulateNode( Gia_ManSim_t * p, Gia_Obj_t * pObj )
     unsigned * pInfo0 = Gia_SimData( p, Gia_ObjDiff0(pObj) );
     unsigned * pInfo1 = Gia_SimData( p, Gia_ObjDiff1(pObj) );
     int w;
+    if ( (p->nWords & 1) == 0 ) // the info of each node is aligned on the 64-bit boundary
+    {
+        Util_SimdAnd( (word *)pInfo, (word *)pInfo0, (word *)pInfo1, Gia_ObjFaninC0(pObj), Gia_ObjFaninC1(pObj), p->nWords/2 );
+        return;
+    }
     if ( Gia_ObjFaninC0(pObj) )
     {
         if (  Gia_ObjFaninC1(pObj) )
@@ -605,6 +612,8 @@ int Gia_ManSimSimulate( Gia_Man_t * pAig, Gia_ParSim_t * pPars )
     abctime nTimeToStop = pPars->TimeLimit ? pPars->TimeLimit * CLOCKS_PER_SEC + Abc_Clock(): 0;
     if ( pAig->pReprs && pAig->pNexts )
         return Gia_ManSimSimulateEquiv( pAig, pPars );
+    if ( pPars->nThreads > 1 )
+        return Gia_ManSimSimulatePar( pAig, pPars );
     ABC_FREE( pAig->pCexSeq );
     p = Gia_ManSimCreate( pAig, pPars );
     Gia_ManResetRandom( pPars );
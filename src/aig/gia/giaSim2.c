@@ -19,6 +19,7 @@
 ***********************************************************************/
 
 #include "gia.h"
+#include "misc/util/utilSimd.h"
 
 ABC_NAMESPACE_IMPL_START
 
@@ -218,6 +219,11 @@ static inline void Gia_Sim2SimulateNode( Gia_Sim2_t * p, Gia_Obj_t * pObj )
     unsigned * pInfo0 = Gia_Sim2Data( p, Gia_ObjFaninId0(pObj, Gia_ObjValue(pObj)) );
     unsigned * pInfo1 = Gia_Sim2Data( p, Gia_ObjFaninId1(pObj, Gia_ObjValue(pObj)) );
     int w;
+    if ( (p->nWords & 1) == 0 ) // the info of each node is aligned on the 64-bit boundary
+    {
+        Util_SimdAnd( (word *)pInfo, (word *)pInfo0, (word *)pInfo1, Gia_ObjFaninC0(pObj), Gia_ObjFaninC1(pObj), p->nWords/2 );
+        return;
+    }
     if ( Gia_ObjFaninC0(pObj) )
     {
         if (  Gia_ObjFaninC1(pObj) )
@@ -0,0 +1,519 @@
+/**CFile****************************************************************
+
+  FileName    [giaSimPar.c]
+
+  SystemName  [ABC: Logic synthesis and verification system.]
+
+  PackageName [Scalable AIG package.]
+
+  Synopsis    [Multi-threaded bit-parallel simulation engine.]
+
+  Author      [Alan Mishchenko]
+
+  Affiliation [UC Berkeley]
+
+  Date        [Ver. 1.0. Started - June 20, 2005.]
+
+  Revision    [$Id: giaSimPar.c,v 1.00 2005/06/20 00:00:00 alanmi Exp $]
+
+***********************************************************************/
+
+#include "gia.h"
+#include "misc/util/utilSimd.h"
+#include "misc/util/utilTruth.h"
+
+#ifdef ABC_USE_PTHREADS
+
+#ifdef _WIN32
+#include "../lib/pthread.h"
+#else
+#include <pthread.h>
+#include <unistd.h>
+#endif
+
+#endif
+
+ABC_NAMESPACE_IMPL_START
+
+
+////////////////////////////////////////////////////////////////////////
+///                        DECLARATIONS                              ///
+////////////////////////////////////////////////////////////////////////
+
+#define PAR_THR_MAX 100
+
+// the slices of words are aligned on the cache line (8 words)
+#define GIA_SIM_PAR_LINE 8
+
+typedef struct Gia_SimParThData_t_ Gia_SimParThData_t;
+struct Gia_SimParThData_t_
+{
+    Gia_SimPar_t *   p;              // the simulation manager
+    int              iWordStart;     // the first word of the slice
+    int              iWordStop;      // the word following the slice
+};
+
+struct Gia_SimPar_t_
+{
+    Gia_Man_t *      pAig;           // the AIG
+    word *           pSims;          // simulation info (nWords for each object)
+    int              fOwnSims;       // simulation info was allocated by the manager
+    int              nWords;         // the number of words per object
+    int              nThreads;       // the number of slices (the first one is simulated by the caller)
+    Gia_SimParThData_t ThData[PAR_THR_MAX];
+#ifdef ABC_USE_PTHREADS
+    pthread_t        Threads[PAR_THR_MAX];
+    pthread_mutex_t  Mutex;          // protects the fields below
+    pthread_cond_t   CondStart;      // signals that a new round has started
+    pthread_cond_t   CondDone;       // signals that the workers are done
+#endif
+    int              iRound;         // the current round
+    int              nDone;          // the number of workers done with the current round
+    int              fStop;          // the workers should exit
+    // statistics
+    int              nRounds;        // the number of rounds simulated
+    double           nPats;          // the number of patterns simulated
+    abctime          timeSim;        // elapsed time of simulation
+};
+
+static inline word * Gia_SimParObj( Gia_SimPar_t * p, int iObj ) { return p->pSims + (size_t)iObj * p->nWords; }
+
+////////////////////////////////////////////////////////////////////////
+///                     FUNCTION DEFINITIONS                         ///
+////////////////////////////////////////////////////////////////////////
+
+/**Function*************************************************************
+
+  Synopsis    [Simulates internal nodes and COs for a slice of words.]
+
+  Description [Each slice is simulated in the topological order
+  independently of other slices, so the threads do not need barriers.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static void Gia_SimParSimulateSlice( Gia_SimPar_t * p, int iStart, int iStop )
+{
+    Gia_Man_t * pAig = p->pAig;
+    Gia_Obj_t * pObj;
+    int i, nWords = iStop - iStart;
+    word * pSim, * pSim0, * pSim1, * pSim2;
+    if ( nWords == 0 )
+        return;
+    Gia_ManForEachObj1( pAig, pObj, i )
+    {
+        if ( Gia_ObjIsCi(pObj) )
+            continue;
+        pSim  = Gia_SimParObj( p, i ) + iStart;
+        pSim0 = Gia_SimParObj( p, Gia_ObjFaninId0(pObj, i) ) + iStart;
+        if ( Gia_ObjIsCo(pObj) )
+        {
+            Util_SimdAnd( pSim, pSim0, pSim0, Gia_ObjFaninC0(pObj), Gia_ObjFaninC0(pObj), nWords );
+            continue;
+        }
+        pSim1 = Gia_SimParObj( p, Gia_ObjFaninId1(pObj, i) ) + iStart;
+        if ( Gia_ObjIsMuxId(pAig, i) )
+        {
+            pSim2 = Gia_SimParObj( p, Gia_ObjFaninId2(pAig, i) ) + iStart;
+            if ( Gia_ObjFaninC2(pAig, pObj) )
+                Util_SimdMux( pSim, pSim2, pSim0, pSim1, Gia_ObjFaninC0(pObj), Gia_ObjFaninC1(pObj), nWords );
+            else
+                Util_SimdMux( pSim, pSim2, pSim1, pSim0, Gia_ObjFaninC1(pObj), Gia_ObjFaninC0(pObj), nWords );
+        }
+        else if ( Gia_ObjIsXor(pObj) )
+            Util_SimdXor( pSim, pSim0, pSim1, Gia_ObjFaninC0(pObj) ^ Gia_ObjFaninC1(pObj), nWords );
+        else
+            Util_SimdAnd( pSim, pSim0, pSim1, Gia_ObjFaninC0(pObj), Gia_ObjFaninC1(pObj), nWords );
+    }
+}
+
+#ifdef ABC_USE_PTHREADS
+
+/**Function*************************************************************
+
+  Synopsis    [Worker thread.]
+
+  Description [Waits for a new round, simulates its slice, and reports
+  to the caller. The threads sleep between the rounds.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static void * Gia_SimParWorkerThread( void * pArg )
+{
+    Gia_SimParThData_t * pThData = (Gia_SimParThData_t *)pArg;
+    Gia_SimPar_t * p = pThData->p;
+    int iRound = 0;
+    while ( 1 )
+    {
+        pthread_mutex_lock( &p->Mutex );
+        while ( !p->fStop && p->iRound == iRound )
+            pthread_cond_wait( &p->CondStart, &p->Mutex );
+        iRound = p->iRound;
+        if ( p->fStop )
+        {
+            pthread_mutex_unlock( &p->Mutex );
+            return NULL;
+        }
+        pthread_mutex_unlock( &p->Mutex );
+        Gia_SimParSimulateSlice( p, pThData->iWordStart, pThData->iWordStop );
+        pthread_mutex_lock( &p->Mutex );
+        if ( ++p->nDone == p->nThreads - 1 )
+            pthread_cond_signal( &p->CondDone );
+        pthread_mutex_unlock( &p->Mutex );
+    }
+    return NULL;
+}
+
+#endif // pthreads are used
+
+/**Function*************************************************************
+
+  Synopsis    [Starts the simulation engine.]
+
+  Description [If pSims is not NULL, it is the user's simulation info
+  with nWords words for each object of the AIG; otherwise, the info is
+  allocated and initialized to zero. The words are divided into slices
+  aligned on the cache line, which are simulated by separate threads.
+  The number of threads may be reduced if there are not enough words.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Gia_SimPar_t * Gia_SimParStart( Gia_Man_t * pAig, word * pSims, int nWords, int nThreads )
+{
+    Gia_SimPar_t * p;
+    int i, nChunk;
+    assert( nWords > 0 );
+#ifndef ABC_USE_PTHREADS
+    nThreads = 1;
+#endif
+    nThreads = Abc_MaxInt( 1, Abc_MinInt(nThreads, PAR_THR_MAX) );
+    p = ABC_CALLOC( Gia_SimPar_t, 1 );
+    p->pAig     = pAig;
+    p->nWords   = nWords;
+    p->pSims    = pSims ? pSims : ABC_CALLOC( word, (size_t)Gia_ManObjNum(pAig) * nWords );
+    p->fOwnSims = (pSims == NULL);
+    // divide the words into slices
+    nChunk = (nWords + nThreads - 1) / nThreads;
+    nChunk = (nChunk + GIA_SIM_PAR_LINE - 1) / GIA_SIM_PAR_LINE * GIA_SIM_PAR_LINE;
+    p->nThreads = (nWords + nChunk - 1) / nChunk;
+    for ( i = 0; i < p->nThreads; i++ )
+    {
+        p->ThData[i].p          = p;
+        p->ThData[i].iWordStart = i * nChunk;
+        p->ThData[i].iWordStop  = Abc_MinInt( (i + 1) * nChunk, nWords );
+    }
+#ifdef ABC_USE_PTHREADS
+    if ( p->nThreads > 1 )
+    {
+        int status;
+        pthread_mutex_init( &p->Mutex, NULL );
+        pthread_cond_init( &p->CondStart, NULL );
+        pthread_cond_init( &p->CondDone, NULL );
+        for ( i = 1; i < p->nThreads; i++ )
+        {
+            status = pthread_create( p->Threads + i, NULL, Gia_SimParWorkerThread, (void *)(p->ThData + i) );  assert( status == 0 );
+        }
+    }
+#endif
+    return p;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Stops the simulation engine.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Gia_SimParStop( Gia_SimPar_t * p )
+{
+#ifdef ABC_USE_PTHREADS
+    if ( p->nThreads > 1 )
+    {
+        int i, status;
+        pthread_mutex_lock( &p->Mutex );
+        p->fStop = 1;
+        pthread_cond_broadcast( &p->CondStart );
+        pthread_mutex_unlock( &p->Mutex );
+        for ( i = 1; i < p->nThreads; i++ )
+        {
+            status = pthread_join( p->Threads[i], NULL );  assert( status == 0 );
+        }
+        pthread_cond_destroy( &p->CondStart );
+        pthread_cond_destroy( &p->CondDone );
+        pthread_mutex_destroy( &p->Mutex );
+    }
+#endif
+    if ( p->fOwnSims )
+        ABC_FREE( p->pSims );
+    ABC_FREE( p );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Access to the simulation info.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+word * Gia_SimParSims( Gia_SimPar_t * p, int iObj )
+{
+    return Gia_SimParObj( p, iObj );
+}
+int Gia_SimParWordNum( Gia_SimPar_t * p )
+{
+    return p->nWords;
+}
+int Gia_SimParThreadNum( Gia_SimPar_t * p )
+{
+    return p->nThreads;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Simulates one round.]
+
+  Description [Computes simulation info of internal nodes and COs
+  from the simulation info of the CIs, which is set by the user.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Gia_SimParSimulate( Gia_SimPar_t * p )
+{
+    abctime clk = Abc_ClockWall();
+#ifdef ABC_USE_PTHREADS
+    if ( p->nThreads > 1 )
+    {
+        pthread_mutex_lock( &p->Mutex );
+        p->nDone = 0;
+        p->iRound++;
+        pthread_cond_broadcast( &p->CondStart );
+        pthread_mutex_unlock( &p->Mutex );
+        // the caller simulates the first slice
+        Gia_SimParSimulateSlice( p, p->ThData[0].iWordStart, p->ThData[0].iWordStop );
+        pthread_mutex_lock( &p->Mutex );
+        while ( p->nDone < p->nThreads - 1 )
+            pthread_cond_wait( &p->CondDone, &p->Mutex );
+        pthread_mutex_unlock( &p->Mutex );
+    }
+    else
+#endif
+    Gia_SimParSimulateSlice( p, 0, p->nWords );
+    p->nRounds++;
+    p->nPats   += 64.0 * p->nWords;
+    p->timeSim += Abc_ClockWall() - clk;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Sets the CI simulation info for sequential simulation.]
+
+  Description [Assigns random info to the PIs using Gia_ManRandomW().
+  The words are generated in the order of PIs, so that the patterns
+  can be reproduced by resetting the generator.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Gia_SimParRandomPis( Gia_SimPar_t * p )
+{
+    Gia_Obj_t * pObj;
+    word * pSim;
+    int i, w;
+    Gia_ManForEachPi( p->pAig, pObj, i )
+    {
+        pSim = Gia_SimParObj( p, Gia_ObjId(p->pAig, pObj) );
+        for ( w = 0; w < p->nWords; w++ )
+            pSim[w] = Gia_ManRandomW( 0 );
+    }
+}
+void Gia_SimParResetRegs( Gia_SimPar_t * p )
+{
+    Gia_Obj_t * pObj;
+    int i;
+    Gia_ManForEachRo( p->pAig, pObj, i )
+        memset( Gia_SimParObj(p, Gia_ObjId(p->pAig, pObj)), 0, sizeof(word) * p->nWords );
+}
+void Gia_SimParTransfer( Gia_SimPar_t * p )
+{
+    Gia_Obj_t * pObjRi, * pObjRo;
+    int i;
+    Gia_ManForEachRiRo( p->pAig, pObjRi, pObjRo, i )
+        memcpy( Gia_SimParObj(p, Gia_ObjId(p->pAig, pObjRo)), Gia_SimParObj(p, Gia_ObjId(p->pAig, pObjRi)), sizeof(word) * p->nWords );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Prints statistics.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+double Gia_SimParPatsPerSec( Gia_SimPar_t * p )
+{
+    return p->timeSim > 0 ? p->nPats / ((double)p->timeSim / CLOCKS_PER_SEC) : 0;
+}
+void Gia_SimParPrintStats( Gia_SimPar_t * p )
+{
+    Abc_Print( 1, "Simulated %d rounds of %d patterns using %d thread%s.  ",
+        p->nRounds, 64 * p->nWords, p->nThreads, p->nThreads > 1 ? "s" : "" );
+    Abc_Print( 1, "Patterns/sec = %.3e.  ", Gia_SimParPatsPerSec(p) );
+    Abc_PrintTime( 1, "Time", p->timeSim );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Returns 1 if a PO is asserted in the current round.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static int Gia_SimParCheckPos( Gia_SimPar_t * p, int * piPo, int * piPat )
+{
+    Gia_Obj_t * pObj;
+    word * pSim;
+    int i, iPat;
+    Gia_ManForEachPo( p->pAig, pObj, i )
+    {
+        pSim = Gia_SimParObj( p, Gia_ObjId(p->pAig, pObj) );
+        if ( (iPat = Abc_TtFindFirstBit2(pSim, p->nWords)) >= 0 )
+        {
+            *piPo  = i;
+            *piPat = iPat;
+            return 1;
+        }
+    }
+    return 0;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Derives the counter-example by replaying the random PIs.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static Abc_Cex_t * Gia_SimParDeriveCex( Gia_SimPar_t * p, int RandSeed, int iFrame, int iPo, int iPat )
+{
+    Abc_Cex_t * pCex;
+    int f, i, w, k;
+    word Data;
+    pCex = Abc_CexAlloc( Gia_ManRegNum(p->pAig), Gia_ManPiNum(p->pAig), iFrame+1 );
+    pCex->iFrame = iFrame;
+    pCex->iPo    = iPo;
+    Gia_ManRandomW( 1 );
+    for ( k = 0; k < RandSeed; k++ )
+        Gia_ManRandomW( 0 );
+    for ( f = 0; f <= iFrame; f++ )
+    for ( i = 0; i < Gia_ManPiNum(p->pAig); i++ )
+    for ( w = 0; w < p->nWords; w++ )
+    {
+        Data = Gia_ManRandomW( 0 );
+        if ( w == iPat / 64 && ((Data >> (iPat % 64)) & 1) )
+            Abc_InfoSetBit( pCex->pData, pCex->nRegs + f * pCex->nPis + i );
+    }
+    return pCex;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Performs multi-threaded random simulation of a sequential AIG.]
+
+  Description [Similar to Gia_ManSimSimulate() but uses the engine above.
+  The registers start in the zero state.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Gia_ManSimSimulatePar( Gia_Man_t * pAig, Gia_ParSim_t * pPars )
+{
+    Gia_SimPar_t * p;
+    abctime clkTotal = Abc_ClockWall();
+    abctime nTimeToStop = pPars->TimeLimit ? pPars->TimeLimit * CLOCKS_PER_SEC + Abc_ClockWall() : 0;
+    int i, k, iPo, iPat, RetValue = 0;
+    ABC_FREE( pAig->pCexSeq );
+    p = Gia_SimParStart( pAig, NULL, pPars->nWords, pPars->nThreads );
+    Gia_ManRandomW( 1 );
+    for ( k = 0; k < pPars->RandSeed; k++ )
+        Gia_ManRandomW( 0 );
+    for ( i = 0; i < pPars->nIters; i++ )
+    {
+        Gia_SimParRandomPis( p );
+        Gia_SimParSimulate( p );
+        if ( pPars->fVerbose )
+        {
+            Abc_Print( 1, "Frame %4d out of %4d and timeout %3d sec. ", i+1, pPars->nIters, pPars->TimeLimit );
+            Abc_Print( 1, "Time = %7.2f sec\r", (1.0*Abc_ClockWall()-clkTotal)/CLOCKS_PER_SEC );
+        }
+        if ( pPars->fCheckMiter && Gia_SimParCheckPos( p, &iPo, &iPat ) )
+        {
+            pPars->iOutFail = iPo;
+            pAig->pCexSeq = Gia_SimParDeriveCex( p, pPars->RandSeed, i, iPo, iPat );
+            Abc_Print( 1, "Output %d of miter \"%s\" was asserted in frame %d.  ", iPo, pAig->pName, i );
+            if ( !Gia_ManVerifyCex( pAig, pAig->pCexSeq, 0 ) )
+                Abc_Print( 1, "\nGenerated counter-example is INVALID.                    " );
+            RetValue = 1;
+            break;
+        }
+        if ( nTimeToStop && Abc_ClockWall() > nTimeToStop )
+        {
+            i++;
+            break;
+        }
+        if ( i < pPars->nIters - 1 )
+            Gia_SimParTransfer( p );
+    }
+    if ( pPars->fVerbose )
+    {
+        Abc_Print( 1, "\n" );
+        Gia_SimParPrintStats( p );
+    }
+    Gia_SimParStop( p );
+    if ( pAig->pCexSeq == NULL )
+        Abc_Print( 1, "No bug detected after simulating %d frames with %d words.  ", i, pPars->nWords );
+    Abc_PrintTime( 1, "Time", Abc_ClockWall() - clkTotal );
+    return RetValue;
+}
+
+////////////////////////////////////////////////////////////////////////
+///                       END OF FILE                                ///
+////////////////////////////////////////////////////////////////////////
+
+
+ABC_NAMESPACE_IMPL_END
+
@@ -134,7 +134,7 @@ Spl_Man_t * Spl_ManAlloc( Gia_Man_t * pGia, int Limit, int fReverse )
     Gia_ManForEachCoId( pGia, iObj, i )
         Vec_BitWriteEntry( p->vMarksCIO, iObj, 1 );
     // mapping
-    ABC_FREE( pGia->pRefs );
+    Gia_ManAuxIntFreeP( pGia, &pGia->pRefs );
     Gia_ManCreateRefs( pGia );
     Gia_ManSetLutRefs( pGia );
     assert( Gia_ManHasMapping(pGia) );
@@ -228,7 +228,7 @@ Gia_Man_t * Gia_ManDupMuxesNoHash( Gia_Man_t * p )
     Gia_Obj_t * pObj, * pFan0, * pFan1, * pFanC;
     int i, iLit0, iLit1, fCompl;
     assert( p->pMuxes == NULL );
-    ABC_FREE( p->pRefs );
+    Gia_ManAuxIntFreeP( p, &p->pRefs );
     Gia_ManCreateRefs( p ); 
     // discount nodes with one fanout pointed to by MUX type
     Gia_ManForEachAnd( p, pObj, i )
@@ -369,7 +369,7 @@ Vec_Wec_t * Str_ManDeriveTrees( Gia_Man_t * p )
     int i, iStructId, fFound;
     assert( p->pMuxes != NULL );
     // mark MUXes whose only fanout is a MUX
-    ABC_FREE( p->pRefs );
+    Gia_ManAuxIntFreeP( p, &p->pRefs );
     Gia_ManCreateRefs( p ); 
     Gia_ManForEachMuxId( p, i )
     {
@@ -421,7 +421,7 @@ void Gia_ManCheckIntegrityWithBoxes( Gia_Man_t * p )
     int i, nCountReg = 0, nCountCarry = 0;
     if ( p->pManTime == NULL )
         return;
-    ABC_FREE( p->pRefs );
+    Gia_ManAuxIntFreeP( p, &p->pRefs );
     Gia_ManCreateRefs( p );
     for ( i = Gia_ManPoNum(p) - Gia_ManRegBoxNum(p); i < Gia_ManPoNum(p); i++ )
     {
@@ -437,7 +437,7 @@ void Gia_ManCheckIntegrityWithBoxes( Gia_Man_t * p )
     Vec_IntFree( vCarryOuts );
     if ( nCountReg || nCountCarry )
         printf( "Warning: AIG with boxes has internal fanout in %d complex flops and %d carries.\n", nCountReg, nCountCarry );
-    ABC_FREE( p->pRefs );
+    Gia_ManAuxIntFreeP( p, &p->pRefs );
 }
 
 /**Function*************************************************************
@@ -722,7 +722,7 @@ float Gia_ManEvaluateSwitching( Gia_Man_t * p )
     float SwitchTotal = 0.0;
     int i;
     assert( p->pSwitching );
-    ABC_FREE( p->pRefs );
+    Gia_ManAuxIntFreeP( p, &p->pRefs );
     Gia_ManCreateRefs( p );
     Gia_ManForEachObj( p, pObj, i )
         SwitchTotal += (float)Gia_ObjRefNum(p, pObj) * p->pSwitching[i] / 255;
@@ -394,7 +394,7 @@ Gia_Man_t * Gia_ManDupUnnormalize( Gia_Man_t * p )
     pNew->pName = Abc_UtilStrsav( p->pName );
     pNew->pSpec = Abc_UtilStrsav( p->pSpec );
     if ( Gia_ManHasChoices(p) )
-        pNew->pSibls = ABC_CALLOC( int, Gia_ManObjNum(p) );
+        pNew->pSibls = Gia_ManAuxIntStart( pNew, Gia_ManObjNum(p) );
     Gia_ManForEachObjVec( vNodes, p, pObj, i )
     {
         if ( Gia_ObjIsBuf(pObj) )
@@ -770,7 +770,7 @@ Gia_Man_t * Gia_ManDupCollapse( Gia_Man_t * p, Gia_Man_t * pBoxes, Vec_Int_t * v
     pNew->pName = Abc_UtilStrsav( p->pName );
     pNew->pSpec = Abc_UtilStrsav( p->pSpec );
     if ( Gia_ManHasChoices(p) )
-        pNew->pSibls = ABC_CALLOC( int, Gia_ManObjNum(p) );
+        pNew->pSibls = Gia_ManAuxIntStart( pNew, Gia_ManObjNum(p) );
     Gia_ManHashAlloc( pNew );
     // copy const and real PIs
     Gia_ManFillValue( p );
@@ -151,14 +151,13 @@ void Gia_ManIncrementTravId( Gia_Man_t * p )
     if ( p->pTravIds == NULL )
     {
         p->nTravIdsAlloc = Gia_ManObjNum(p) + 100; 
-        p->pTravIds = ABC_CALLOC( int, p->nTravIdsAlloc ); 
+        p->pTravIds = Gia_ManAuxIntStart( p, p->nTravIdsAlloc ); 
         p->nTravIds = 0;  
     }
     while ( p->nTravIdsAlloc < Gia_ManObjNum(p) )
     {
+        p->pTravIds = Gia_ManAuxIntGrow( p, p->pTravIds, p->nTravIdsAlloc, 2 * p->nTravIdsAlloc );
         p->nTravIdsAlloc *= 2;
-        p->pTravIds = ABC_REALLOC( int, p->pTravIds, p->nTravIdsAlloc );
-        memset( p->pTravIds + p->nTravIdsAlloc/2, 0, sizeof(int) * p->nTravIdsAlloc/2 );
     }
     p->nTravIds++;                                                    
 }
@@ -328,10 +327,39 @@ void Gia_ManCleanValue( Gia_Man_t * p )
 void Gia_ManFillValue( Gia_Man_t * p )  
 {
     int i;
+    if ( p->vObjValues )
+        Vec_IntFill( p->vObjValues, p->nObjs, ~0 );
     for ( i = 0; i < p->nObjs; i++ )
         p->pObjs[i].Value = ~0;
 }
 
+/**Function*************************************************************
+
+  Synopsis    [Starts and stops keeping the object values in a side array.]
+
+  Description [After Gia_ManObjValuesStart(), Gia_ManObjValue() and 
+  Gia_ManObjSetValue() access the side array, which has one zeroed entry 
+  for each object present at the time of the call, and do not touch the 
+  field Value of the objects. The side array starts empty: the values 
+  stored in the objects are not copied into it. Gia_ManFillValue() resets 
+  both the side array and the field Value, so that the code reading 
+  pObj->Value directly never sees stale values.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Gia_ManObjValuesStart( Gia_Man_t * p )  
+{
+    if ( p->vObjValues == NULL )
+        p->vObjValues = Vec_IntStart( p->nObjs );
+}
+void Gia_ManObjValuesStop( Gia_Man_t * p )  
+{
+    Vec_IntFreeP( &p->vObjValues );
+}
+
 /**Function*************************************************************
 
   Synopsis    [Sets the phase of one object.]
@@ -717,7 +745,7 @@ void Gia_ManCreateRefs( Gia_Man_t * p )
     Gia_Obj_t * pObj;
     int i;
     assert( p->pRefs == NULL );
-    p->pRefs = ABC_CALLOC( int, Gia_ManObjNum(p) );
+    p->pRefs = Gia_ManAuxIntStart( p, Gia_ManObjNum(p) );
     Gia_ManForEachObj( p, pObj, i )
     {
         if ( Gia_ObjIsAnd(pObj) )
@@ -1780,7 +1808,7 @@ int Gia_ManHasChoices_very_old( Gia_Man_t * p )
     // check if there are any internal nodes without fanout
     // make sure all nodes without fanout have representatives
     // make sure all nodes with fanout have no representatives
-    ABC_FREE( p->pRefs );
+    Gia_ManAuxIntFreeP( p, &p->pRefs );
     Gia_ManCreateRefs( p );
     Gia_ManForEachAnd( p, pObj, i )
     {
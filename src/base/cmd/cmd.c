@@ -835,6 +835,8 @@ int CmdCommandSetVariable( Abc_Frame_t * pAbc, int argc, char **argv )
                     pAbc->Hst = NULL;
             }
         }
+        if ( strcmp( argv[1], "gia_arena" ) == 0 )
+            Gia_ManArenaSetDefault( strcmp( flag_value, "0" ) != 0 );
         return 0;
     }
 
@@ -890,6 +892,8 @@ int CmdCommandUnsetVariable( Abc_Frame_t * pAbc, int argc, char **argv )
             ABC_FREE( key );
             ABC_FREE( value );
         }
+        if ( strcmp( argv[i], "gia_arena" ) == 0 )
+            Gia_ManArenaSetDefault( 0 );
     }
     return 0;
 
@@ -294,7 +294,7 @@ Vec_Int_t * Abc_ManExpandCex( Gia_Man_t * pGia, Vec_Int_t * vCex )
     Gia_ManForEachRo( pGia, pObj, i )
         Vec_IntPush( vCexNew, 0 );
 
-    ABC_FREE( pGia->pRefs );
+    Gia_ManAuxIntFreeP( pGia, &pGia->pRefs );
     Gia_ManCreateRefs( pGia );
     k = Gia_ManRegNum( pGia );
     while ( 1 )
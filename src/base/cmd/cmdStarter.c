@@ -24,6 +24,7 @@
 #include <assert.h>
 #include "misc/util/abc_global.h"
 #include "misc/extra/extra.h"
+#include "misc/util/utilTask.h"
 
 #ifdef ABC_USE_PTHREADS
 
@@ -48,12 +49,6 @@ void Cmd_RunStarter( char * pFileName, char * pBinary, char * pCommand, int nCor
 
 #else // pthreads are used
 
-// the number of concurrently running threads
-static volatile int nThreadsRunning = 0;
-
-// mutex to control access to the number of threads
-pthread_mutex_t mutex = PTHREAD_MUTEX_INITIALIZER;
-
 ////////////////////////////////////////////////////////////////////////
 ///                     FUNCTION DEFINITIONS                         ///
 ////////////////////////////////////////////////////////////////////////
@@ -71,7 +66,6 @@ pthread_mutex_t mutex = PTHREAD_MUTEX_INITIALIZER;
 ***********************************************************************/
 void * Abc_RunThread( void * pCommand )
 {
-    int status;
     // perform the call
     if ( system( (char *)pCommand ) )
     {
@@ -79,18 +73,8 @@ void * Abc_RunThread( void * pCommand )
         fprintf( stderr, "\"%s\"\n\n", (char *)pCommand );
         fflush( stdout );
     }
-    free( pCommand );
-
-    // decrement the number of threads runining 
-    status = pthread_mutex_lock(&mutex);   assert(status == 0);
-    nThreadsRunning--;
-    status = pthread_mutex_unlock(&mutex); assert(status == 0);
-
-    // quit this thread
-	//printf("...Finishing %s\n", (char *)Command);
-	pthread_exit( NULL );
-	assert(0);
-	return NULL;
+    ABC_FREE( pCommand );
+    return NULL;
 }
 
 /**Function*************************************************************
@@ -107,11 +91,11 @@ void * Abc_RunThread( void * pCommand )
 void Cmd_RunStarter( char * pFileName, char * pBinary, char * pCommand, int nCores )
 {
     FILE * pFile, * pFileTemp;
-	pthread_t * pThreadIds;
+    Util_Pool_t * pPool;
     char * BufferCopy, * Buffer;
     int nLines, LineMax, Line, Len;
-	int i, c, status, Counter;
-    abctime clk = Abc_Clock();
+	int i, c;
+    abctime clk = Abc_ClockWall();
 
     // check the number of cores
     if ( nCores < 2 )
@@ -146,7 +130,6 @@ void Cmd_RunStarter( char * pFileName, char * pBinary, char * pCommand, int nCor
 
     // allocate storage
     Buffer = ABC_ALLOC( char, LineMax );
-    pThreadIds = ABC_ALLOC( pthread_t, nLines );
 
     // check if all files can be opened
     if ( pCommand != NULL )
@@ -172,7 +155,6 @@ void Cmd_RunStarter( char * pFileName, char * pBinary, char * pCommand, int nCor
             {
                 fprintf( stdout, "Starter cannot open file \"%s\".\n", Buffer );
                 fflush( stdout );
-                ABC_FREE( pThreadIds );
                 ABC_FREE( Buffer );
                 fclose( pFile );
                 return;
@@ -181,6 +163,7 @@ void Cmd_RunStarter( char * pFileName, char * pBinary, char * pCommand, int nCor
     } 
  
     // read commands and execute at most <num> of them at a time
+    pPool = Util_PoolStart( nCores - 1 );
     rewind( pFile );
     for ( i = 0; fgets( Buffer, LineMax, pFile ) != NULL; i++ )
     {
@@ -206,45 +189,21 @@ void Cmd_RunStarter( char * pFileName, char * pBinary, char * pCommand, int nCor
         fprintf( stdout, "Calling:  %s\n", (char *)BufferCopy );  
         fflush( stdout );
 
-        // wait till there is an empty thread
-        while ( 1 )
-        {
-            status = pthread_mutex_lock(&mutex);   assert(status == 0);
-            Counter = nThreadsRunning;
-            status = pthread_mutex_unlock(&mutex); assert(status == 0);
-            if ( Counter < nCores - 1 )
-                break;
-//            Sleep( 100 );
-        }
-
-        // increament the number of threads running
-        status = pthread_mutex_lock(&mutex);   assert(status == 0);
-        nThreadsRunning++;
-        status = pthread_mutex_unlock(&mutex); assert(status == 0);
-
-        // create thread to execute this command
-        status = pthread_create( &pThreadIds[i], NULL, Abc_RunThread, (void *)BufferCopy );  assert(status == 0);
+        // the pool runs the command as soon as one of the workers is free
+        Util_PoolSpawn( pPool, Abc_RunThread, (void *)BufferCopy );
         assert( i < nLines );
     }
-    ABC_FREE( pThreadIds );
     ABC_FREE( Buffer );
     fclose( pFile );
 
-    // wait for all the threads to finish
-    while ( 1 )
-    {
-        status = pthread_mutex_lock(&mutex);   assert(status == 0);
-        Counter = nThreadsRunning;
-        status = pthread_mutex_unlock(&mutex); assert(status == 0);
-        if ( Counter == 0 )
-            break;
-    }
+    // wait for all the commands to finish
+    Util_PoolStop( pPool );
 
     // cleanup
 //    status = pthread_mutex_destroy(&mutex);   assert(status == 0);
 //    mutex = PTHREAD_MUTEX_INITIALIZER;
     fprintf( stdout, "Finished processing commands in file \"%s\".  ", pFileName );
-    Abc_PrintTime( 1, "Total wall time", Abc_Clock() - clk );
+    Abc_PrintTime( 1, "Total wall time", Abc_ClockWall() - clk );
     fflush( stdout );
 }
 
@@ -81,6 +81,7 @@ typedef struct If_Set_t_     If_Set_t;
 typedef struct If_LibLut_t_  If_LibLut_t;
 typedef struct If_LibBox_t_  If_LibBox_t;
 typedef struct If_DsdMan_t_  If_DsdMan_t;
+typedef struct If_CellCache_t_ If_CellCache_t;
 typedef struct Ifn_Ntk_t_    Ifn_Ntk_t;
 
 typedef struct Ifif_Par_t_   Ifif_Par_t;
@@ -110,6 +111,7 @@ struct If_Par_t_
     float              Epsilon;       // value used in comparison floating point numbers
     int                nRelaxRatio;   // delay relaxation ratio
     int                nStructType;   // type of the structure
+    int                nThreads;      // the number of threads for cut computation
     int                nAndDelay;     // delay of AND-gate in LUT library units
     int                nAndArea;      // area of AND-gate in LUT library units
     int                fPreprocess;   // preprossing
@@ -144,6 +146,7 @@ struct If_Par_t_
     int                fHashMapping;  // perform AIG hashing after mapping
     int                fVerbose;      // the verbosity flag
     char *             pLutStruct;    // LUT structure
+    char *             pCacheFile;    // the file with the results of the LUT structure checks
     float              WireDelay;     // wire delay
     // internal parameters
     int                fSkipCutFilter;// skip cut filter
@@ -196,6 +199,7 @@ struct If_Man_t_
     Vec_Ptr_t *        vCos;          // the primary outputs
     Vec_Ptr_t *        vObjs;         // all objects
     Vec_Ptr_t *        vObjsRev;      // reverse topological order of objects
+    Vec_Wec_t *        vLevels;       // internal nodes by level (parallel mapping)
     Vec_Ptr_t *        vTemp;         // temporary array
     int                nObjs[IF_VOID];// the number of objects by type
     // various data
@@ -255,6 +259,8 @@ struct If_Man_t_
     Vec_Str_t *        vTtPerms[IF_MAX_FUNC_LUTSIZE+1]; // mapping of truth table into permutations
     Vec_Str_t *        vTtVars[IF_MAX_FUNC_LUTSIZE+1];  // mapping of truth table into selected vars
     Vec_Int_t *        vTtDecs[IF_MAX_FUNC_LUTSIZE+1];  // mapping of truth table into decomposition pattern
+    Vec_Str_t *        vTtCells[IF_MAX_FUNC_LUTSIZE+1]; // mapping of truth table into the result of the LUT structure check
+    If_CellCache_t *   pCellCache;    // the results of the LUT structure checks saved between the runs
     Vec_Int_t *        vTtOccurs[IF_MAX_FUNC_LUTSIZE+1];// truth table occurange counters
     Hash_IntMan_t *    vPairHash;     // hashing pairs of truth tables
     Vec_Int_t *        vPairRes;      // resulting truth table
@@ -500,6 +506,17 @@ static inline float      If_CutLutDelay( If_LibLut_t * p, int Size, int iPin )
 ///                    FUNCTION DECLARATIONS                         ///
 ////////////////////////////////////////////////////////////////////////
 
+/*=== ifCache.c ==========================================================*/
+extern If_CellCache_t * If_CellCacheAlloc( char * pSign );
+extern void            If_CellCacheFree( If_CellCache_t * p );
+extern int             If_CellCacheLookup( If_CellCache_t * p, word * pTruth, int nVars );
+extern void            If_CellCacheInsert( If_CellCache_t * p, word * pTruth, int nVars, int Value );
+extern If_CellCache_t * If_CellCacheLoad( char * pFileName, char * pSign );
+extern int             If_CellCacheSave( If_CellCache_t * p, char * pFileName );
+extern void            If_CellCachePrint( If_CellCache_t * p );
+extern void            If_ManCellCacheStart( If_Man_t * p );
+extern void            If_ManCellCacheStop( If_Man_t * p );
+extern int             If_CutCheckCell( If_Man_t * p, If_Cut_t * pCut );
 /*=== ifCore.c ===========================================================*/
 extern void            If_ManSetDefaultPars( If_Par_t * pPars );
 extern int             If_ManPerformMapping( If_Man_t * p );
@@ -626,9 +643,13 @@ extern void            If_ManDerefChoiceCutSet( If_Man_t * p, If_Obj_t * pObj );
 extern void            If_ManSetupSetAll( If_Man_t * p, int nCrossCut );
 /*=== ifMap.c =============================================================*/
 extern int *           If_CutArrTimeProfile( If_Man_t * p, If_Cut_t * pCut );
+extern void            If_ObjPerformMappingAndCuts( If_Man_t * p, If_Obj_t * pObj, int Mode, int fPreprocess, int fFirst );
 extern void            If_ObjPerformMappingAnd( If_Man_t * p, If_Obj_t * pObj, int Mode, int fPreprocess, int fFirst );
 extern void            If_ObjPerformMappingChoice( If_Man_t * p, If_Obj_t * pObj, int Mode, int fPreprocess );
 extern int             If_ManPerformMappingRound( If_Man_t * p, int nCutsUsed, int Mode, int fPreprocess, int fFirst, char * pLabel );
+/*=== ifMapPar.c ==========================================================*/
+extern int             If_ManSetupLevels( If_Man_t * p );
+extern int             If_ManPerformMappingRoundPar( If_Man_t * p, int Mode, int fPreprocess, int fFirst );
 /*=== ifReduce.c ==========================================================*/
 extern void            If_ManImproveMapping( If_Man_t * p );
 /*=== ifSat.c ==========================================================*/
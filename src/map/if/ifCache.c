@@ -6,7 +6,7 @@
 
   PackageName [FPGA mapping based on priority cuts.]
 
-  Synopsis    []
+  Synopsis    [Caching the results of cut function processing.]
 
   Author      [Alan Mishchenko]
   
@@ -27,6 +27,20 @@ ABC_NAMESPACE_IMPL_START
 ///                        DECLARATIONS                              ///
 ////////////////////////////////////////////////////////////////////////
 
+#define IF_CELL_MAGIC   "IFCC"   // the first bytes of the cache file
+#define IF_CELL_VERSION 1        // the version of the file format
+
+// the results of the LUT structure checks indexed by the truth tables
+struct If_CellCache_t_
+{
+    char *             pSign;        // the parameters of the check
+    Vec_Mem_t *        vTtMem[IF_MAX_FUNC_LUTSIZE+1]; // the truth tables
+    Vec_Str_t *        vRes[IF_MAX_FUNC_LUTSIZE+1];   // the results of the check
+    int                nLookups;     // the number of lookups
+    int                nHits;        // the number of successful lookups
+    int                nAdded;       // the number of entries added after loading
+};
+
 ////////////////////////////////////////////////////////////////////////
 ///                     FUNCTION DEFINITIONS                         ///
 ////////////////////////////////////////////////////////////////////////
@@ -91,6 +105,295 @@ void If_ManCacheAnalize( If_Man_t * p )
     Vec_IntFree( vRes );
 }
 
+/**Function*************************************************************
+
+  Synopsis    [Starts and stops the cache of LUT structure checks.]
+
+  Description [The signature is the string representing the parameters
+  of the check. The cached results can only be used with the same
+  signature.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+If_CellCache_t * If_CellCacheAlloc( char * pSign )
+{
+    If_CellCache_t * p = ABC_CALLOC( If_CellCache_t, 1 );
+    p->pSign = Abc_UtilStrsav( pSign );
+    return p;
+}
+void If_CellCacheFree( If_CellCache_t * p )
+{
+    int v;
+    for ( v = 0; v <= IF_MAX_FUNC_LUTSIZE; v++ )
+    {
+        if ( p->vTtMem[v] )
+            Vec_MemHashFree( p->vTtMem[v] );
+        Vec_MemFreeP( &p->vTtMem[v] );
+        Vec_StrFreeP( &p->vRes[v] );
+    }
+    ABC_FREE( p->pSign );
+    ABC_FREE( p );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Looks up and adds the result of the check.]
+
+  Description [The truth table has nVars variables. Lookup returns -1
+  if the truth table is not in the cache.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int If_CellCacheLookup( If_CellCache_t * p, word * pTruth, int nVars )
+{
+    int * pSpot;
+    assert( nVars <= IF_MAX_FUNC_LUTSIZE );
+    p->nLookups++;
+    if ( p->vTtMem[nVars] == NULL )
+        return -1;
+    pSpot = Vec_MemHashLookup( p->vTtMem[nVars], pTruth );
+    if ( *pSpot == -1 )
+        return -1;
+    p->nHits++;
+    return (int)Vec_StrEntry( p->vRes[nVars], *pSpot );
+}
+void If_CellCacheInsert( If_CellCache_t * p, word * pTruth, int nVars, int Value )
+{
+    int iEntry;
+    assert( nVars <= IF_MAX_FUNC_LUTSIZE );
+    assert( Value == 0 || Value == 1 );
+    if ( p->vTtMem[nVars] == NULL )
+    {
+        p->vTtMem[nVars] = Vec_MemAlloc( Abc_Truth6WordNum(nVars), 12 );
+        Vec_MemHashAlloc( p->vTtMem[nVars], 1000 );
+        p->vRes[nVars] = Vec_StrAlloc( 1000 );
+    }
+    iEntry = Vec_MemHashInsert( p->vTtMem[nVars], pTruth );
+    if ( iEntry == Vec_StrSize(p->vRes[nVars]) )
+    {
+        Vec_StrPush( p->vRes[nVars], (char)Value );
+        p->nAdded++;
+    }
+    assert( Vec_StrEntry(p->vRes[nVars], iEntry) == (char)Value );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Reads the cache from file.]
+
+  Description [Returns NULL if the file does not exist, cannot be read,
+  contains an invalid entry, or was written for the check with a different 
+  signature. In this case, the caller starts with an empty cache.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+If_CellCache_t * If_CellCacheLoad( char * pFileName, char * pSign )
+{
+    If_CellCache_t * p;
+    word pTruth[1 << (IF_MAX_FUNC_LUTSIZE-6)];
+    char pMagic[4], * pSignFile;
+    int v, i, Version, nSign, nEntries, nWords, RetValue = 1;
+    FILE * pFile = fopen( pFileName, "rb" );
+    if ( pFile == NULL )
+        return NULL;
+    RetValue &= (fread( pMagic, 1, 4, pFile ) == 4);
+    RetValue &= (fread( &Version, sizeof(int), 1, pFile ) == 1);
+    RetValue &= (fread( &nSign, sizeof(int), 1, pFile ) == 1);
+    if ( !RetValue || strncmp(pMagic, IF_CELL_MAGIC, 4) || Version != IF_CELL_VERSION || nSign < 0 || nSign > 1000 )
+    {
+        printf( "File \"%s\" is not a cache of LUT structure checks.\n", pFileName );
+        fclose( pFile );
+        return NULL;
+    }
+    pSignFile = ABC_CALLOC( char, nSign + 1 );
+    RetValue &= ((int)fread( pSignFile, 1, nSign, pFile ) == nSign);
+    if ( !RetValue || strcmp(pSignFile, pSign) )
+    {
+        printf( "File \"%s\" was written for other parameters (%s) and will be overwritten.\n", pFileName, pSignFile );
+        ABC_FREE( pSignFile );
+        fclose( pFile );
+        return NULL;
+    }
+    ABC_FREE( pSignFile );
+    p = If_CellCacheAlloc( pSign );
+    for ( v = 0; RetValue && v <= IF_MAX_FUNC_LUTSIZE; v++ )
+    {
+        RetValue &= (fread( &nEntries, sizeof(int), 1, pFile ) == 1);
+        RetValue &= (nEntries >= 0);
+        nWords = Abc_Truth6WordNum( v );
+        for ( i = 0; RetValue && i < nEntries; i++ )
+        {
+            char Value;
+            RetValue &= ((int)fread( pTruth, sizeof(word), nWords, pFile ) == nWords);
+            RetValue &= (fread( &Value, 1, 1, pFile ) == 1);
+            RetValue &= (Value == 0 || Value == 1);
+            if ( RetValue )
+                If_CellCacheInsert( p, pTruth, v, (int)Value );
+        }
+    }
+    fclose( pFile );
+    if ( !RetValue )
+    {
+        printf( "Reading cache from file \"%s\" has failed. Starting with an empty cache.\n", pFileName );
+        If_CellCacheFree( p );
+        return NULL;
+    }
+    p->nAdded = 0;
+    return p;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Writes the cache into file.]
+
+  Description [Returns 1 if the file has been written successfully.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int If_CellCacheSave( If_CellCache_t * p, char * pFileName )
+{
+    word * pTruth;
+    int v, i, nEntries, nSign = strlen(p->pSign), Version = IF_CELL_VERSION, RetValue = 1;
+    FILE * pFile = fopen( pFileName, "wb" );
+    if ( pFile == NULL )
+    {
+        printf( "Cannot open file \"%s\" for writing.\n", pFileName );
+        return 0;
+    }
+    RetValue &= (fwrite( IF_CELL_MAGIC, 1, 4, pFile ) == 4);
+    RetValue &= (fwrite( &Version, sizeof(int), 1, pFile ) == 1);
+    RetValue &= (fwrite( &nSign, sizeof(int), 1, pFile ) == 1);
+    RetValue &= ((int)fwrite( p->pSign, 1, nSign, pFile ) == nSign);
+    for ( v = 0; v <= IF_MAX_FUNC_LUTSIZE; v++ )
+    {
+        nEntries = p->vTtMem[v] ? Vec_MemEntryNum(p->vTtMem[v]) : 0;
+        RetValue &= (fwrite( &nEntries, sizeof(int), 1, pFile ) == 1);
+        if ( nEntries == 0 )
+            continue;
+        Vec_MemForEachEntry( p->vTtMem[v], pTruth, i )
+        {
+            RetValue &= ((int)fwrite( pTruth, sizeof(word), Abc_Truth6WordNum(v), pFile ) == Abc_Truth6WordNum(v));
+            RetValue &= (fwrite( Vec_StrEntryP(p->vRes[v], i), 1, 1, pFile ) == 1);
+        }
+    }
+    RetValue &= (fclose( pFile ) == 0);
+    if ( !RetValue )
+        printf( "Writing cache into file \"%s\" has failed.\n", pFileName );
+    return RetValue;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Prints statistics of the cache.]
+
+  Description []
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void If_CellCachePrint( If_CellCache_t * p )
+{
+    int v, nEntries = 0;
+    for ( v = 0; v <= IF_MAX_FUNC_LUTSIZE; v++ )
+        nEntries += p->vTtMem[v] ? Vec_MemEntryNum(p->vTtMem[v]) : 0;
+    printf( "Check cache:  Entries = %d. (New = %d.)  Lookups = %d.  Hits = %d. (%6.2f %%)\n", 
+        nEntries, p->nAdded, p->nLookups, p->nHits, 100.0*p->nHits/Abc_MaxInt(1, p->nLookups) );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Prepares caching of the LUT structure checks.]
+
+  Description [The results of the check (pPars->pFuncCell) are recorded
+  for each truth table ID, so that the check is performed once for each
+  function, rather than once for each cut in each mapping round.
+  If the cache file is given, the results are also loaded from the file
+  before mapping and saved into it after mapping.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void If_ManCellCacheStart( If_Man_t * p )
+{
+    If_Par_t * pPars = p->pPars;
+    char pSign[1000];
+    int v;
+    if ( pPars->pFuncCell == NULL || pPars->pFuncCell2 || pPars->fUseDsd || !pPars->fTruth )
+        return;
+    for ( v = 0; v <= pPars->nLutSize; v++ )
+        p->vTtCells[v] = Vec_StrAlloc( 1000 );
+    if ( pPars->pCacheFile == NULL )
+        return;
+    sprintf( pSign, "K=%d S=%s f07=%d f75=%d f75u=%d m=%d z=%d b=%d", pPars->nLutSize, pPars->pLutStruct ? pPars->pLutStruct : "none",
+        pPars->fEnableCheck07, pPars->fEnableCheck75, pPars->fEnableCheck75u, pPars->fCutMin, pPars->fDeriveLuts, pPars->fUseBat );
+    p->pCellCache = If_CellCacheLoad( pPars->pCacheFile, pSign );
+    if ( p->pCellCache == NULL )
+        p->pCellCache = If_CellCacheAlloc( pSign );
+}
+void If_ManCellCacheStop( If_Man_t * p )
+{
+    int v;
+    for ( v = 0; v <= IF_MAX_FUNC_LUTSIZE; v++ )
+        Vec_StrFreeP( &p->vTtCells[v] );
+    if ( p->pCellCache == NULL )
+        return;
+    if ( p->pPars->fVerbose )
+        If_CellCachePrint( p->pCellCache );
+    if ( p->pCellCache->nAdded > 0 )
+        If_CellCacheSave( p->pCellCache, p->pPars->pCacheFile );
+    If_CellCacheFree( p->pCellCache );
+    p->pCellCache = NULL;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Returns 1 if the cut function fits into the LUT structure.]
+
+  Description [Looks up the result of the check by the truth table ID
+  and, if it is not available, in the cache loaded from file.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int If_CutCheckCell( If_Man_t * p, If_Cut_t * pCut )
+{
+    Vec_Str_t * vCells = p->vTtCells[pCut->nLeaves];
+    int Value = -1, iLit = pCut->iCutFunc;
+    if ( vCells == NULL || iLit < 0 )
+        return p->pPars->pFuncCell( p, If_CutTruth(p, pCut), Abc_MaxInt(6, pCut->nLeaves), pCut->nLeaves, p->pPars->pLutStruct );
+    if ( iLit < Vec_StrSize(vCells) && (Value = (int)Vec_StrEntry(vCells, iLit)) != -1 )
+        return Value;
+    if ( p->pCellCache )
+        Value = If_CellCacheLookup( p->pCellCache, If_CutTruthW(p, pCut), pCut->nLeaves );
+    if ( Value == -1 )
+    {
+        Value = (p->pPars->pFuncCell( p, If_CutTruth(p, pCut), Abc_MaxInt(6, pCut->nLeaves), pCut->nLeaves, p->pPars->pLutStruct ) != 0);
+        if ( p->pCellCache )
+            If_CellCacheInsert( p->pCellCache, If_CutTruthW(p, pCut), pCut->nLeaves, Value );
+    }
+    Vec_StrFillExtra( vCells, iLit + 1, (char)-1 );
+    Vec_StrWriteEntry( vCells, iLit, (char)Value );
+    return Value;
+}
+
 ////////////////////////////////////////////////////////////////////////
 ///                       END OF FILE                                ///
 ////////////////////////////////////////////////////////////////////////
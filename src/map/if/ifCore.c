@@ -83,7 +83,7 @@ int If_ManPerformMapping( If_Man_t * p )
     // create the CI cutsets
     If_ManSetupCiCutSets( p );
     // allocate memory for other cutsets
-    If_ManSetupSetAll( p, If_ManCrossCut(p) );
+    If_ManSetupSetAll( p, Abc_MaxInt(If_ManCrossCut(p), If_ManSetupLevels(p)) );
     // derive reverse top order
     p->vObjsRev = If_ManReverseOrder( p );
     return If_ManPerformMappingComb( p );
@@ -104,7 +104,7 @@ int If_ManPerformMapping( If_Man_t * p )
 int If_ManPerformMappingComb( If_Man_t * p )
 {
     If_Obj_t * pObj;
-    abctime clkTotal = Abc_Clock();
+    abctime clkTotal = Abc_ClockWall();
     int i;
 
     // set arrival times and fanout estimates
@@ -158,10 +158,10 @@ int If_ManPerformMappingComb( If_Man_t * p )
 //        Abc_Print( 1, "Total memory = %7.2f MB. Peak cut memory = %7.2f MB.  ", 
 //            1.0 * (p->nObjBytes + 2*sizeof(void *)) * If_ManObjNum(p) / (1<<20), 
 //            1.0 * p->nSetBytes * Mem_FixedReadMaxEntriesUsed(p->pMemSet) / (1<<20) );
-        Abc_PrintTime( 1, "Total time", Abc_Clock() - clkTotal );
+        Abc_PrintTime( 1, "Total time", Abc_ClockWall() - clkTotal );
     }
 //    Abc_Print( 1, "Cross cut memory = %d.\n", Mem_FixedReadMaxEntriesUsed(p->pMemSet) );
-    s_MappingTime = Abc_Clock() - clkTotal;
+    s_MappingTime = Abc_ClockWall() - clkTotal;
 //    Abc_Print( 1, "Special POs = %d.\n", If_ManCountSpecialPos(p) );
 
 /*
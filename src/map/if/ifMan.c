@@ -163,6 +163,7 @@ If_Man_t * If_ManStart( If_Par_t * pPars )
         Bat_ManFuncSetupTable();
 //        Abc_PrintTime( 1, "Setup time", Abc_Clock() - clk );
     }
+    If_ManCellCacheStart( p );
     // create the constant node
     p->pConst1   = If_ManSetupObj( p );
     p->pConst1->Type   = IF_CONST1;
@@ -258,6 +259,7 @@ void If_ManStop( If_Man_t * p )
     Vec_WrdFreeP( &p->vAndGate );
     Vec_WrdFreeP( &p->vOrGate );
     Vec_PtrFreeP( &p->vObjsRev );
+    Vec_WecFreeP( &p->vLevels );
     Vec_PtrFreeP( &p->vLatchOrder );
     Vec_IntFreeP( &p->vLags );
     Vec_IntFreeP( &p->vDump );
@@ -269,6 +271,7 @@ void If_ManStop( If_Man_t * p )
         Vec_StrFreeP( &p->vTtVars[i] );
     for ( i = 6; i <= Abc_MaxInt(6,p->pPars->nLutSize); i++ )
         Vec_IntFreeP( &p->vTtDecs[i] );
+    If_ManCellCacheStop( p );
     Vec_IntFreeP( &p->vCutData );
     Vec_IntFreeP( &p->vPairRes );
     Vec_StrFreeP( &p->vPairPerms );
@@ -152,14 +152,16 @@ int * If_CutArrTimeProfile( If_Man_t * p, If_Cut_t * pCut )
 
   Synopsis    [Finds the best cut for the given node.]
 
-  Description [Mapping modes: delay (0), area flow (1), area (2).]
+  Description [Mapping modes: delay (0), area flow (1), area (2).
+  The cutset of the node should be already allocated. The cutsets 
+  of the node and its fanins are released by the caller.]
                
   SideEffects []
 
   SeeAlso     []
 
 ***********************************************************************/
-void If_ObjPerformMappingAnd( If_Man_t * p, If_Obj_t * pObj, int Mode, int fPreprocess, int fFirst )
+void If_ObjPerformMappingAndCuts( If_Man_t * p, If_Obj_t * pObj, int Mode, int fPreprocess, int fFirst )
 {
     If_Set_t * pCutSet;
     If_Cut_t * pCut0, * pCut1, * pCut;
@@ -181,8 +183,8 @@ void If_ObjPerformMappingAnd( If_Man_t * p, If_Obj_t * pObj, int Mode, int fPrep
     if ( Mode && pObj->nRefs > 0 )
         If_CutAreaDeref( p, If_ObjCutBest(pObj) );
 
-    // prepare the cutset
-    pCutSet = If_ManSetupNodeCutSet( p, pObj );
+    // get the cutset
+    pCutSet = pObj->pCutSet;
 
     // get the current assigned best cut
     pCut = If_ObjCutBest(pObj);
@@ -321,7 +323,7 @@ void If_ObjPerformMappingAnd( If_Man_t * p, If_Obj_t * pObj, int Mode, int fPrep
                 else if ( p->pPars->pFuncCell2 )
                     pCut->fUseless = !p->pPars->pFuncCell2( p, (word *)If_CutTruthW(p, pCut), pCut->nLeaves, NULL, NULL );
                 else
-                    pCut->fUseless = !p->pPars->pFuncCell( p, If_CutTruth(p, pCut), Abc_MaxInt(6, pCut->nLeaves), pCut->nLeaves, p->pPars->pLutStruct );
+                    pCut->fUseless = !If_CutCheckCell( p, pCut );
                 p->nCutsUselessAll += pCut->fUseless;
                 p->nCutsUseless[pCut->nLeaves] += pCut->fUseless;
                 p->nCutsCountAll++;
@@ -485,6 +487,13 @@ void If_ObjPerformMappingAnd( If_Man_t * p, If_Obj_t * pObj, int Mode, int fPrep
     if ( p->pPars->pFuncUser )
         If_ObjForEachCut( pObj, pCut, i )
             p->pPars->pFuncUser( p, pObj, pCut );
+}
+void If_ObjPerformMappingAnd( If_Man_t * p, If_Obj_t * pObj, int Mode, int fPreprocess, int fFirst )
+{
+    // prepare the cutset
+    If_ManSetupNodeCutSet( p, pObj );
+    // compute the cuts
+    If_ObjPerformMappingAndCuts( p, pObj, Mode, fPreprocess, fFirst );
     // free the cuts
     If_ManDerefNodeCutSet( p, pObj );
 }
@@ -589,7 +598,7 @@ int If_ManPerformMappingRound( If_Man_t * p, int nCutsUsed, int Mode, int fPrepr
     ProgressBar * pProgress = NULL;
     If_Obj_t * pObj;
     int i;
-    abctime clk = Abc_Clock();
+    abctime clk = Abc_ClockWall();
     float arrTime;
     assert( Mode >= 0 && Mode <= 2 );
     p->nBestCutSmall[0] = p->nBestCutSmall[1] = 0;
@@ -637,7 +646,7 @@ int If_ManPerformMappingRound( If_Man_t * p, int nCutsUsed, int Mode, int fPrepr
         }
 //        Tim_ManPrint( p->pManTim );
     }
-    else
+    else if ( !If_ManPerformMappingRoundPar( p, Mode, fPreprocess, fFirst ) )
     {
         pProgress = Extra_ProgressBarStart( stdout, If_ManObjNum(p) );
         If_ManForEachNode( p, pObj, i )
@@ -663,7 +672,7 @@ int If_ManPerformMappingRound( If_Man_t * p, int nCutsUsed, int Mode, int fPrepr
         if ( p->dPower )
         Abc_Print( 1, "Switch = %7.2f.  ", p->dPower );
         Abc_Print( 1, "Cut = %8d.  ", p->nCutsMerged );
-        Abc_PrintTime( 1, "T", Abc_Clock() - clk );
+        Abc_PrintTime( 1, "T", Abc_ClockWall() - clk );
 //    Abc_Print( 1, "Max number of cuts = %d. Average number of cuts = %5.2f.\n", 
 //        p->nCutsMax, 1.0 * p->nCutsMerged / If_ManAndNum(p) );
     }
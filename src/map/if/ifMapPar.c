@@ -0,0 +1,249 @@
+/**CFile****************************************************************
+
+  FileName    [ifMapPar.c]
+
+  SystemName  [ABC: Logic synthesis and verification system.]
+
+  PackageName [FPGA mapping based on priority cuts.]
+
+  Synopsis    [Level-parallel computation of priority cuts.]
+
+  Author      [Alan Mishchenko]
+
+  Affiliation [UC Berkeley]
+
+  Date        [Ver. 1.0. Started - November 21, 2006.]
+
+  Revision    [$Id: ifMapPar.c,v 1.00 2006/11/21 00:00:00 alanmi Exp $]
+
+***********************************************************************/
+
+#include "if.h"
+#include "misc/util/utilTask.h"
+
+ABC_NAMESPACE_IMPL_START
+
+////////////////////////////////////////////////////////////////////////
+///                        DECLARATIONS                              ///
+////////////////////////////////////////////////////////////////////////
+
+#define PAR_THR_MAX      100
+#define IF_PAR_CHUNK      64     // the number of nodes in one task
+#define IF_PAR_LEVEL_MIN 256     // smaller levels are mapped by the caller
+
+typedef struct If_ParMan_t_ If_ParMan_t;
+typedef struct If_ParTask_t_
+{
+    If_ParMan_t *    pPar;       // the parallel manager
+    Vec_Int_t *      vLevel;     // the nodes of the level
+    int              iStart;     // the first node
+    int              iStop;      // the node after the last one
+} If_ParTask_t;
+
+struct If_ParMan_t_
+{
+    If_Man_t *       p;          // the mapping manager
+    If_Man_t *       pCopies;    // the copies of the manager used by the workers
+    Util_Pool_t *    pPool;      // the task pool
+    int              Mode;       // the mapping mode
+    int              fPreprocess;
+    int              fFirst;
+};
+
+////////////////////////////////////////////////////////////////////////
+///                     FUNCTION DEFINITIONS                         ///
+////////////////////////////////////////////////////////////////////////
+
+/**Function*************************************************************
+
+  Synopsis    [Returns 1 if the cuts can be computed in parallel.]
+
+  Description [The cuts of the nodes on the same level are independent
+  when the cut computation does not update the shared data, such as
+  the truth table hash tables, the DSD manager, or the reference counters.
+  This is the case for delay-oriented mapping (Mode 0) without truth
+  tables, choices, boxes, and the user's callbacks.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static int If_ManParIsOk( If_Man_t * p )
+{
+    If_Par_t * pPars = p->pPars;
+    if ( pPars->nThreads < 2 || p->pManTim != NULL || p->nChoices > 0 )
+        return 0;
+    if ( pPars->fTruth || pPars->fUseTtPerm || pPars->fUseDsd || pPars->fUseDsdTune || pPars->pLutStruct )
+        return 0;
+    if ( pPars->fDelayOpt || pPars->fDelayOptLut || pPars->fDsdBalance || pPars->fUserRecLib || pPars->fUserSesLib || pPars->nGateSize > 0 )
+        return 0;
+    if ( pPars->pFuncCost || pPars->pFuncUser || pPars->pFuncCell || pPars->pFuncCell2 )
+        return 0;
+    return 1;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Collects the internal nodes by level.]
+
+  Description [Returns the max number of cutsets used at the same time
+  when the nodes are mapped one level after another: the cutsets of all
+  nodes on the level are allocated before any of them is released.
+  Returns 0 if the parallel computation is not used.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int If_ManSetupLevels( If_Man_t * p )
+{
+#ifdef ABC_USE_PTHREADS
+    Vec_Int_t * vLevel;
+    If_Obj_t * pObj, * pFanin;
+    int i, k, iObj, nCutSize = 0, nCutSizeMax = 0;
+    Vec_WecFreeP( &p->vLevels );
+    if ( !If_ManParIsOk(p) )
+        return 0;
+    p->vLevels = Vec_WecStart( p->nLevelMax + 1 );
+    If_ManForEachNode( p, pObj, i )
+        Vec_WecPush( p->vLevels, If_ObjLevel(pObj), pObj->Id );
+    Vec_WecForEachLevel( p->vLevels, vLevel, k )
+    {
+        nCutSize += Vec_IntSize(vLevel);
+        nCutSizeMax = Abc_MaxInt( nCutSizeMax, nCutSize );
+        Vec_IntForEachEntry( vLevel, iObj, i )
+        {
+            pObj = If_ManObj( p, iObj );
+            if ( pObj->nVisits == 0 )
+                nCutSize--;
+            pFanin = If_ObjFanin0(pObj);
+            if ( !If_ObjIsCi(pFanin) && --pFanin->nVisits == 0 )
+                nCutSize--;
+            pFanin = If_ObjFanin1(pObj);
+            if ( !If_ObjIsCi(pFanin) && --pFanin->nVisits == 0 )
+                nCutSize--;
+        }
+    }
+    assert( nCutSize == 0 );
+    If_ManForEachObj( p, pObj, i )
+        pObj->nVisits = pObj->nVisitsCopy;
+    return nCutSizeMax;
+#else
+    return 0;
+#endif
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Computes the cuts of a range of nodes on one level.]
+
+  Description [Each worker uses its own copy of the manager, so that
+  the statistics are collected without synchronization.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static void * If_ManPerformMappingTask( void * pArg )
+{
+    If_ParTask_t * pTask = (If_ParTask_t *)pArg;
+    If_ParMan_t * pPar = pTask->pPar;
+    If_Man_t * p = pPar->pCopies + Util_TaskWorkerId( pPar->pPool );
+    If_Obj_t * pObj;
+    int i;
+    for ( i = pTask->iStart; i < pTask->iStop; i++ )
+    {
+        pObj = If_ManObj( p, Vec_IntEntry(pTask->vLevel, i) );
+        If_ObjPerformMappingAndCuts( p, pObj, pPar->Mode, pPar->fPreprocess, pPar->fFirst );
+    }
+    return NULL;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Performs one mapping pass with the level-parallel cut computation.]
+
+  Description [Returns 0 if the parallel computation cannot be used.
+  The levels are processed one at a time. The cutsets of the nodes on
+  the level are allocated and released by the calling thread, while
+  the cuts are computed by the workers. Because the cuts of a node
+  depend only on the nodes on the lower levels, the result is the same
+  as that of the serial computation.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int If_ManPerformMappingRoundPar( If_Man_t * p, int Mode, int fPreprocess, int fFirst )
+{
+    If_ParMan_t Par, * pPar = &Par;
+    If_ParTask_t * pTasks;
+    Vec_Int_t * vLevel;
+    int i, k, iObj, nTasks, nThreads, nSizeMax = 0;
+    if ( p->vLevels == NULL || Mode != 0 || !If_ManParIsOk(p) )
+        return 0;
+    nThreads = Abc_MinInt( p->pPars->nThreads, PAR_THR_MAX );
+    memset( pPar, 0, sizeof(If_ParMan_t) );
+    pPar->p           = p;
+    pPar->pPool       = Util_PoolStart( nThreads );
+    pPar->pCopies     = ABC_ALLOC( If_Man_t, nThreads );
+    pPar->Mode        = Mode;
+    pPar->fPreprocess = fPreprocess;
+    pPar->fFirst      = fFirst;
+    for ( i = 0; i < nThreads; i++ )
+    {
+        memcpy( pPar->pCopies + i, p, sizeof(If_Man_t) );
+        pPar->pCopies[i].nCutsMerged = 0;
+        pPar->pCopies[i].nCutsTotal  = 0;
+    }
+    Vec_WecForEachLevel( p->vLevels, vLevel, k )
+        nSizeMax = Abc_MaxInt( nSizeMax, Vec_IntSize(vLevel) );
+    pTasks = ABC_ALLOC( If_ParTask_t, nSizeMax / IF_PAR_CHUNK + 1 );
+    Vec_WecForEachLevel( p->vLevels, vLevel, k )
+    {
+        // allocate the cutsets
+        Vec_IntForEachEntry( vLevel, iObj, i )
+            If_ManSetupNodeCutSet( p, If_ManObj(p, iObj) );
+        // compute the cuts
+        if ( Vec_IntSize(vLevel) < IF_PAR_LEVEL_MIN )
+        {
+            Vec_IntForEachEntry( vLevel, iObj, i )
+                If_ObjPerformMappingAndCuts( p, If_ManObj(p, iObj), Mode, fPreprocess, fFirst );
+        }
+        else
+        {
+            for ( nTasks = 0, i = 0; i < Vec_IntSize(vLevel); i += IF_PAR_CHUNK, nTasks++ )
+            {
+                pTasks[nTasks].pPar   = pPar;
+                pTasks[nTasks].vLevel = vLevel;
+                pTasks[nTasks].iStart = i;
+                pTasks[nTasks].iStop  = Abc_MinInt( i + IF_PAR_CHUNK, Vec_IntSize(vLevel) );
+                Util_PoolSpawn( pPar->pPool, If_ManPerformMappingTask, pTasks + nTasks );
+            }
+            Util_PoolWaitIdle( pPar->pPool );
+        }
+        // release the cutsets that are no longer needed
+        Vec_IntForEachEntry( vLevel, iObj, i )
+            If_ManDerefNodeCutSet( p, If_ManObj(p, iObj) );
+    }
+    Util_PoolStop( pPar->pPool );
+    for ( i = 0; i < nThreads; i++ )
+    {
+        p->nCutsMerged += pPar->pCopies[i].nCutsMerged;
+        p->nCutsTotal  += pPar->pCopies[i].nCutsTotal;
+    }
+    ABC_FREE( pPar->pCopies );
+    ABC_FREE( pTasks );
+    return 1;
+}
+
+////////////////////////////////////////////////////////////////////////
+///                       END OF FILE                                ///
+////////////////////////////////////////////////////////////////////////
+
+
+ABC_NAMESPACE_IMPL_END
@@ -85,6 +85,7 @@ struct SC_SizePars_
     int        TimeOut;
     int        BuffTreeEst;      // ratio for buffer tree estimation
     int        BypassFreq;       // frequency to try bypassing
+    int        nProcs;           // the number of threads for timing updates
     int        fUseDept;
     int        fDumpStats;
     int        fUseWireLoads;
@@ -516,21 +517,70 @@ static inline float Scl_LibLookup( SC_Surface * p, float slew, float load )
 
     return p0 + sfrac * (p1 - p0);      // <<== multiply result with K factor here 
 }
+static inline int Scl_LibSurfaceSameIndex( SC_Surface * p, SC_Surface * q )
+{
+    return Vec_FltSize(&p->vIndex0) == Vec_FltSize(&q->vIndex0) && Vec_FltSize(&p->vIndex1) == Vec_FltSize(&q->vIndex1) &&
+        !memcmp( Vec_FltArray(&p->vIndex0), Vec_FltArray(&q->vIndex0), sizeof(float) * Vec_FltSize(&p->vIndex0) ) &&
+        !memcmp( Vec_FltArray(&p->vIndex1), Vec_FltArray(&q->vIndex1), sizeof(float) * Vec_FltSize(&p->vIndex1) );
+}
+// looks up two tables (delay and transition) at the same point;
+// when they share the template, the sample points are found only once
+static inline void Scl_LibLookup2( SC_Surface * p, SC_Surface * q, float slew, float load, float * pRes0, float * pRes1 )
+{
+    float * pIndex0, * pIndex1, * pDataS, * pDataS1;
+    float sfrac, lfrac, p0, p1;
+    int s, l;
+    if ( Vec_FltSize(&p->vIndex0) == 1 || Vec_FltSize(&p->vIndex1) == 1 || !Scl_LibSurfaceSameIndex(p, q) )
+    {
+        *pRes0 = Scl_LibLookup( p, slew, load );
+        *pRes1 = Scl_LibLookup( q, slew, load );
+        return;
+    }
+    pIndex0 = Vec_FltArray(&p->vIndex0);
+    for ( s = 1; s < Vec_FltSize(&p->vIndex0)-1; s++ )
+        if ( pIndex0[s] > slew )
+            break;
+    s--;
+    pIndex1 = Vec_FltArray(&p->vIndex1);
+    for ( l = 1; l < Vec_FltSize(&p->vIndex1)-1; l++ )
+        if ( pIndex1[l] > load )
+            break;
+    l--;
+    sfrac = (slew - pIndex0[s]) / (pIndex0[s+1] - pIndex0[s]);
+    lfrac = (load - pIndex1[l]) / (pIndex1[l+1] - pIndex1[l]);
+    // the first table
+    pDataS  = Vec_FltArray( (Vec_Flt_t *)Vec_PtrEntry(&p->vData, s) );
+    pDataS1 = Vec_FltArray( (Vec_Flt_t *)Vec_PtrEntry(&p->vData, s+1) );
+    p0 = pDataS [l] + lfrac * (pDataS [l+1] - pDataS [l]);
+    p1 = pDataS1[l] + lfrac * (pDataS1[l+1] - pDataS1[l]);
+    *pRes0 = p0 + sfrac * (p1 - p0);
+    // the second table
+    pDataS  = Vec_FltArray( (Vec_Flt_t *)Vec_PtrEntry(&q->vData, s) );
+    pDataS1 = Vec_FltArray( (Vec_Flt_t *)Vec_PtrEntry(&q->vData, s+1) );
+    p0 = pDataS [l] + lfrac * (pDataS [l+1] - pDataS [l]);
+    p1 = pDataS1[l] + lfrac * (pDataS1[l+1] - pDataS1[l]);
+    *pRes1 = p0 + sfrac * (p1 - p0);
+}
 static inline void Scl_LibPinArrival( SC_Timing * pTime, SC_Pair * pArrIn, SC_Pair * pSlewIn, SC_Pair * pLoad, SC_Pair * pArrOut, SC_Pair * pSlewOut )
 {
+    float DelayRise, DelayFall, SlewRise, SlewFall;
     if (pTime->tsense == sc_ts_Pos || pTime->tsense == sc_ts_Non)
     {
-        pArrOut->rise  = Abc_MaxFloat( pArrOut->rise,  pArrIn->rise + Scl_LibLookup(&pTime->pCellRise,  pSlewIn->rise, pLoad->rise) );
-        pArrOut->fall  = Abc_MaxFloat( pArrOut->fall,  pArrIn->fall + Scl_LibLookup(&pTime->pCellFall,  pSlewIn->fall, pLoad->fall) );
-        pSlewOut->rise = Abc_MaxFloat( pSlewOut->rise,                Scl_LibLookup(&pTime->pRiseTrans, pSlewIn->rise, pLoad->rise) );
-        pSlewOut->fall = Abc_MaxFloat( pSlewOut->fall,                Scl_LibLookup(&pTime->pFallTrans, pSlewIn->fall, pLoad->fall) );
+        Scl_LibLookup2( &pTime->pCellRise, &pTime->pRiseTrans, pSlewIn->rise, pLoad->rise, &DelayRise, &SlewRise );
+        Scl_LibLookup2( &pTime->pCellFall, &pTime->pFallTrans, pSlewIn->fall, pLoad->fall, &DelayFall, &SlewFall );
+        pArrOut->rise  = Abc_MaxFloat( pArrOut->rise,  pArrIn->rise + DelayRise );
+        pArrOut->fall  = Abc_MaxFloat( pArrOut->fall,  pArrIn->fall + DelayFall );
+        pSlewOut->rise = Abc_MaxFloat( pSlewOut->rise,                SlewRise  );
+        pSlewOut->fall = Abc_MaxFloat( pSlewOut->fall,                SlewFall  );
     }
     if (pTime->tsense == sc_ts_Neg || pTime->tsense == sc_ts_Non)
     {
-        pArrOut->rise  = Abc_MaxFloat( pArrOut->rise,  pArrIn->fall + Scl_LibLookup(&pTime->pCellRise,  pSlewIn->fall, pLoad->rise) );
-        pArrOut->fall  = Abc_MaxFloat( pArrOut->fall,  pArrIn->rise + Scl_LibLookup(&pTime->pCellFall,  pSlewIn->rise, pLoad->fall) );
-        pSlewOut->rise = Abc_MaxFloat( pSlewOut->rise,                Scl_LibLookup(&pTime->pRiseTrans, pSlewIn->fall, pLoad->rise) );
-        pSlewOut->fall = Abc_MaxFloat( pSlewOut->fall,                Scl_LibLookup(&pTime->pFallTrans, pSlewIn->rise, pLoad->fall) );
+        Scl_LibLookup2( &pTime->pCellRise, &pTime->pRiseTrans, pSlewIn->fall, pLoad->rise, &DelayRise, &SlewRise );
+        Scl_LibLookup2( &pTime->pCellFall, &pTime->pFallTrans, pSlewIn->rise, pLoad->fall, &DelayFall, &SlewFall );
+        pArrOut->rise  = Abc_MaxFloat( pArrOut->rise,  pArrIn->fall + DelayRise );
+        pArrOut->fall  = Abc_MaxFloat( pArrOut->fall,  pArrIn->rise + DelayFall );
+        pSlewOut->rise = Abc_MaxFloat( pSlewOut->rise,                SlewRise  );
+        pSlewOut->fall = Abc_MaxFloat( pSlewOut->fall,                SlewFall  );
     }
 }
 static inline void Scl_LibPinDeparture( SC_Timing * pTime, SC_Pair * pDepIn, SC_Pair * pSlewIn, SC_Pair * pLoad, SC_Pair * pDepOut )
@@ -734,7 +784,11 @@ static inline void Scl_LibHandleInputDriver2( SC_Cell * pCell, SC_PairI * pLoadI
 }
 
 /*=== sclLiberty.c ===============================================================*/
-extern SC_Lib *      Abc_SclReadLiberty( char * pFileName, int fVerbose, int fVeryVerbose );
+extern SC_Lib *      Abc_SclReadLiberty( char * pFileName, int fVerbose, int fVeryVerbose, int fUseCache );
+/*=== sclLibCache.c ===============================================================*/
+extern int           Abc_SclCacheLibKey( char * pFileName, word * pLibSize, word * pLibHash );
+extern SC_Lib *      Abc_SclCacheRead( char * pFileName, word LibSize, word LibHash );
+extern void          Abc_SclCacheWrite( char * pFileName, word LibSize, word LibHash, Vec_Str_t * vStr );
 /*=== sclLibScl.c ===============================================================*/
 extern SC_Lib *      Abc_SclReadFromGenlib( void * pLib );
 extern SC_Lib *      Abc_SclReadFromStr( Vec_Str_t * vOut );
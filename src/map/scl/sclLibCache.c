@@ -0,0 +1,263 @@
+/**CFile****************************************************************
+
+  FileName    [sclLibCache.c]
+
+  SystemName  [ABC: Logic synthesis and verification system.]
+
+  PackageName [Standard-cell library representation.]
+
+  Synopsis    [Binary cache of the parsed Liberty libraries.]
+
+  Author      [Alan Mishchenko, Niklas Een]
+
+  Affiliation [UC Berkeley]
+
+  Date        [Ver. 1.0. Started - August 24, 2012.]
+
+  Revision    [$Id: sclLibCache.c,v 1.0 2012/08/24 00:00:00 alanmi Exp $]
+
+***********************************************************************/
+
+#include "sclLib.h"
+
+#ifndef _WIN32
+#include <sys/mman.h>
+#include <fcntl.h>
+#include <unistd.h>
+#else
+#include <process.h>
+#endif
+
+ABC_NAMESPACE_IMPL_START
+
+
+////////////////////////////////////////////////////////////////////////
+///                        DECLARATIONS                              ///
+////////////////////////////////////////////////////////////////////////
+
+// The cache of "file.lib" is stored in "file.lib.sclc". It starts with
+// the header, followed by the library in the SCL format, as produced by
+// the Liberty parser (before normalization). The cache is used only if
+// the size and the checksum of the Liberty file match those recorded in
+// the header; otherwise, it is silently overwritten.
+
+#define SCL_CACHE_MAGIC    ABC_CONST(0x31434C5343434241)   // "ABCCSLC1"
+#define SCL_CACHE_VERSION  1
+#define SCL_CACHE_CHUNK    (1 << 20)
+
+typedef struct Scl_CacheHead_t_ Scl_CacheHead_t;
+struct Scl_CacheHead_t_
+{
+    word           Magic;         // the file type
+    word           Version;       // the versions of the cache and the SCL format
+    word           LibSize;       // the size of the Liberty file
+    word           LibHash;       // the checksum of the Liberty file
+    word           DataSize;      // the size of the SCL data
+    word           DataHash;      // the checksum of the SCL data
+    word           Pad[2];        // the SCL data starts at a 64-byte boundary
+};
+
+static inline word Scl_CacheVersion() { return ((word)SCL_CACHE_VERSION << 32) | ABC_SCL_CUR_VERSION; }
+
+////////////////////////////////////////////////////////////////////////
+///                     FUNCTION DEFINITIONS                         ///
+////////////////////////////////////////////////////////////////////////
+
+/**Function*************************************************************
+
+  Synopsis    [Computes the checksum of a block of data.]
+
+  Description [Processes the data by 8-byte words. The block size should
+  be divisible by 8, except for the last block.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static word Scl_CacheHash( word Hash, unsigned char * pData, word nSize )
+{
+    word i, Word;
+    for ( i = 0; i + 8 <= nSize; i += 8 )
+    {
+        memcpy( &Word, pData + i, 8 );
+        Hash = (Hash ^ Word) * ABC_CONST(0x9E3779B97F4A7C15);
+        Hash ^= Hash >> 29;
+    }
+    for ( ; i < nSize; i++ )
+        Hash = (Hash ^ pData[i]) * ABC_CONST(0x100000001B3);
+    return Hash;
+}
+static char * Scl_CacheFileName( char * pFileName )
+{
+    char * pCacheName = ABC_ALLOC( char, strlen(pFileName) + 10 );
+    sprintf( pCacheName, "%s.sclc", pFileName );
+    return pCacheName;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Computes the key of the Liberty file.]
+
+  Description [The key is the size and the checksum of the file contents.
+  Returns 0 if the file cannot be read.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Abc_SclCacheLibKey( char * pFileName, word * pLibSize, word * pLibHash )
+{
+    unsigned char * pBuffer;
+    FILE * pFile;
+    size_t nRead;
+    *pLibSize = 0;
+    *pLibHash = 0;
+    pFile = fopen( pFileName, "rb" );
+    if ( pFile == NULL )
+        return 0;
+    pBuffer = ABC_ALLOC( unsigned char, SCL_CACHE_CHUNK );
+    while ( (nRead = fread( pBuffer, 1, SCL_CACHE_CHUNK, pFile )) > 0 )
+    {
+        *pLibHash = Scl_CacheHash( *pLibHash, pBuffer, (word)nRead );
+        *pLibSize += (word)nRead;
+    }
+    ABC_FREE( pBuffer );
+    fclose( pFile );
+    return 1;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Reads the library from the cache.]
+
+  Description [Returns NULL if the cache is absent, corrupted, produced by
+  a different version, or produced for a different Liberty file. The cache
+  is mapped into memory and the library is built directly from the mapped
+  data, without reading it into an intermediate buffer.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+SC_Lib * Abc_SclCacheRead( char * pFileName, word LibSize, word LibHash )
+{
+    Scl_CacheHead_t Head;
+    Vec_Str_t Data;
+    SC_Lib * p = NULL;
+    char * pCacheName = Scl_CacheFileName( pFileName );
+    char * pContents = NULL;
+    FILE * pFile;
+    word nFileSize;
+    int fMapped = 0;
+    pFile = fopen( pCacheName, "rb" );
+    ABC_FREE( pCacheName );
+    if ( pFile == NULL )
+        return NULL;
+    // check the header
+    if ( fread( &Head, sizeof(Scl_CacheHead_t), 1, pFile ) != 1 ||
+         Head.Magic != SCL_CACHE_MAGIC || Head.Version != Scl_CacheVersion() ||
+         Head.LibSize != LibSize || Head.LibHash != LibHash ||
+         Head.DataSize == 0 || Head.DataSize >= (word)0x7FFFFFFF )
+    {
+        fclose( pFile );
+        return NULL;
+    }
+    fseek( pFile, 0, SEEK_END );
+    nFileSize = (word)ftell( pFile );
+    if ( nFileSize != sizeof(Scl_CacheHead_t) + Head.DataSize )
+    {
+        fclose( pFile );
+        return NULL;
+    }
+    // map the file
+#ifndef _WIN32
+    pContents = (char *)mmap( NULL, (size_t)nFileSize, PROT_READ, MAP_PRIVATE, fileno(pFile), 0 );
+    if ( pContents == (char *)MAP_FAILED )
+        pContents = NULL;
+    else
+        fMapped = 1;
+#endif
+    if ( pContents == NULL )
+    {
+        pContents = ABC_ALLOC( char, nFileSize );
+        rewind( pFile );
+        if ( fread( pContents, 1, (size_t)nFileSize, pFile ) != (size_t)nFileSize )
+            ABC_FREE( pContents );
+    }
+    fclose( pFile );
+    if ( pContents == NULL )
+        return NULL;
+    // read the library
+    Data.nCap   = (int)Head.DataSize;
+    Data.nSize  = (int)Head.DataSize;
+    Data.pArray = pContents + sizeof(Scl_CacheHead_t);
+    if ( Scl_CacheHash( 0, (unsigned char *)Data.pArray, Head.DataSize ) == Head.DataHash )
+        p = Abc_SclReadFromStr( &Data );
+#ifndef _WIN32
+    if ( fMapped )
+        munmap( pContents, (size_t)nFileSize );
+    else
+#endif
+    ABC_FREE( pContents );
+    return p;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Writes the library into the cache.]
+
+  Description [The data is written into a temporary file, which is then
+  renamed, so that concurrent runs reading the same Liberty file never see
+  an incomplete cache. Failures (for example, a read-only directory) are
+  ignored.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Abc_SclCacheWrite( char * pFileName, word LibSize, word LibHash, Vec_Str_t * vStr )
+{
+    Scl_CacheHead_t Head;
+    char * pCacheName = Scl_CacheFileName( pFileName );
+    char * pTempName = ABC_ALLOC( char, strlen(pCacheName) + 20 );
+    FILE * pFile;
+    int RetValue;
+#ifndef _WIN32
+    sprintf( pTempName, "%s.%d", pCacheName, (int)getpid() );
+#else
+    sprintf( pTempName, "%s.%d", pCacheName, (int)_getpid() );
+#endif
+    memset( &Head, 0, sizeof(Scl_CacheHead_t) );
+    Head.Magic    = SCL_CACHE_MAGIC;
+    Head.Version  = Scl_CacheVersion();
+    Head.LibSize  = LibSize;
+    Head.LibHash  = LibHash;
+    Head.DataSize = (word)Vec_StrSize(vStr);
+    Head.DataHash = Scl_CacheHash( 0, (unsigned char *)Vec_StrArray(vStr), Head.DataSize );
+    pFile = fopen( pTempName, "wb" );
+    if ( pFile != NULL )
+    {
+        RetValue  = fwrite( &Head, sizeof(Scl_CacheHead_t), 1, pFile ) == 1;
+        RetValue &= fwrite( Vec_StrArray(vStr), 1, Vec_StrSize(vStr), pFile ) == (size_t)Vec_StrSize(vStr);
+        RetValue &= fclose( pFile ) == 0;
+#ifdef _WIN32
+        if ( RetValue )
+            remove( pCacheName );
+#endif
+        if ( !RetValue || rename( pTempName, pCacheName ) != 0 )
+            remove( pTempName );
+    }
+    ABC_FREE( pTempName );
+    ABC_FREE( pCacheName );
+}
+
+////////////////////////////////////////////////////////////////////////
+///                       END OF FILE                                ///
+////////////////////////////////////////////////////////////////////////
+
+
+ABC_NAMESPACE_IMPL_END
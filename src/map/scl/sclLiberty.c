@@ -1634,11 +1634,27 @@ Vec_Str_t * Scl_LibertyReadSclStr( Scl_Tree_t * p, int fVerbose, int fVeryVerbos
     }
     return vOut;
 }
-SC_Lib * Abc_SclReadLiberty( char * pFileName, int fVerbose, int fVeryVerbose )
+SC_Lib * Abc_SclReadLiberty( char * pFileName, int fVerbose, int fVeryVerbose, int fUseCache )
 {
     SC_Lib * pLib;
     Scl_Tree_t * p;
     Vec_Str_t * vStr;
+    word LibSize = 0, LibHash = 0;
+    abctime clk = Abc_Clock();
+    // try the binary cache, which is valid only for the current contents of the file
+    if ( fUseCache && !Abc_SclCacheLibKey( pFileName, &LibSize, &LibHash ) )
+        fUseCache = 0;
+    if ( fUseCache && (pLib = Abc_SclCacheRead( pFileName, LibSize, LibHash )) )
+    {
+        pLib->pFileName = Abc_UtilStrsav( pFileName );
+        Abc_SclLibNormalize( pLib );
+        if ( fVerbose )
+        {
+            printf( "Library \"%s\" from \"%s\" has %d cells (read from cache).  ", pLib->pName, pFileName, SC_LibCellNum(pLib) );
+            Abc_PrintTime( 1, "Time", Abc_Clock() - clk );
+        }
+        return pLib;
+    }
     p = Scl_LibertyParse( pFileName, fVeryVerbose );
     if ( p == NULL )
         return NULL;
@@ -1648,6 +1664,8 @@ SC_Lib * Abc_SclReadLiberty( char * pFileName, int fVerbose, int fVeryVerbose )
     Scl_LibertyStop( p, fVeryVerbose );
     if ( vStr == NULL )
         return NULL;
+    if ( fUseCache )
+        Abc_SclCacheWrite( pFileName, LibSize, LibHash, vStr );
     // construct SCL data-structure
     pLib = Abc_SclReadFromStr( vStr );
     if ( pLib == NULL )
@@ -34,6 +34,22 @@ ABC_NAMESPACE_IMPL_START
 ///                        DECLARATIONS                              ///
 ////////////////////////////////////////////////////////////////////////
 
+// levels with fewer nodes are processed by the calling thread
+#define SCL_PAR_LEVEL_MIN   1024
+// the number of nodes processed by one task
+#define SCL_PAR_CHUNK        256
+
+typedef struct Abc_SclTimeJob_t_ Abc_SclTimeJob_t;
+struct Abc_SclTimeJob_t_
+{
+    SC_Man *       p;             // the manager
+    Vec_Int_t *    vNodes;        // the nodes of the level
+    int            iStart;        // the first node of the chunk
+    int            iStop;         // the node following the last one
+    int            fDept;         // computing departures
+    int            nEstNodes;     // the number of estimations in the chunk
+};
+
 ////////////////////////////////////////////////////////////////////////
 ///                     FUNCTION DEFINITIONS                         ///
 ////////////////////////////////////////////////////////////////////////
@@ -305,7 +321,7 @@ static inline void Abc_SclTimeCi( SC_Man * p, Abc_Obj_t * pObj )
         Scl_LibHandleInputDriver( p->pPiDrive, pLoad, pTime, pSlew );
     }
 }
-void Abc_SclTimeNode( SC_Man * p, Abc_Obj_t * pObj, int fDept )
+static inline int Abc_SclTimeNodeInt( SC_Man * p, Abc_Obj_t * pObj, int fDept )
 {
     SC_Timing * pTime;
     SC_Cell * pCell;
@@ -321,7 +337,7 @@ void Abc_SclTimeNode( SC_Man * p, Abc_Obj_t * pObj, int fDept )
     {
         assert( !fDept );
         Abc_SclTimeCi( p, pObj );
-        return;
+        return 0;
     }
     if ( Abc_ObjIsCo(pObj) )
     {
@@ -331,7 +347,7 @@ void Abc_SclTimeNode( SC_Man * p, Abc_Obj_t * pObj, int fDept )
             Vec_FltWriteEntry( p->vTimesOut, pObj->iData, Abc_SclObjTimeMax(p, pObj) );
             Vec_QueUpdate( p->vQue, pObj->iData );
         }
-        return;
+        return 0;
     }
     assert( Abc_ObjIsNode(pObj) );
 //    if ( !(Abc_ObjFaninNum(pObj) == 1 && Abc_ObjIsPi(Abc_ObjFanin0(pObj))) && p->EstLoadMax && Value > 1 )
@@ -348,7 +364,6 @@ void Abc_SclTimeNode( SC_Man * p, Abc_Obj_t * pObj, int fDept )
             pDepOut->rise += EstDelta;
             pDepOut->fall += EstDelta;
         }
-        p->nEstNodes++;
     }
     // get the library cell
     pCell = Abc_SclObjCell( pObj );
@@ -379,6 +394,11 @@ void Abc_SclTimeNode( SC_Man * p, Abc_Obj_t * pObj, int fDept )
             pArrOut->fall += EstDelta;
         }
     }
+    return p->EstLoadMax && Value > 1;
+}
+void Abc_SclTimeNode( SC_Man * p, Abc_Obj_t * pObj, int fDept )
+{
+    p->nEstNodes += Abc_SclTimeNodeInt( p, pObj, fDept );
 }
 void Abc_SclTimeCone( SC_Man * p, Vec_Int_t * vCone )
 {
@@ -397,6 +417,146 @@ void Abc_SclTimeCone( SC_Man * p, Vec_Int_t * vCone )
         printf( "after (%6.1f ps  %6.1f ps)\n", Abc_SclObjTimeOne(p, pObj, 1), Abc_SclObjTimeOne(p, pObj, 0) );
     }
 }
+
+/**Function*************************************************************
+
+  Synopsis    [Parallel timing computation.]
+
+  Description [The nodes are divided into levels, so that the nodes of
+  one level depend only on the nodes of the previous levels. The nodes
+  of each level are processed by the threads in chunks. For departures,
+  each node computes its own departure from those of its fanouts instead
+  of updating the departures of its fanins, so that the threads do not
+  write into the same objects. The result is the same as in the serial
+  computation, because only the maximum of the values is taken.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static inline int Abc_SclDeptObjEst( SC_Man * p, Abc_Obj_t * pObj )
+{
+    SC_Pair * pDepIn  = Abc_SclObjDept( p, pObj );
+    SC_Pair * pSlewIn = Abc_SclObjSlew( p, pObj );
+    SC_Pair Load, DepOut;
+    Abc_Obj_t * pFanout, * pFanin;
+    float Value;
+    int i, k;
+    SC_PairClean( pDepIn );
+    Abc_ObjForEachFanout( pObj, pFanout, i )
+    {
+        if ( !Abc_ObjIsNode(pFanout) )
+            continue;
+        // use the load and departure seen by the fanout in Abc_SclTimeNode()
+        Load   = *Abc_SclObjLoad( p, pFanout );
+        DepOut = *Abc_SclObjDept( p, pFanout );
+        Value  = p->EstLoadMax ? Abc_SclObjLoadValue( p, pFanout ) : 0;
+        if ( p->EstLoadMax && Value > 1 )
+        {
+            float EstDelta = p->EstLinear * log( Value );
+            Load.rise = p->EstLoadAve * p->EstLoadMax;
+            Load.fall = p->EstLoadAve * p->EstLoadMax;
+            DepOut.rise += EstDelta;
+            DepOut.fall += EstDelta;
+        }
+        Abc_ObjForEachFanin( pFanout, pFanin, k )
+            if ( pFanin == pObj )
+                Scl_LibPinDeparture( Scl_CellPinTime(Abc_SclObjCell(pFanout), k), pDepIn, pSlewIn, &Load, &DepOut );
+    }
+    return Abc_ObjIsNode(pObj) && p->EstLoadMax && Abc_SclObjLoadValue( p, pObj ) > 1;
+}
+static void Abc_SclTimeLevelize( SC_Man * p )
+{
+    Vec_Int_t * vLevel = Vec_IntStart( Abc_NtkObjNumMax(p->pNtk) );
+    Abc_Obj_t * pObj, * pNext;
+    int i, k, Level;
+    if ( p->vTimeLevels == NULL )
+    {
+        p->vTimeLevels  = Vec_WecAlloc( 100 );
+        p->vTimeLevelsR = Vec_WecAlloc( 100 );
+    }
+    Vec_WecClear( p->vTimeLevels );
+    Vec_WecClear( p->vTimeLevelsR );
+    Abc_NtkForEachNode1( p->pNtk, pObj, i )
+    {
+        Level = 0;
+        Abc_ObjForEachFanin( pObj, pNext, k )
+            Level = Abc_MaxInt( Level, Vec_IntEntry(vLevel, Abc_ObjId(pNext)) );
+        Vec_IntWriteEntry( vLevel, i, Level + 1 );
+        Vec_WecPush( p->vTimeLevels, Level, i );
+    }
+    Vec_IntFill( vLevel, Abc_NtkObjNumMax(p->pNtk), 0 );
+    Abc_NtkForEachNodeReverse1( p->pNtk, pObj, i )
+    {
+        Level = 0;
+        Abc_ObjForEachFanout( pObj, pNext, k )
+            if ( Abc_ObjIsNode(pNext) )
+                Level = Abc_MaxInt( Level, Vec_IntEntry(vLevel, Abc_ObjId(pNext)) );
+        Vec_IntWriteEntry( vLevel, i, Level + 1 );
+        Vec_WecPush( p->vTimeLevelsR, Level, i );
+    }
+    Vec_IntFree( vLevel );
+}
+static void * Abc_SclTimeJob( void * pArg )
+{
+    Abc_SclTimeJob_t * pJob = (Abc_SclTimeJob_t *)pArg;
+    Abc_Obj_t * pObj;
+    int i;
+    pJob->nEstNodes = 0;
+    for ( i = pJob->iStart; i < pJob->iStop; i++ )
+    {
+        pObj = Abc_NtkObj( pJob->p->pNtk, Vec_IntEntry(pJob->vNodes, i) );
+        if ( pJob->fDept )
+            pJob->nEstNodes += Abc_SclDeptObjEst( pJob->p, pObj );
+        else
+            pJob->nEstNodes += Abc_SclTimeNodeInt( pJob->p, pObj, 0 );
+    }
+    return NULL;
+}
+static void Abc_SclTimeLevelsPar( SC_Man * p, Vec_Wec_t * vLevels, int fDept )
+{
+    Abc_SclTimeJob_t * pJobs, * pJob;
+    Vec_Int_t * vLevel;
+    int i, k, nJobs, nJobsMax = 1;
+    Vec_WecForEachLevel( vLevels, vLevel, i )
+        nJobsMax = Abc_MaxInt( nJobsMax, (Vec_IntSize(vLevel) + SCL_PAR_CHUNK - 1) / SCL_PAR_CHUNK );
+    pJobs = ABC_CALLOC( Abc_SclTimeJob_t, nJobsMax );
+    Vec_WecForEachLevel( vLevels, vLevel, i )
+    {
+        nJobs = (Vec_IntSize(vLevel) + SCL_PAR_CHUNK - 1) / SCL_PAR_CHUNK;
+        for ( k = 0; k < nJobs; k++ )
+        {
+            pJob = pJobs + k;
+            pJob->p      = p;
+            pJob->vNodes = vLevel;
+            pJob->iStart = k * SCL_PAR_CHUNK;
+            pJob->iStop  = Abc_MinInt( (k + 1) * SCL_PAR_CHUNK, Vec_IntSize(vLevel) );
+            pJob->fDept  = fDept;
+            if ( Vec_IntSize(vLevel) < SCL_PAR_LEVEL_MIN )
+                Abc_SclTimeJob( pJob );
+            else
+                Util_PoolSpawn( p->pPool, Abc_SclTimeJob, (void *)pJob );
+        }
+        if ( Vec_IntSize(vLevel) >= SCL_PAR_LEVEL_MIN )
+            Util_PoolWaitIdle( p->pPool );
+        for ( k = 0; k < nJobs; k++ )
+            p->nEstNodes += pJobs[k].nEstNodes;
+    }
+    ABC_FREE( pJobs );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Recomputes timing of the network.]
+
+  Description [Uses the thread pool of the manager, if it is started.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
 void Abc_SclTimeNtkRecompute( SC_Man * p, float * pArea, float * pDelay, int fReverse, float DUser )
 {
     Abc_Obj_t * pObj;
@@ -407,6 +567,12 @@ void Abc_SclTimeNtkRecompute( SC_Man * p, float * pArea, float * pDelay, int fRe
     p->nEstNodes = 0;
     Abc_NtkForEachCi( p->pNtk, pObj, i )
         Abc_SclTimeNode( p, pObj, 0 );
+    if ( p->pPool )
+    {
+        Abc_SclTimeLevelize( p );
+        Abc_SclTimeLevelsPar( p, p->vTimeLevels, 0 );
+    }
+    else
     Abc_NtkForEachNode1( p->pNtk, pObj, i )
         Abc_SclTimeNode( p, pObj, 0 );
     Abc_NtkForEachCo( p->pNtk, pObj, i )
@@ -418,7 +584,16 @@ void Abc_SclTimeNtkRecompute( SC_Man * p, float * pArea, float * pDelay, int fRe
         *pArea = Abc_SclGetTotalArea(p->pNtk);
     if ( pDelay )
         *pDelay = D;
-    if ( fReverse )
+    if ( fReverse && p->pPool )
+    {
+        p->nEstNodes = 0;
+        Abc_SclTimeLevelsPar( p, p->vTimeLevelsR, 1 );
+        // the CIs and constants are not in the levels
+        Abc_NtkForEachObj( p->pNtk, pObj, i )
+            if ( Abc_ObjIsCi(pObj) || (Abc_ObjIsNode(pObj) && Abc_ObjFaninNum(pObj) == 0) )
+                Abc_SclDeptObjEst( p, pObj );
+    }
+    else if ( fReverse )
     {
         p->nEstNodes = 0;
         Abc_NtkForEachNodeReverse1( p->pNtk, pObj, i )
@@ -457,7 +632,8 @@ static inline void Abc_SclTimeIncAddNode( SC_Man * p, Abc_Obj_t * pObj )
     assert( !Abc_ObjIsLatch(pObj) );
     assert( pObj->fMarkC == 0 );
     pObj->fMarkC = 1;
-    Vec_IntPush( Vec_WecEntry(p->vLevels, Abc_ObjLevel(pObj)), Abc_ObjId(pObj) );
+    // levels may grow beyond the initial estimate after buffering/bypassing
+    Vec_WecPush( p->vLevels, Abc_ObjLevel(pObj), Abc_ObjId(pObj) );
     p->nIncUpdates++;
 }
 static inline void Abc_SclTimeIncAddFanins( SC_Man * p, Abc_Obj_t * pObj )
@@ -537,7 +713,7 @@ void Abc_SclTimeIncCheckLevel( Abc_Ntk_t * pNtk )
         if ( (int)pObj->Level != Abc_ObjLevelNew(pObj) )
             printf( "Level of node %d is out of date!\n", i );
 }
-int Abc_SclTimeIncUpdate( SC_Man * p )
+int Abc_SclTimeIncUpdate( SC_Man * p, int fDept )
 {
     Abc_Obj_t * pObj;
     int i, RetValue;
@@ -553,7 +729,8 @@ int Abc_SclTimeIncUpdate( SC_Man * p )
     }
     Vec_IntClear( p->vChanged );
     Abc_SclTimeIncUpdateArrival( p );
-    Abc_SclTimeIncUpdateDeparture( p );
+    if ( fDept )
+        Abc_SclTimeIncUpdateDeparture( p );
     Abc_SclTimeIncUpdateClean( p );
     RetValue = p->nIncUpdates;
     p->nIncUpdates = 0;
@@ -630,9 +807,12 @@ void Abc_SclManReadSlewAndLoad( SC_Man * p, Abc_Ntk_t * pNtk )
   SeeAlso     []
 
 ***********************************************************************/
-SC_Man * Abc_SclManStart( SC_Lib * pLib, Abc_Ntk_t * pNtk, int fUseWireLoads, int fDept, float DUser, int nTreeCRatio )
+SC_Man * Abc_SclManStart( SC_Lib * pLib, Abc_Ntk_t * pNtk, int fUseWireLoads, int fDept, float DUser, int nTreeCRatio, int nProcs )
 {
     SC_Man * p = Abc_SclManAlloc( pLib, pNtk );
+    p->nProcs = nProcs;
+    if ( nProcs > 1 )
+        p->pPool = Util_PoolStart( nProcs );
     if ( nTreeCRatio )
     {
         p->EstLoadMax = 0.01 * nTreeCRatio;  // max ratio of Cout/Cave when the estimation is used
@@ -668,10 +848,10 @@ SC_Man * Abc_SclManStart( SC_Lib * pLib, Abc_Ntk_t * pNtk, int fUseWireLoads, in
   SeeAlso     []
 
 ***********************************************************************/
-void Abc_SclTimePerformInt( SC_Lib * pLib, Abc_Ntk_t * pNtk, int nTreeCRatio, int fUseWireLoads, int fShowAll, int fPrintPath, int fDumpStats )
+void Abc_SclTimePerformInt( SC_Lib * pLib, Abc_Ntk_t * pNtk, int nTreeCRatio, int fUseWireLoads, int fShowAll, int fPrintPath, int fDumpStats, int nProcs )
 {
     SC_Man * p;
-    p = Abc_SclManStart( pLib, pNtk, fUseWireLoads, 1, 0, nTreeCRatio );
+    p = Abc_SclManStart( pLib, pNtk, fUseWireLoads, 1, 0, nTreeCRatio, nProcs );
     Abc_SclTimeNtkPrint( p, fShowAll, fPrintPath );
     if ( fDumpStats )
         Abc_SclDumpStats( p, "stats.txt", 0 );
@@ -689,12 +869,12 @@ void Abc_SclTimePerformInt( SC_Lib * pLib, Abc_Ntk_t * pNtk, int nTreeCRatio, in
   SeeAlso     []
 
 ***********************************************************************/
-void Abc_SclTimePerform( SC_Lib * pLib, Abc_Ntk_t * pNtk, int nTreeCRatio, int fUseWireLoads, int fShowAll, int fPrintPath, int fDumpStats )
+void Abc_SclTimePerform( SC_Lib * pLib, Abc_Ntk_t * pNtk, int nTreeCRatio, int fUseWireLoads, int fShowAll, int fPrintPath, int fDumpStats, int nProcs )
 {
     Abc_Ntk_t * pNtkNew = pNtk;
     if ( pNtk->nBarBufs2 > 0 )
         pNtkNew = Abc_NtkDupDfsNoBarBufs( pNtk );
-    Abc_SclTimePerformInt( pLib, pNtkNew, nTreeCRatio, fUseWireLoads, fShowAll, fPrintPath, fDumpStats );
+    Abc_SclTimePerformInt( pLib, pNtkNew, nTreeCRatio, fUseWireLoads, fShowAll, fPrintPath, fDumpStats, nProcs );
     if ( pNtk->nBarBufs2 > 0 )
         Abc_NtkDelete( pNtkNew );
 }
@@ -899,7 +1079,7 @@ void Abc_SclPrintBuffers( SC_Lib * pLib, Abc_Ntk_t * pNtk, int fVerbose )
     int fUseWireLoads = 0;
     SC_Man * p;
     assert( Abc_NtkIsMappedLogic(pNtk) );
-    p = Abc_SclManStart( pLib, pNtk, fUseWireLoads, 1, 0, 10000 ); 
+    p = Abc_SclManStart( pLib, pNtk, fUseWireLoads, 1, 0, 10000, 1 ); 
     Abc_SclPrintBufferTrees( p, pNtk ); 
 //    Abc_SclPrintFaninPairs( p, pNtk );
     Abc_SclManFree( p );
@@ -29,6 +29,7 @@
 #include "base/abc/abc.h"
 #include "misc/vec/vecQue.h"
 #include "misc/vec/vecWec.h"
+#include "misc/util/utilTask.h"
 #include "sclLib.h"
 
 ABC_NAMESPACE_HEADER_START
@@ -82,6 +83,11 @@ struct SC_Man_
     Vec_Wec_t *    vLevels;
     Vec_Int_t *    vChanged; 
     int            nIncUpdates;
+    // parallel timing update
+    int            nProcs;        // the number of threads
+    Util_Pool_t *  pPool;         // the thread pool
+    Vec_Wec_t *    vTimeLevels;   // internal nodes by level
+    Vec_Wec_t *    vTimeLevelsR;  // internal nodes by reverse level
     // optimization parameters
     float          SumArea;       // total area
     float          MaxDelay;      // max delay
@@ -215,6 +221,10 @@ static inline void Abc_SclManFree( SC_Man * p )
     Vec_IntFreeP( &p->vGatesBest );
     Vec_WecFreeP( &p->vLevels );
     Vec_IntFreeP( &p->vChanged );
+    Vec_WecFreeP( &p->vTimeLevels );
+    Vec_WecFreeP( &p->vTimeLevelsR );
+    if ( p->pPool )
+        Util_PoolStop( p->pPool );
 //    Vec_QuePrint( p->vQue );
     Vec_QueCheck( p->vQue );
     Vec_QueFreeP( &p->vQue );
@@ -563,13 +573,13 @@ extern void          Abc_SclUpdateLoadSplit( SC_Man * p, Abc_Obj_t * pBuffer, Ab
 extern Abc_Obj_t *   Abc_SclFindCriticalCo( SC_Man * p, int * pfRise );
 extern Abc_Obj_t *   Abc_SclFindMostCriticalFanin( SC_Man * p, int * pfRise, Abc_Obj_t * pNode );
 extern void          Abc_SclTimeNtkPrint( SC_Man * p, int fShowAll, int fPrintPath );
-extern SC_Man *      Abc_SclManStart( SC_Lib * pLib, Abc_Ntk_t * pNtk, int fUseWireLoads, int fDept, float DUser, int nTreeCRatio );
+extern SC_Man *      Abc_SclManStart( SC_Lib * pLib, Abc_Ntk_t * pNtk, int fUseWireLoads, int fDept, float DUser, int nTreeCRatio, int nProcs );
 extern void          Abc_SclTimeCone( SC_Man * p, Vec_Int_t * vCone );
 extern void          Abc_SclTimeNtkRecompute( SC_Man * p, float * pArea, float * pDelay, int fReverse, float DUser );
-extern int           Abc_SclTimeIncUpdate( SC_Man * p );
+extern int           Abc_SclTimeIncUpdate( SC_Man * p, int fDept );
 extern void          Abc_SclTimeIncInsert( SC_Man * p, Abc_Obj_t * pObj );
 extern void          Abc_SclTimeIncUpdateLevel( Abc_Obj_t * pObj );
-extern void          Abc_SclTimePerform( SC_Lib * pLib, Abc_Ntk_t * pNtk, int nTreeCRatio, int fUseWireLoads, int fShowAll, int fPrintPath, int fDumpStats );
+extern void          Abc_SclTimePerform( SC_Lib * pLib, Abc_Ntk_t * pNtk, int nTreeCRatio, int fUseWireLoads, int fShowAll, int fPrintPath, int fDumpStats, int nProcs );
 extern void          Abc_SclPrintBuffers( SC_Lib * pLib, Abc_Ntk_t * pNtk, int fVerbose );
 /*=== sclUpsize.c ===============================================================*/
 extern int           Abc_SclCountNearCriticalNodes( SC_Man * p );
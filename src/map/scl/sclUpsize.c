@@ -99,12 +99,14 @@ Vec_Int_t * Abc_SclFindCriticalCoWindow( SC_Man * p, int Window )
 {
     float fMaxArr = Abc_SclReadMaxDelay( p ) * (100.0 - Window) / 100.0;
     Vec_Int_t * vPivots;
-    Abc_Obj_t * pObj;
-    int i;
+    int i, iCo;
+    // the queue of COs is ordered by their arrival times
     vPivots = Vec_IntAlloc( 100 );
-    Abc_NtkForEachCo( p->pNtk, pObj, i )
-        if ( Abc_SclObjTimeMax(p, pObj) >= fMaxArr )
-            Vec_IntPush( vPivots, Abc_ObjId(pObj) );
+    Vec_QueCollectAbove( p->vQue, fMaxArr, vPivots );
+    // keep the COs in their original order
+    Vec_IntSort( vPivots, 0 );
+    Vec_IntForEachEntry( vPivots, iCo, i )
+        Vec_IntWriteEntry( vPivots, i, Abc_ObjId(Abc_NtkCo(p->pNtk, iCo)) );
     assert( Vec_IntSize(vPivots) > 0 );
     return vPivots;
 }
@@ -890,7 +892,7 @@ void Abc_SclUpsizePerformInt( SC_Lib * pLib, Abc_Ntk_t * pNtk, SC_SizePars * pPa
     if ( pPars->Window == 1 )
         pPars->Window += (Abc_NtkNodeNum(pNtk) > 40000);
     // prepare the manager; collect init stats
-    p = Abc_SclManStart( pLib, pNtk, pPars->fUseWireLoads, pPars->fUseDept, 0, pPars->BuffTreeEst );
+    p = Abc_SclManStart( pLib, pNtk, pPars->fUseWireLoads, pPars->fUseDept, 0, pPars->BuffTreeEst, pPars->nProcs );
     p->timeTotal  = Abc_Clock();
     assert( p->vGatesBest == NULL );
     p->vGatesBest = Vec_IntDup( p->pNtk->vGates );
@@ -933,20 +935,10 @@ void Abc_SclUpsizePerformInt( SC_Lib * pLib, Abc_Ntk_t * pNtk, SC_SizePars * pPa
 
         // update timing information
         clk = Abc_Clock();
-        if ( pPars->fUseDept )
-        {
-            if ( Vec_IntSize(p->vChanged) && !(pPars->BypassFreq && i && (i % pPars->BypassFreq) == 0) )
-                nConeSize = Abc_SclTimeIncUpdate( p );
-            else
-                Abc_SclTimeNtkRecompute( p, NULL, NULL, pPars->fUseDept, 0 );
-        }
+        if ( Vec_IntSize(p->vChanged) && !(pPars->BypassFreq && i && (i % pPars->BypassFreq) == 0) )
+            nConeSize = Abc_SclTimeIncUpdate( p, pPars->fUseDept );
         else
-        {
-            Vec_Int_t * vTFO = Abc_SclFindTFO( p->pNtk, vPathNodes );
-            Abc_SclTimeCone( p, vTFO );
-            nConeSize = Vec_IntSize( vTFO );
-            Vec_IntFree( vTFO );
-        }
+            Abc_SclTimeNtkRecompute( p, NULL, NULL, pPars->fUseDept, 0 );
         p->timeTime += Abc_Clock() - clk;
 //        Abc_SclUpsizePrintDiffs( p, pLib, pNtk );
 
@@ -279,6 +279,20 @@ static inline abctime Abc_Clock()
     return (abctime) clock();
 #endif
 }
+// elapsed (wall-clock) time, which is needed to measure multi-threaded runs
+static inline abctime Abc_ClockWall()
+{
+#if (defined(LIN) || defined(LIN64)) && !(__APPLE__ & __MACH__) && !defined(__MINGW32__)
+    struct timespec ts;
+    if ( clock_gettime(CLOCK_MONOTONIC, &ts) < 0 ) 
+        return (abctime)-1;
+    abctime res = ((abctime) ts.tv_sec) * CLOCKS_PER_SEC;
+    res += (((abctime) ts.tv_nsec) * CLOCKS_PER_SEC) / 1000000000;
+    return res;
+#else
+    return (abctime) clock();
+#endif
+}
 
 // bridge communication
 #define BRIDGE_NETLIST           106
@@ -0,0 +1,303 @@
+/**CFile****************************************************************
+
+  FileName    [utilSimd.c]
+
+  SystemName  [ABC: Logic synthesis and verification system.]
+
+  PackageName [Vectorized kernels for bit-parallel simulation.]
+
+  Synopsis    [Vectorized kernels for bit-parallel simulation.]
+
+  Author      [Alan Mishchenko]
+  
+  Affiliation [UC Berkeley]
+
+  Date        [Ver. 1.0. Started - June 20, 2005.]
+
+  Revision    [$Id: utilSimd.c,v 1.00 2005/06/20 00:00:00 alanmi Exp $]
+
+***********************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "abc_global.h"
+#include "utilSimd.h"
+
+// the vector kernels are compiled for x86 using function-level target attributes,
+// so the rest of ABC does not need to be compiled with -mavx2 or -mavx512f
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__)) && (__GNUC__ >= 5 || defined(__clang__))
+#define UTIL_SIMD_X86
+#include <immintrin.h>
+#endif
+
+ABC_NAMESPACE_IMPL_START
+
+////////////////////////////////////////////////////////////////////////
+///                        DECLARATIONS                              ///
+////////////////////////////////////////////////////////////////////////
+
+static void Util_SimdAndInit( word * pOut, word * pIn0, word * pIn1, int fCompl0, int fCompl1, int nWords );
+static void Util_SimdXorInit( word * pOut, word * pIn0, word * pIn1, int fCompl, int nWords );
+static void Util_SimdMuxInit( word * pOut, word * pCtrl, word * pIn1, word * pIn0, int fCompl1, int fCompl0, int nWords );
+
+// the first call goes through the init functions, which select the kernels
+Util_SimdAnd_f Util_SimdAndPtr = Util_SimdAndInit;
+Util_SimdXor_f Util_SimdXorPtr = Util_SimdXorInit;
+Util_SimdMux_f Util_SimdMuxPtr = Util_SimdMuxInit;
+
+static Util_SimdType_t s_SimdType = UTIL_SIMD_NONE;
+
+////////////////////////////////////////////////////////////////////////
+///                     FUNCTION DEFINITIONS                         ///
+////////////////////////////////////////////////////////////////////////
+
+/**Function*************************************************************
+
+  Synopsis    [Scalar kernels.]
+
+  Description [Complementation is applied by XOR-ing with an all-ones mask,
+  so the inner loops have no branches.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static void Util_SimdAndScalar( word * pOut, word * pIn0, word * pIn1, int fCompl0, int fCompl1, int nWords )
+{
+    word Mask0 = fCompl0 ? ~(word)0 : 0;
+    word Mask1 = fCompl1 ? ~(word)0 : 0;
+    int w;
+    for ( w = 0; w < nWords; w++ )
+        pOut[w] = (pIn0[w] ^ Mask0) & (pIn1[w] ^ Mask1);
+}
+static void Util_SimdXorScalar( word * pOut, word * pIn0, word * pIn1, int fCompl, int nWords )
+{
+    word Mask = fCompl ? ~(word)0 : 0;
+    int w;
+    for ( w = 0; w < nWords; w++ )
+        pOut[w] = pIn0[w] ^ pIn1[w] ^ Mask;
+}
+static void Util_SimdMuxScalar( word * pOut, word * pCtrl, word * pIn1, word * pIn0, int fCompl1, int fCompl0, int nWords )
+{
+    word Mask0 = fCompl0 ? ~(word)0 : 0;
+    word Mask1 = fCompl1 ? ~(word)0 : 0;
+    int w;
+    for ( w = 0; w < nWords; w++ )
+        pOut[w] = (pCtrl[w] & (pIn1[w] ^ Mask1)) | (~pCtrl[w] & (pIn0[w] ^ Mask0));
+}
+
+#ifdef UTIL_SIMD_X86
+
+/**Function*************************************************************
+
+  Synopsis    [AVX2 kernels.]
+
+  Description [Process four words at a time using unaligned loads;
+  the remaining words are processed by the scalar kernels.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+__attribute__((target("avx2")))
+static void Util_SimdAndAvx2( word * pOut, word * pIn0, word * pIn1, int fCompl0, int fCompl1, int nWords )
+{
+    __m256i Mask0 = _mm256_set1_epi64x( fCompl0 ? -1 : 0 );
+    __m256i Mask1 = _mm256_set1_epi64x( fCompl1 ? -1 : 0 );
+    int w, nLimit = nWords & ~3;
+    for ( w = 0; w < nLimit; w += 4 )
+    {
+        __m256i In0 = _mm256_xor_si256( _mm256_loadu_si256((__m256i *)(pIn0 + w)), Mask0 );
+        __m256i In1 = _mm256_xor_si256( _mm256_loadu_si256((__m256i *)(pIn1 + w)), Mask1 );
+        _mm256_storeu_si256( (__m256i *)(pOut + w), _mm256_and_si256(In0, In1) );
+    }
+    Util_SimdAndScalar( pOut + w, pIn0 + w, pIn1 + w, fCompl0, fCompl1, nWords - w );
+}
+__attribute__((target("avx2")))
+static void Util_SimdXorAvx2( word * pOut, word * pIn0, word * pIn1, int fCompl, int nWords )
+{
+    __m256i Mask = _mm256_set1_epi64x( fCompl ? -1 : 0 );
+    int w, nLimit = nWords & ~3;
+    for ( w = 0; w < nLimit; w += 4 )
+    {
+        __m256i In0 = _mm256_loadu_si256( (__m256i *)(pIn0 + w) );
+        __m256i In1 = _mm256_loadu_si256( (__m256i *)(pIn1 + w) );
+        _mm256_storeu_si256( (__m256i *)(pOut + w), _mm256_xor_si256(_mm256_xor_si256(In0, In1), Mask) );
+    }
+    Util_SimdXorScalar( pOut + w, pIn0 + w, pIn1 + w, fCompl, nWords - w );
+}
+__attribute__((target("avx2")))
+static void Util_SimdMuxAvx2( word * pOut, word * pCtrl, word * pIn1, word * pIn0, int fCompl1, int fCompl0, int nWords )
+{
+    __m256i Mask0 = _mm256_set1_epi64x( fCompl0 ? -1 : 0 );
+    __m256i Mask1 = _mm256_set1_epi64x( fCompl1 ? -1 : 0 );
+    int w, nLimit = nWords & ~3;
+    for ( w = 0; w < nLimit; w += 4 )
+    {
+        __m256i Ctrl = _mm256_loadu_si256( (__m256i *)(pCtrl + w) );
+        __m256i In0  = _mm256_xor_si256( _mm256_loadu_si256((__m256i *)(pIn0 + w)), Mask0 );
+        __m256i In1  = _mm256_xor_si256( _mm256_loadu_si256((__m256i *)(pIn1 + w)), Mask1 );
+        // andnot computes (~Ctrl & In0)
+        _mm256_storeu_si256( (__m256i *)(pOut + w), _mm256_or_si256(_mm256_and_si256(Ctrl, In1), _mm256_andnot_si256(Ctrl, In0)) );
+    }
+    Util_SimdMuxScalar( pOut + w, pCtrl + w, pIn1 + w, pIn0 + w, fCompl1, fCompl0, nWords - w );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [AVX-512 kernels.]
+
+  Description [Process eight words at a time using unaligned loads;
+  the remaining words are processed by the AVX2 kernels.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+__attribute__((target("avx512f")))
+static void Util_SimdAndAvx512( word * pOut, word * pIn0, word * pIn1, int fCompl0, int fCompl1, int nWords )
+{
+    __m512i Mask0 = _mm512_set1_epi64( fCompl0 ? -1 : 0 );
+    __m512i Mask1 = _mm512_set1_epi64( fCompl1 ? -1 : 0 );
+    int w, nLimit = nWords & ~7;
+    for ( w = 0; w < nLimit; w += 8 )
+    {
+        __m512i In0 = _mm512_xor_si512( _mm512_loadu_si512((void *)(pIn0 + w)), Mask0 );
+        __m512i In1 = _mm512_xor_si512( _mm512_loadu_si512((void *)(pIn1 + w)), Mask1 );
+        _mm512_storeu_si512( (void *)(pOut + w), _mm512_and_si512(In0, In1) );
+    }
+    Util_SimdAndAvx2( pOut + w, pIn0 + w, pIn1 + w, fCompl0, fCompl1, nWords - w );
+}
+__attribute__((target("avx512f")))
+static void Util_SimdXorAvx512( word * pOut, word * pIn0, word * pIn1, int fCompl, int nWords )
+{
+    __m512i Mask = _mm512_set1_epi64( fCompl ? -1 : 0 );
+    int w, nLimit = nWords & ~7;
+    for ( w = 0; w < nLimit; w += 8 )
+    {
+        __m512i In0 = _mm512_loadu_si512( (void *)(pIn0 + w) );
+        __m512i In1 = _mm512_loadu_si512( (void *)(pIn1 + w) );
+        _mm512_storeu_si512( (void *)(pOut + w), _mm512_xor_si512(_mm512_xor_si512(In0, In1), Mask) );
+    }
+    Util_SimdXorAvx2( pOut + w, pIn0 + w, pIn1 + w, fCompl, nWords - w );
+}
+__attribute__((target("avx512f")))
+static void Util_SimdMuxAvx512( word * pOut, word * pCtrl, word * pIn1, word * pIn0, int fCompl1, int fCompl0, int nWords )
+{
+    __m512i Mask0 = _mm512_set1_epi64( fCompl0 ? -1 : 0 );
+    __m512i Mask1 = _mm512_set1_epi64( fCompl1 ? -1 : 0 );
+    int w, nLimit = nWords & ~7;
+    for ( w = 0; w < nLimit; w += 8 )
+    {
+        __m512i Ctrl = _mm512_loadu_si512( (void *)(pCtrl + w) );
+        __m512i In0  = _mm512_xor_si512( _mm512_loadu_si512((void *)(pIn0 + w)), Mask0 );
+        __m512i In1  = _mm512_xor_si512( _mm512_loadu_si512((void *)(pIn1 + w)), Mask1 );
+        _mm512_storeu_si512( (void *)(pOut + w), _mm512_or_si512(_mm512_and_si512(Ctrl, In1), _mm512_andnot_si512(Ctrl, In0)) );
+    }
+    Util_SimdMuxAvx2( pOut + w, pCtrl + w, pIn1 + w, pIn0 + w, fCompl1, fCompl0, nWords - w );
+}
+
+#endif
+
+/**Function*************************************************************
+
+  Synopsis    [Selects the kernels.]
+
+  Description [If Type is UTIL_SIMD_NONE, the best instruction set
+  supported by the CPU is detected at run time. Otherwise, the given
+  instruction set is used if supported, which is useful for comparing
+  the kernels. Returns the instruction set selected.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static Util_SimdType_t Util_SimdDetect()
+{
+#ifdef UTIL_SIMD_X86
+    __builtin_cpu_init();
+    if ( __builtin_cpu_supports("avx512f") )
+        return UTIL_SIMD_AVX512;
+    if ( __builtin_cpu_supports("avx2") )
+        return UTIL_SIMD_AVX2;
+#endif
+    return UTIL_SIMD_SCALAR;
+}
+Util_SimdType_t Util_SimdSelect( Util_SimdType_t Type )
+{
+    Util_SimdType_t TypeBest = Util_SimdDetect();
+    if ( Type == UTIL_SIMD_NONE || Type > TypeBest )
+        Type = TypeBest;
+    Util_SimdAndPtr = Util_SimdAndScalar;
+    Util_SimdXorPtr = Util_SimdXorScalar;
+    Util_SimdMuxPtr = Util_SimdMuxScalar;
+#ifdef UTIL_SIMD_X86
+    if ( Type == UTIL_SIMD_AVX2 )
+    {
+        Util_SimdAndPtr = Util_SimdAndAvx2;
+        Util_SimdXorPtr = Util_SimdXorAvx2;
+        Util_SimdMuxPtr = Util_SimdMuxAvx2;
+    }
+    else if ( Type == UTIL_SIMD_AVX512 )
+    {
+        Util_SimdAndPtr = Util_SimdAndAvx512;
+        Util_SimdXorPtr = Util_SimdXorAvx512;
+        Util_SimdMuxPtr = Util_SimdMuxAvx512;
+    }
+#endif
+    return (s_SimdType = Type);
+}
+Util_SimdType_t Util_SimdType()
+{
+    if ( s_SimdType == UTIL_SIMD_NONE )
+        Util_SimdSelect( UTIL_SIMD_NONE );
+    return s_SimdType;
+}
+const char * Util_SimdTypeName( Util_SimdType_t Type )
+{
+    if ( Type == UTIL_SIMD_SCALAR ) return "scalar";
+    if ( Type == UTIL_SIMD_AVX2 )   return "AVX2";
+    if ( Type == UTIL_SIMD_AVX512 ) return "AVX-512";
+    return "none";
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Selects the kernels at the first call.]
+
+  Description [Selection is idempotent, so concurrent first calls
+  from several threads produce the same pointers.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static void Util_SimdAndInit( word * pOut, word * pIn0, word * pIn1, int fCompl0, int fCompl1, int nWords )
+{
+    Util_SimdType();
+    Util_SimdAndPtr( pOut, pIn0, pIn1, fCompl0, fCompl1, nWords );
+}
+static void Util_SimdXorInit( word * pOut, word * pIn0, word * pIn1, int fCompl, int nWords )
+{
+    Util_SimdType();
+    Util_SimdXorPtr( pOut, pIn0, pIn1, fCompl, nWords );
+}
+static void Util_SimdMuxInit( word * pOut, word * pCtrl, word * pIn1, word * pIn0, int fCompl1, int fCompl0, int nWords )
+{
+    Util_SimdType();
+    Util_SimdMuxPtr( pOut, pCtrl, pIn1, pIn0, fCompl1, fCompl0, nWords );
+}
+
+////////////////////////////////////////////////////////////////////////
+///                       END OF FILE                                ///
+////////////////////////////////////////////////////////////////////////
+
+
+ABC_NAMESPACE_IMPL_END
@@ -0,0 +1,84 @@
+/**CFile****************************************************************
+
+  FileName    [utilSimd.h]
+
+  SystemName  [ABC: Logic synthesis and verification system.]
+
+  PackageName [Vectorized kernels for bit-parallel simulation.]
+
+  Synopsis    [Vectorized kernels for bit-parallel simulation.]
+
+  Author      [Alan Mishchenko]
+  
+  Affiliation [UC Berkeley]
+
+  Date        [Ver. 1.0. Started - June 20, 2005.]
+
+  Revision    [$Id: utilSimd.h,v 1.00 2005/06/20 00:00:00 alanmi Exp $]
+
+***********************************************************************/
+ 
+#ifndef ABC__misc__util__utilSimd_h
+#define ABC__misc__util__utilSimd_h
+
+////////////////////////////////////////////////////////////////////////
+///                          INCLUDES                                ///
+////////////////////////////////////////////////////////////////////////
+
+#include "misc/util/abc_global.h"
+
+////////////////////////////////////////////////////////////////////////
+///                         PARAMETERS                               ///
+////////////////////////////////////////////////////////////////////////
+
+ABC_NAMESPACE_HEADER_START
+
+////////////////////////////////////////////////////////////////////////
+///                         BASIC TYPES                              ///
+////////////////////////////////////////////////////////////////////////
+
+// the instruction set used by the kernels
+typedef enum { 
+    UTIL_SIMD_NONE = 0,           // 0: not selected yet
+    UTIL_SIMD_SCALAR,             // 1: 64-bit words
+    UTIL_SIMD_AVX2,               // 2: 256-bit vectors
+    UTIL_SIMD_AVX512              // 3: 512-bit vectors
+} Util_SimdType_t;
+
+// pOut = (pIn0 ^ fCompl0) & (pIn1 ^ fCompl1)
+typedef void (*Util_SimdAnd_f)( word * pOut, word * pIn0, word * pIn1, int fCompl0, int fCompl1, int nWords );
+// pOut = pIn0 ^ pIn1 ^ fCompl
+typedef void (*Util_SimdXor_f)( word * pOut, word * pIn0, word * pIn1, int fCompl, int nWords );
+// pOut = (pCtrl & (pIn1 ^ fCompl1)) | (~pCtrl & (pIn0 ^ fCompl0))
+typedef void (*Util_SimdMux_f)( word * pOut, word * pCtrl, word * pIn1, word * pIn0, int fCompl1, int fCompl0, int nWords );
+
+////////////////////////////////////////////////////////////////////////
+///                      MACRO DEFINITIONS                           ///
+////////////////////////////////////////////////////////////////////////
+
+extern Util_SimdAnd_f Util_SimdAndPtr;
+extern Util_SimdXor_f Util_SimdXorPtr;
+extern Util_SimdMux_f Util_SimdMuxPtr;
+
+// the kernels are selected by the first call
+static inline void Util_SimdAnd( word * pOut, word * pIn0, word * pIn1, int fCompl0, int fCompl1, int nWords )                 { Util_SimdAndPtr( pOut, pIn0, pIn1, fCompl0, fCompl1, nWords );         }
+static inline void Util_SimdXor( word * pOut, word * pIn0, word * pIn1, int fCompl, int nWords )                               { Util_SimdXorPtr( pOut, pIn0, pIn1, fCompl, nWords );                   }
+static inline void Util_SimdMux( word * pOut, word * pCtrl, word * pIn1, word * pIn0, int fCompl1, int fCompl0, int nWords )  { Util_SimdMuxPtr( pOut, pCtrl, pIn1, pIn0, fCompl1, fCompl0, nWords );  }
+
+////////////////////////////////////////////////////////////////////////
+///                    FUNCTION DECLARATIONS                         ///
+////////////////////////////////////////////////////////////////////////
+
+/*=== utilSimd.c ==========================================================*/
+
+extern Util_SimdType_t Util_SimdSelect( Util_SimdType_t Type );
+extern Util_SimdType_t Util_SimdType();
+extern const char *    Util_SimdTypeName( Util_SimdType_t Type );
+
+ABC_NAMESPACE_HEADER_END
+
+#endif
+
+////////////////////////////////////////////////////////////////////////
+///                       END OF FILE                                ///
+////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,664 @@
+/**CFile****************************************************************
+
+  FileName    [utilTask.c]
+
+  SystemName  [ABC: Logic synthesis and verification system.]
+
+  PackageName [Work-stealing task scheduler.]
+
+  Synopsis    [Work-stealing task scheduler.]
+
+  Author      [Alan Mishchenko]
+
+  Affiliation [UC Berkeley]
+
+  Date        [Ver. 1.0. Started - June 20, 2005.]
+
+  Revision    [$Id: utilTask.c,v 1.00 2005/06/20 00:00:00 alanmi Exp $]
+
+***********************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <assert.h>
+
+#include "utilTask.h"
+
+#ifdef ABC_USE_PTHREADS
+
+#include <errno.h>
+#include <time.h>
+
+#ifdef _WIN32
+#include "../lib/pthread.h"
+#include <sys/timeb.h>
+#else
+#include <pthread.h>
+#include <unistd.h>
+#endif
+
+#endif
+
+ABC_NAMESPACE_IMPL_START
+
+////////////////////////////////////////////////////////////////////////
+///                        DECLARATIONS                              ///
+////////////////////////////////////////////////////////////////////////
+
+#define PAR_THR_MAX 100
+
+struct Util_Task_t_
+{
+    Util_TaskFunc_t  pFunc;       // the procedure
+    void *           pArg;        // its argument
+    void *           pResult;     // its result
+    Util_Pool_t *    pPool;       // the pool
+    int              fDetached;   // the task is freed when done
+    volatile int     fDone;       // the task is done
+};
+
+#ifndef ABC_USE_PTHREADS
+
+struct Util_Pool_t_
+{
+    volatile int     fCancel;     // cancelation request
+};
+
+#else // pthreads are used
+
+// the deque of one worker: tasks in [iHead, nTasks) are waiting
+typedef struct Util_Deque_t_
+{
+    pthread_mutex_t  Mutex;       // protects this deque
+    Util_Task_t **   pTasks;      // the tasks
+    int              nCap;        // the capacity
+    int              iHead;       // the first task (stolen by others)
+    int              nTasks;      // the end of the tasks (taken by the owner)
+} Util_Deque_t;
+
+typedef struct Util_Worker_t_
+{
+    Util_Pool_t *    pPool;       // the pool
+    int              iWorker;     // the worker ID
+    unsigned         Seed;        // the seed for choosing victims
+} Util_Worker_t;
+
+struct Util_Pool_t_
+{
+    int              nThreads;    // the number of workers
+    pthread_t *      pThreads;    // the worker threads
+    Util_Worker_t *  pWorkers;    // the worker data
+    Util_Deque_t *   pDeques;     // the deques of the workers
+    pthread_key_t    Key;         // the worker of the current thread
+    pthread_mutex_t  Mutex;       // protects the counters below
+    pthread_cond_t   Cond;        // signals new tasks and finished tasks
+    int              nQueued;     // the number of tasks in the deques
+    int              nPending;    // the number of tasks not finished
+    int              iNext;       // the next deque for external tasks
+    int              fStop;       // the workers should quit
+    volatile int     fCancel;     // cancelation request
+};
+
+#endif // pthreads are used
+
+////////////////////////////////////////////////////////////////////////
+///                     FUNCTION DEFINITIONS                         ///
+////////////////////////////////////////////////////////////////////////
+
+#ifndef ABC_USE_PTHREADS
+
+Util_Pool_t * Util_PoolStart( int nThreads )                   { return ABC_CALLOC( Util_Pool_t, 1 );         }
+void          Util_PoolStop( Util_Pool_t * p )                 { ABC_FREE( p );                               }
+int           Util_PoolThreadNum( Util_Pool_t * p )            { return 1;                                    }
+void          Util_PoolWaitIdle( Util_Pool_t * p )             { p->fCancel = 0;                              }
+int           Util_PoolWaitIdleTimed( Util_Pool_t * p, int nMs ) { p->fCancel = 0; return 1;                  }
+void          Util_PoolCancel( Util_Pool_t * p )               { p->fCancel = 1;                              }
+int           Util_PoolIsCanceled( Util_Pool_t * p )           { return p->fCancel;                           }
+void *        Util_TaskWait( Util_Task_t * pTask )             { return pTask->pResult;                       }
+int           Util_TaskWaitTimed( Util_Task_t * pTask, int nMs ) { return 1;                                  }
+void          Util_TaskFree( Util_Task_t * pTask )             { ABC_FREE( pTask );                           }
+int           Util_TaskWorkerId( Util_Pool_t * p )             { return 0;                                    }
+Util_Task_t * Util_PoolSubmit( Util_Pool_t * p, Util_TaskFunc_t pFunc, void * pArg )
+{
+    Util_Task_t * pTask = ABC_CALLOC( Util_Task_t, 1 );
+    pTask->pPool   = p;
+    pTask->pResult = pFunc( pArg );
+    pTask->fDone   = 1;
+    return pTask;
+}
+void Util_PoolSpawn( Util_Pool_t * p, Util_TaskFunc_t pFunc, void * pArg )
+{
+    pFunc( pArg );
+}
+
+#else // pthreads are used
+
+/**Function*************************************************************
+
+  Synopsis    [Adds the task to the tail of the deque.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static void Util_DequePush( Util_Deque_t * q, Util_Task_t * pTask )
+{
+    int status = pthread_mutex_lock( &q->Mutex );  assert( status == 0 );
+    if ( q->nTasks == q->nCap )
+    {
+        if ( q->iHead > 0 )
+        {
+            // reclaim the space freed by the thieves
+            memmove( q->pTasks, q->pTasks + q->iHead, sizeof(Util_Task_t *) * (q->nTasks - q->iHead) );
+            q->nTasks -= q->iHead;
+            q->iHead = 0;
+        }
+        if ( q->nTasks > q->nCap / 2 )
+        {
+            q->nCap = 2 * q->nCap;
+            q->pTasks = ABC_REALLOC( Util_Task_t *, q->pTasks, q->nCap );
+        }
+    }
+    q->pTasks[q->nTasks++] = pTask;
+    status = pthread_mutex_unlock( &q->Mutex );  assert( status == 0 );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Takes the task from the tail (fOwner) or from the head.]
+
+  Description [The owner takes the most recent task, which is likely to
+  share data with the task it has just finished. The thieves take the
+  oldest task, which is likely to be the largest piece of work.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static Util_Task_t * Util_DequePop( Util_Deque_t * q, int fOwner )
+{
+    Util_Task_t * pTask = NULL;
+    int status = pthread_mutex_lock( &q->Mutex );  assert( status == 0 );
+    if ( q->iHead < q->nTasks )
+    {
+        pTask = fOwner ? q->pTasks[--q->nTasks] : q->pTasks[q->iHead++];
+        if ( q->iHead == q->nTasks )
+            q->iHead = q->nTasks = 0;
+    }
+    status = pthread_mutex_unlock( &q->Mutex );  assert( status == 0 );
+    return pTask;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Finds a task for the given worker.]
+
+  Description [The worker first looks at its own deque, then tries to
+  steal from the other deques, starting from a random victim.
+  The external threads (iWorker == -1) only steal.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static Util_Task_t * Util_PoolFindTask( Util_Pool_t * p, int iWorker )
+{
+    Util_Task_t * pTask = NULL;
+    int i, iStart, status;
+    if ( iWorker >= 0 )
+        pTask = Util_DequePop( p->pDeques + iWorker, 1 );
+    if ( pTask == NULL )
+    {
+        if ( iWorker >= 0 )
+        {
+            Util_Worker_t * pWorker = p->pWorkers + iWorker;
+            pWorker->Seed = 1103515245 * pWorker->Seed + 12345;
+            iStart = (pWorker->Seed >> 16) % p->nThreads;
+        }
+        else
+            iStart = 0;
+        for ( i = 0; i < p->nThreads && pTask == NULL; i++ )
+            if ( (iStart + i) % p->nThreads != iWorker )
+                pTask = Util_DequePop( p->pDeques + (iStart + i) % p->nThreads, 0 );
+    }
+    if ( pTask == NULL )
+        return NULL;
+    status = pthread_mutex_lock( &p->Mutex );    assert( status == 0 );
+    p->nQueued--;
+    status = pthread_mutex_unlock( &p->Mutex );  assert( status == 0 );
+    return pTask;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Performs the task and records its completion.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static void Util_PoolRunTask( Util_Pool_t * p, Util_Task_t * pTask )
+{
+    int status;
+    pTask->pResult = pTask->pFunc( pTask->pArg );
+    status = pthread_mutex_lock( &p->Mutex );    assert( status == 0 );
+    p->nPending--;
+    pTask->fDone = 1;
+    if ( pTask->fDetached )
+        ABC_FREE( pTask );
+    status = pthread_cond_broadcast( &p->Cond ); assert( status == 0 );
+    status = pthread_mutex_unlock( &p->Mutex );  assert( status == 0 );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [The worker thread.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static void * Util_PoolWorkerThread( void * pArg )
+{
+    Util_Worker_t * pWorker = (Util_Worker_t *)pArg;
+    Util_Pool_t * p = pWorker->pPool;
+    Util_Task_t * pTask;
+    int status = pthread_setspecific( p->Key, pWorker );  assert( status == 0 );
+    while ( 1 )
+    {
+        pTask = Util_PoolFindTask( p, pWorker->iWorker );
+        if ( pTask )
+        {
+            Util_PoolRunTask( p, pTask );
+            continue;
+        }
+        status = pthread_mutex_lock( &p->Mutex );    assert( status == 0 );
+        while ( p->nQueued == 0 && !p->fStop )
+        {
+            status = pthread_cond_wait( &p->Cond, &p->Mutex );
+            assert( status == 0 );
+        }
+        if ( p->nQueued == 0 && p->fStop )
+        {
+            status = pthread_mutex_unlock( &p->Mutex );  assert( status == 0 );
+            break;
+        }
+        status = pthread_mutex_unlock( &p->Mutex );  assert( status == 0 );
+    }
+    return NULL;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Starts the pool with the given number of worker threads.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Util_Pool_t * Util_PoolStart( int nThreads )
+{
+    Util_Pool_t * p;
+    int i, status;
+    nThreads = Abc_MinInt( Abc_MaxInt(nThreads, 1), PAR_THR_MAX );
+    p = ABC_CALLOC( Util_Pool_t, 1 );
+    p->nThreads = nThreads;
+    p->pThreads = ABC_CALLOC( pthread_t, nThreads );
+    p->pWorkers = ABC_CALLOC( Util_Worker_t, nThreads );
+    p->pDeques  = ABC_CALLOC( Util_Deque_t, nThreads );
+    status = pthread_key_create( &p->Key, NULL );    assert( status == 0 );
+    status = pthread_mutex_init( &p->Mutex, NULL );  assert( status == 0 );
+    status = pthread_cond_init( &p->Cond, NULL );    assert( status == 0 );
+    for ( i = 0; i < nThreads; i++ )
+    {
+        status = pthread_mutex_init( &p->pDeques[i].Mutex, NULL );  assert( status == 0 );
+        p->pDeques[i].nCap   = 64;
+        p->pDeques[i].pTasks = ABC_ALLOC( Util_Task_t *, p->pDeques[i].nCap );
+        p->pWorkers[i].pPool   = p;
+        p->pWorkers[i].iWorker = i;
+        p->pWorkers[i].Seed    = 0x9E3779B9 * (i + 1);
+    }
+    for ( i = 0; i < nThreads; i++ )
+    {
+        status = pthread_create( p->pThreads + i, NULL, Util_PoolWorkerThread, (void *)(p->pWorkers + i) );
+        assert( status == 0 );
+    }
+    return p;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Finishes the remaining tasks and stops the pool.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Util_PoolStop( Util_Pool_t * p )
+{
+    int i, status;
+    Util_PoolWaitIdle( p );
+    status = pthread_mutex_lock( &p->Mutex );    assert( status == 0 );
+    p->fStop = 1;
+    status = pthread_cond_broadcast( &p->Cond ); assert( status == 0 );
+    status = pthread_mutex_unlock( &p->Mutex );  assert( status == 0 );
+    for ( i = 0; i < p->nThreads; i++ )
+    {
+        status = pthread_join( p->pThreads[i], NULL );  assert( status == 0 );
+    }
+    for ( i = 0; i < p->nThreads; i++ )
+    {
+        pthread_mutex_destroy( &p->pDeques[i].Mutex );
+        ABC_FREE( p->pDeques[i].pTasks );
+    }
+    pthread_cond_destroy( &p->Cond );
+    pthread_mutex_destroy( &p->Mutex );
+    pthread_key_delete( p->Key );
+    ABC_FREE( p->pDeques );
+    ABC_FREE( p->pWorkers );
+    ABC_FREE( p->pThreads );
+    ABC_FREE( p );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Returns the number of workers.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Util_PoolThreadNum( Util_Pool_t * p )
+{
+    return p->nThreads;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Returns the ID of the worker running the current thread.]
+
+  Description [Returns -1 if the caller is not a worker of this pool.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Util_TaskWorkerId( Util_Pool_t * p )
+{
+    Util_Worker_t * pWorker = (Util_Worker_t *)pthread_getspecific( p->Key );
+    return pWorker ? pWorker->iWorker : -1;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Submits the task to the pool.]
+
+  Description [If called from a task, the new task is added to the deque
+  of the current worker. Otherwise, the deques are used in turn.
+  The task is counted as queued before it is added to the deque, so that
+  the worker taking it never makes the counter negative; a worker woken 
+  in between finds no task and checks the counter again.
+  Util_PoolSubmit() returns the handle, which should be waited for and
+  freed by the user. Util_PoolSpawn() frees the task when it is done.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static Util_Task_t * Util_PoolSubmitInt( Util_Pool_t * p, Util_TaskFunc_t pFunc, void * pArg, int fDetached )
+{
+    Util_Task_t * pTask = ABC_CALLOC( Util_Task_t, 1 );
+    int status, iWorker = Util_TaskWorkerId( p );
+    pTask->pFunc     = pFunc;
+    pTask->pArg      = pArg;
+    pTask->pPool     = p;
+    pTask->fDetached = fDetached;
+    status = pthread_mutex_lock( &p->Mutex );    assert( status == 0 );
+    p->nPending++;
+    p->nQueued++;
+    if ( iWorker == -1 )
+        iWorker = p->iNext++ % p->nThreads;
+    status = pthread_mutex_unlock( &p->Mutex );  assert( status == 0 );
+    Util_DequePush( p->pDeques + iWorker, pTask );
+    status = pthread_mutex_lock( &p->Mutex );    assert( status == 0 );
+    status = pthread_cond_broadcast( &p->Cond ); assert( status == 0 );
+    status = pthread_mutex_unlock( &p->Mutex );  assert( status == 0 );
+    return pTask;
+}
+Util_Task_t * Util_PoolSubmit( Util_Pool_t * p, Util_TaskFunc_t pFunc, void * pArg )
+{
+    return Util_PoolSubmitInt( p, pFunc, pArg, 0 );
+}
+void Util_PoolSpawn( Util_Pool_t * p, Util_TaskFunc_t pFunc, void * pArg )
+{
+    Util_PoolSubmitInt( p, pFunc, pArg, 1 );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Waits for the task to finish and returns its result.]
+
+  Description [When called from a worker, the worker keeps performing
+  other tasks while waiting, so that nested tasks cannot deadlock.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void * Util_TaskWait( Util_Task_t * pTask )
+{
+    Util_Pool_t * p = pTask->pPool;
+    Util_Task_t * pOther;
+    int status, iWorker = Util_TaskWorkerId( p );
+    while ( 1 )
+    {
+        if ( iWorker >= 0 && !pTask->fDone && (pOther = Util_PoolFindTask(p, iWorker)) )
+        {
+            Util_PoolRunTask( p, pOther );
+            continue;
+        }
+        status = pthread_mutex_lock( &p->Mutex );    assert( status == 0 );
+        while ( !pTask->fDone && (iWorker == -1 || p->nQueued == 0) )
+        {
+            status = pthread_cond_wait( &p->Cond, &p->Mutex );
+            assert( status == 0 );
+        }
+        status = pthread_mutex_unlock( &p->Mutex );  assert( status == 0 );
+        if ( pTask->fDone )
+            return pTask->pResult;
+    }
+    return NULL;
+}
+void Util_TaskFree( Util_Task_t * pTask )
+{
+    assert( pTask->fDone && !pTask->fDetached );
+    ABC_FREE( pTask );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Computes the absolute time for the timed waits.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static void Util_PoolDeadline( struct timespec * pTime, int nMilliSecs )
+{
+#ifdef _WIN32
+    struct _timeb tb;
+    _ftime( &tb );
+    pTime->tv_sec  = (long)tb.time;
+    pTime->tv_nsec = (long)tb.millitm * 1000000;
+#else
+    clock_gettime( CLOCK_REALTIME, pTime );
+#endif
+    pTime->tv_sec  += nMilliSecs / 1000;
+    pTime->tv_nsec += (long)(nMilliSecs % 1000) * 1000000;
+    if ( pTime->tv_nsec >= 1000000000 )
+    {
+        pTime->tv_sec++;
+        pTime->tv_nsec -= 1000000000;
+    }
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Waits for the task to finish within the time limit.]
+
+  Description [Returns 1 if the task is done before the time limit (in
+  milliseconds) expires, and 0 otherwise. After 1 is returned, the result
+  is available through Util_TaskWait(), which does not wait in this case.
+  The task is not stopped when the time limit expires. A worker waiting
+  for the task keeps performing other tasks, so it may notice the expired 
+  time limit only after finishing the current one.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Util_TaskWaitTimed( Util_Task_t * pTask, int nMilliSecs )
+{
+    Util_Pool_t * p = pTask->pPool;
+    Util_Task_t * pOther;
+    struct timespec Deadline;
+    int status, RetValue = 0, iWorker = Util_TaskWorkerId( p );
+    Util_PoolDeadline( &Deadline, nMilliSecs );
+    while ( 1 )
+    {
+        if ( iWorker >= 0 && !pTask->fDone && (pOther = Util_PoolFindTask(p, iWorker)) )
+        {
+            Util_PoolRunTask( p, pOther );
+            continue;
+        }
+        status = pthread_mutex_lock( &p->Mutex );    assert( status == 0 );
+        while ( !pTask->fDone && (iWorker == -1 || p->nQueued == 0) && RetValue != ETIMEDOUT )
+        {
+            RetValue = pthread_cond_timedwait( &p->Cond, &p->Mutex, &Deadline );
+            assert( RetValue == 0 || RetValue == ETIMEDOUT );
+        }
+        status = pthread_mutex_unlock( &p->Mutex );  assert( status == 0 );
+        if ( pTask->fDone )
+            return 1;
+        if ( RetValue == ETIMEDOUT )
+            return 0;
+    }
+    return 0;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Waits until all tasks, including spawned ones, are done.]
+
+  Description [Should be called by an external thread. Resets the
+  cancelation request after the pool becomes idle.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Util_PoolWaitIdle( Util_Pool_t * p )
+{
+    int status;
+    assert( Util_TaskWorkerId(p) == -1 );
+    status = pthread_mutex_lock( &p->Mutex );    assert( status == 0 );
+    while ( p->nPending > 0 )
+    {
+        status = pthread_cond_wait( &p->Cond, &p->Mutex );
+        assert( status == 0 );
+    }
+    p->fCancel = 0;
+    status = pthread_mutex_unlock( &p->Mutex );  assert( status == 0 );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Waits until all tasks are done within the time limit.]
+
+  Description [Returns 1 if the pool becomes idle before the time limit
+  (in milliseconds) expires, and 0 otherwise. In the latter case, the 
+  tasks keep running and the cancelation request is not reset; the caller
+  can cancel the tasks and wait for the pool using Util_PoolWaitIdle().]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Util_PoolWaitIdleTimed( Util_Pool_t * p, int nMilliSecs )
+{
+    struct timespec Deadline;
+    int status, RetValue = 0;
+    assert( Util_TaskWorkerId(p) == -1 );
+    Util_PoolDeadline( &Deadline, nMilliSecs );
+    status = pthread_mutex_lock( &p->Mutex );    assert( status == 0 );
+    while ( p->nPending > 0 && RetValue != ETIMEDOUT )
+    {
+        RetValue = pthread_cond_timedwait( &p->Cond, &p->Mutex, &Deadline );
+        assert( RetValue == 0 || RetValue == ETIMEDOUT );
+    }
+    if ( (RetValue = (p->nPending == 0)) )
+        p->fCancel = 0;
+    status = pthread_mutex_unlock( &p->Mutex );  assert( status == 0 );
+    return RetValue;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Requests the tasks to stop early.]
+
+  Description [The cancelation is cooperative: the tasks are still
+  performed, but they can check Util_PoolIsCanceled() and return
+  without doing the work, after releasing their arguments.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Util_PoolCancel( Util_Pool_t * p )
+{
+    p->fCancel = 1;
+}
+int Util_PoolIsCanceled( Util_Pool_t * p )
+{
+    return p->fCancel;
+}
+
+#endif // pthreads are used
+
+////////////////////////////////////////////////////////////////////////
+///                       END OF FILE                                ///
+////////////////////////////////////////////////////////////////////////
+
+
+ABC_NAMESPACE_IMPL_END
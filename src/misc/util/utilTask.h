@@ -0,0 +1,77 @@
+/**CFile****************************************************************
+
+  FileName    [utilTask.h]
+
+  SystemName  [ABC: Logic synthesis and verification system.]
+
+  PackageName [Work-stealing task scheduler.]
+
+  Synopsis    [Work-stealing task scheduler.]
+
+  Author      [Alan Mishchenko]
+
+  Affiliation [UC Berkeley]
+
+  Date        [Ver. 1.0. Started - June 20, 2005.]
+
+  Revision    [$Id: utilTask.h,v 1.00 2005/06/20 00:00:00 alanmi Exp $]
+
+***********************************************************************/
+
+#ifndef ABC__misc__util__utilTask_h
+#define ABC__misc__util__utilTask_h
+
+////////////////////////////////////////////////////////////////////////
+///                          INCLUDES                                ///
+////////////////////////////////////////////////////////////////////////
+
+#include "misc/util/abc_global.h"
+
+////////////////////////////////////////////////////////////////////////
+///                         PARAMETERS                               ///
+////////////////////////////////////////////////////////////////////////
+
+ABC_NAMESPACE_HEADER_START
+
+////////////////////////////////////////////////////////////////////////
+///                         BASIC TYPES                              ///
+////////////////////////////////////////////////////////////////////////
+
+// The pool runs tasks on a fixed number of worker threads. Each worker
+// owns a deque of tasks: it takes the most recent task from the tail,
+// while idle workers steal the oldest tasks from the heads of other deques.
+// A task may submit more tasks; they go to the deque of its own worker.
+// Idle workers sleep on a condition variable (there is no busy waiting).
+// The waits for a task or for the whole pool can be limited in time;
+// the tasks still running when the time limit expires are not stopped
+// and can be canceled using Util_PoolCancel().
+// When pthreads are not used, the tasks are performed by the caller.
+
+typedef struct Util_Pool_t_ Util_Pool_t;
+typedef struct Util_Task_t_ Util_Task_t;
+
+typedef void * (*Util_TaskFunc_t)( void * pArg );
+
+////////////////////////////////////////////////////////////////////////
+///                    FUNCTION DECLARATIONS                         ///
+////////////////////////////////////////////////////////////////////////
+
+/*=== utilTask.c ==========================================================*/
+
+extern Util_Pool_t * Util_PoolStart( int nThreads );
+extern void          Util_PoolStop( Util_Pool_t * p );
+extern int           Util_PoolThreadNum( Util_Pool_t * p );
+extern Util_Task_t * Util_PoolSubmit( Util_Pool_t * p, Util_TaskFunc_t pFunc, void * pArg );
+extern void          Util_PoolSpawn( Util_Pool_t * p, Util_TaskFunc_t pFunc, void * pArg );
+extern void          Util_PoolWaitIdle( Util_Pool_t * p );
+extern int           Util_PoolWaitIdleTimed( Util_Pool_t * p, int nMilliSecs );
+extern void          Util_PoolCancel( Util_Pool_t * p );
+extern int           Util_PoolIsCanceled( Util_Pool_t * p );
+extern void *        Util_TaskWait( Util_Task_t * pTask );
+extern int           Util_TaskWaitTimed( Util_Task_t * pTask, int nMilliSecs );
+extern void          Util_TaskFree( Util_Task_t * pTask );
+extern int           Util_TaskWorkerId( Util_Pool_t * p );
+
+ABC_NAMESPACE_HEADER_END
+
+#endif
@@ -247,6 +247,32 @@ static inline int Vec_QuePop( Vec_Que_t * p )
     return Res;
 }
 
+/**Function*************************************************************
+
+  Synopsis    [Collects the entries whose priority is not below the limit.]
+
+  Description [Only visits the part of the heap above the limit, so the
+  runtime is proportional to the number of collected entries.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static inline void Vec_QueCollectAbove_rec( Vec_Que_t * p, int i, float Limit, Vec_Int_t * vRes )
+{
+    if ( i >= p->nSize || Vec_QuePrio(p, p->pHeap[i]) < Limit )
+        return;
+    Vec_IntPush( vRes, p->pHeap[i] );
+    Vec_QueCollectAbove_rec( p, 2*i,   Limit, vRes );
+    Vec_QueCollectAbove_rec( p, 2*i+1, Limit, vRes );
+}
+static inline void Vec_QueCollectAbove( Vec_Que_t * p, float Limit, Vec_Int_t * vRes )
+{
+    Vec_IntClear( vRes );
+    Vec_QueCollectAbove_rec( p, 1, Limit, vRes );
+}
+
 /**Function*************************************************************
 
   Synopsis    []
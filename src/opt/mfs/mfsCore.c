@@ -59,6 +59,7 @@ void Abc_NtkMfsParsDefault( Mfs_Par_t * pPars )
     pPars->fMoreEffort  =    0;
     pPars->fSwapEdge    =    0;
     pPars->fOneHotness  =    0;
+    pPars->fUseSim      =    1;
     pPars->fVerbose     =    0;
     pPars->fVeryVerbose =    0;
 }
@@ -236,6 +237,7 @@ void Abc_NtkMfsPowerResub( Mfs_Man_t * p, Mfs_Par_t * pPars)
 int Abc_NtkMfsResub( Mfs_Man_t * p, Abc_Obj_t * pNode )
 {
     abctime clk;
+    int fHopeless;
     p->nNodesTried++;
     // prepare data structure for this node
     Mfs_ManClean( p );
@@ -259,6 +261,19 @@ p->timeDiv += Abc_Clock() - clk;
 clk = Abc_Clock();
     p->pAigWin = Abc_NtkConstructAig( p, pNode );
 p->timeAig += Abc_Clock() - clk;
+    // filter the candidates using random simulation
+    if ( p->pPars->fUseSim && !p->pPars->fOneHotness && !p->pPars->fPower && !p->pPars->fSwapEdge )
+    {
+clk = Abc_Clock();
+        Abc_NtkMfsSimulateWindow( p );
+        fHopeless = !p->pPars->fMoreEffort && Abc_NtkMfsSimNodeIsHopeless( p, pNode );
+p->timeSim += Abc_Clock() - clk;
+        if ( fHopeless )
+        {
+            p->nSimNodes++;
+            return 1;
+        }
+    }
     // translate it into CNF
 clk = Abc_Clock();
     p->pCnf = Cnf_DeriveSimple( p->pAigWin, 1 + Vec_PtrSize(p->vDivs) );
@@ -45,6 +45,8 @@ ABC_NAMESPACE_HEADER_START
 
 
 #define MFS_FANIN_MAX   12
+#define MFS_SIM_WORDS    8    // the number of words of random simulation
+#define MFS_SIM_PAIRS   32    // the largest number of pairs seeded by simulation
 
 typedef struct Mfs_Man_t_ Mfs_Man_t;
 struct Mfs_Man_t_
@@ -69,6 +71,11 @@ struct Mfs_Man_t_
     int                 nCexes;    // the numbe rof current counter-examples
     int                 nSatCalls; 
     int                 nSatCexes;
+    // random simulation of the window
+    Vec_Wrd_t *         vSims;     // simulation info of the window AIG objects
+    Vec_Wrd_t *         vSimOuts;  // care set, node function, and divisor functions
+    Vec_Int_t *         vSimKeys;  // the first onset/offset pattern of each fanin key
+    int                 fSimValid; // the simulation info is computed for the window
 /*
     // intermediate AIG data
     Gia_Man_t *         pGia;      // replica of the AIG in the new package
@@ -115,6 +122,9 @@ struct Mfs_Man_t_
     int                 nTimeOutsLevel;
     int                 nDcMints;
     int                 nMaxDivs;
+    int                 nSimPairs;   // counter-examples derived by simulation
+    int                 nSimSkips;   // SAT calls skipped due to simulation
+    int                 nSimNodes;   // nodes skipped due to simulation
     double              dTotalRatios;
     // node/edge stats
     int                 nTotalNodesBeg;
@@ -129,6 +139,7 @@ struct Mfs_Man_t_
     abctime             timeAig;
     abctime             timeGia;
     abctime             timeCnf;
+    abctime             timeSim;
     abctime             timeSat;
     abctime             timeInt;
     abctime             timeTotal;
@@ -164,6 +175,10 @@ extern int              Abc_NtkMfsEdgeSwapEval( Mfs_Man_t * p, Abc_Obj_t * pNode
 extern int              Abc_NtkMfsEdgePower( Mfs_Man_t * p, Abc_Obj_t * pNode );
 extern int              Abc_NtkMfsResubNode( Mfs_Man_t * p, Abc_Obj_t * pNode );
 extern int              Abc_NtkMfsResubNode2( Mfs_Man_t * p, Abc_Obj_t * pNode );
+/*=== mfsSim.c ==========================================================*/
+extern void             Abc_NtkMfsSimulateWindow( Mfs_Man_t * p );
+extern int              Abc_NtkMfsSimSeedCexes( Mfs_Man_t * p, Abc_Obj_t * pNode, int iFanin, int iFanin2 );
+extern int              Abc_NtkMfsSimNodeIsHopeless( Mfs_Man_t * p, Abc_Obj_t * pNode );
 /*=== mfsSat.c ==========================================================*/
 extern int              Abc_NtkMfsSolveSat( Mfs_Man_t * p, Abc_Obj_t * pNode );
 extern int              Abc_NtkAddOneHotness( Mfs_Man_t * p );
@@ -58,6 +58,8 @@ Mfs_Man_t * Mfs_ManAlloc( Mfs_Par_t * pPars )
     p->vMem      = Vec_IntAlloc( 0 );
     p->vLevels   = Vec_VecStart( 32 );
     p->vMfsFanins= Vec_PtrAlloc( 32 );
+    if ( p->pPars->fUseSim )
+        Aig_ManRandom64( 1 );
     return p;
 }
 
@@ -95,6 +97,7 @@ void Mfs_ManClean( Mfs_Man_t * p )
     p->vSupp   = NULL;
     p->vNodes  = NULL;
     p->vDivs   = NULL;
+    p->fSimValid = 0;
 }
 
 /**Function*************************************************************
@@ -125,6 +128,10 @@ void Mfs_ManPrint( Mfs_Man_t * p )
         printf( "Edges  %6d out of %6d (%6.2f %%)   ", p->nTotalEdgesBeg-p->nTotalEdgesEnd, p->nTotalEdgesBeg, 100.0*(p->nTotalEdgesBeg-p->nTotalEdgesEnd)/Abc_MaxInt(1, p->nTotalEdgesBeg) );
         printf( "\n" );
 
+        if ( p->pPars->fUseSim )
+            printf( "Simulation: Cexes = %d. Skipped SAT calls = %d. Skipped nodes = %d.\n",
+                p->nSimPairs, p->nSimSkips, p->nSimNodes );
+
         if (p->pPars->fPower)
             printf( "Power( %5.2f, %4.2f%%) \n",
                  p->TotalSwitchingBeg - p->TotalSwitchingEnd,
@@ -149,6 +156,7 @@ void Mfs_ManPrint( Mfs_Man_t * p )
     ABC_PRTP( "Div", p->timeDiv            ,  p->timeTotal );
     ABC_PRTP( "Aig", p->timeAig            ,  p->timeTotal );
     ABC_PRTP( "Gia", p->timeGia            ,  p->timeTotal );
+    ABC_PRTP( "Sim", p->timeSim            ,  p->timeTotal );
     ABC_PRTP( "Cnf", p->timeCnf            ,  p->timeTotal );
     ABC_PRTP( "Sat", p->timeSat-p->timeInt ,  p->timeTotal );
     ABC_PRTP( "Int", p->timeInt            ,  p->timeTotal );
@@ -190,6 +198,12 @@ void Mfs_ManStop( Mfs_Man_t * p )
     Vec_IntFree( p->vProjVarsSat );
     Vec_IntFree( p->vDivLits );
     Vec_PtrFree( p->vDivCexes );
+    if ( p->vSims )
+    {
+        Vec_WrdFree( p->vSims );
+        Vec_WrdFree( p->vSimOuts );
+        Vec_IntFree( p->vSimKeys );
+    }
     ABC_FREE( p );
 }
 
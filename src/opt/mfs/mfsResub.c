@@ -167,7 +167,7 @@ int Abc_NtkMfsSolveSatResub( Mfs_Man_t * p, Abc_Obj_t * pNode, int iFanin, int f
     int fVeryVerbose = 0;//p->pPars->fVeryVerbose && Vec_PtrSize(p->vDivs) < 200;// || pNode->Id == 556;
     unsigned * pData;
     int pCands[MFS_FANIN_MAX];
-    int RetValue, iVar, i, nCands, nWords, w;
+    int RetValue, iVar, i, nCands, nWords, w, fSimCex = 0;
     abctime clk;
     Abc_Obj_t * pFanin;
     Hop_Obj_t * pFunc;
@@ -177,6 +177,8 @@ int Abc_NtkMfsSolveSatResub( Mfs_Man_t * p, Abc_Obj_t * pNode, int iFanin, int f
     // clean simulation info
     Vec_PtrFillSimInfo( p->vDivCexes, 0, p->nDivWords ); 
     p->nCexes = 0;
+    if ( p->fSimValid )
+        fSimCex = Abc_NtkMfsSimSeedCexes( p, pNode, iFanin, -1 ) > 0;
     if ( p->pPars->fVeryVerbose )
     {
 //        printf( "\n" );
@@ -197,7 +199,10 @@ int Abc_NtkMfsSolveSatResub( Mfs_Man_t * p, Abc_Obj_t * pNode, int iFanin, int f
         iVar = Vec_PtrSize(p->vDivs) - Abc_ObjFaninNum(pNode) + i;
         pCands[nCands++] = toLitCond( Vec_IntEntry( p->vProjVarsSat, iVar ), 1 );
     }
-    RetValue = Abc_NtkMfsTryResubOnce( p, pCands, nCands );
+    // skip the SAT call if the simulation has already found a counter-example
+    if ( fSimCex )
+        p->nSimSkips++;
+    RetValue = fSimCex ? 0 : Abc_NtkMfsTryResubOnce( p, pCands, nCands );
     if ( RetValue == -1 )
         return 0;
     if ( RetValue == 1 )
@@ -321,7 +326,7 @@ int Abc_NtkMfsSolveSatResub2( Mfs_Man_t * p, Abc_Obj_t * pNode, int iFanin, int
     int fVeryVerbose = p->pPars->fVeryVerbose && Vec_PtrSize(p->vDivs) < 80;
     unsigned * pData, * pData2;
     int pCands[MFS_FANIN_MAX];
-    int RetValue, iVar, iVar2, i, w, nCands, nWords, fBreak;
+    int RetValue, iVar, iVar2, i, w, nCands, nWords, fBreak, fSimCex = 0;
     abctime clk;
     Abc_Obj_t * pFanin;
     Hop_Obj_t * pFunc;
@@ -331,6 +336,8 @@ int Abc_NtkMfsSolveSatResub2( Mfs_Man_t * p, Abc_Obj_t * pNode, int iFanin, int
     // clean simulation info
     Vec_PtrFillSimInfo( p->vDivCexes, 0, p->nDivWords ); 
     p->nCexes = 0;
+    if ( p->fSimValid )
+        fSimCex = Abc_NtkMfsSimSeedCexes( p, pNode, iFanin, iFanin2 ) > 0;
     if ( fVeryVerbose )
     {
         printf( "\n" );
@@ -351,7 +358,10 @@ int Abc_NtkMfsSolveSatResub2( Mfs_Man_t * p, Abc_Obj_t * pNode, int iFanin, int
         iVar = Vec_PtrSize(p->vDivs) - Abc_ObjFaninNum(pNode) + i;
         pCands[nCands++] = toLitCond( Vec_IntEntry( p->vProjVarsSat, iVar ), 1 );
     }
-    RetValue = Abc_NtkMfsTryResubOnce( p, pCands, nCands );
+    // skip the SAT call if the simulation has already found a counter-example
+    if ( fSimCex )
+        p->nSimSkips++;
+    RetValue = fSimCex ? 0 : Abc_NtkMfsTryResubOnce( p, pCands, nCands );
     if ( RetValue == -1 )
         return 0;
     if ( RetValue == 1 )
@@ -0,0 +1,237 @@
+/**CFile****************************************************************
+
+  FileName    [mfsSim.c]
+
+  SystemName  [ABC: Logic synthesis and verification system.]
+
+  PackageName [The good old minimization with complete don't-cares.]
+
+  Synopsis    [Simulation-based filtering of resubstitution candidates.]
+
+  Author      [Alan Mishchenko]
+
+  Affiliation [UC Berkeley]
+
+  Date        [Ver. 1.0. Started - June 20, 2005.]
+
+  Revision    [$Id: mfsSim.c,v 1.00 2005/06/20 00:00:00 alanmi Exp $]
+
+***********************************************************************/
+
+#include "mfsInt.h"
+#include "misc/util/utilTruth.h"
+
+ABC_NAMESPACE_IMPL_START
+
+
+////////////////////////////////////////////////////////////////////////
+///                        DECLARATIONS                              ///
+////////////////////////////////////////////////////////////////////////
+
+// the outputs of the window AIG are stored in this order: care set, node, divisors
+static inline word * Mfs_SimObj( Mfs_Man_t * p, int Id )    { return Vec_WrdEntryP( p->vSims, Id * MFS_SIM_WORDS );          }
+static inline word * Mfs_SimCare( Mfs_Man_t * p )           { return Vec_WrdEntryP( p->vSimOuts, 0 );                        }
+static inline word * Mfs_SimFunc( Mfs_Man_t * p )           { return Vec_WrdEntryP( p->vSimOuts, MFS_SIM_WORDS );            }
+static inline word * Mfs_SimDiv( Mfs_Man_t * p, int i )     { return Vec_WrdEntryP( p->vSimOuts, (i + 2) * MFS_SIM_WORDS );  }
+
+////////////////////////////////////////////////////////////////////////
+///                     FUNCTION DEFINITIONS                         ///
+////////////////////////////////////////////////////////////////////////
+
+/**Function*************************************************************
+
+  Synopsis    [Simulates the window AIG with random patterns.]
+
+  Description [Collects the care set (the conjunction of the outputs
+  asserted in the SAT problem), the function of the node, and the
+  functions of the divisors in p->vSimOuts.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Abc_NtkMfsSimulateWindow( Mfs_Man_t * p )
+{
+    Aig_Man_t * pAig = p->pAigWin;
+    Aig_Obj_t * pObj;
+    word * pSim, * pSim0, * pSim1, * pCare;
+    int nDivs = Vec_PtrSize(p->vDivs);
+    int nCares = Aig_ManCoNum(pAig) - nDivs - 1;
+    int i, w;
+    assert( p->pPars->fResub );
+    assert( nCares >= 1 );
+    if ( p->vSims == NULL )
+    {
+        p->vSims    = Vec_WrdAlloc( 0 );
+        p->vSimOuts = Vec_WrdAlloc( 0 );
+        p->vSimKeys = Vec_IntAlloc( 0 );
+    }
+    Vec_WrdFill( p->vSims, MFS_SIM_WORDS * Aig_ManObjNumMax(pAig), 0 );
+    Vec_WrdFill( p->vSimOuts, MFS_SIM_WORDS * (nDivs + 2), 0 );
+    // assign the constant and random inputs
+    pSim = Mfs_SimObj( p, Aig_ManConst1(pAig)->Id );
+    for ( w = 0; w < MFS_SIM_WORDS; w++ )
+        pSim[w] = ~(word)0;
+    Aig_ManForEachCi( pAig, pObj, i )
+    {
+        pSim = Mfs_SimObj( p, pObj->Id );
+        for ( w = 0; w < MFS_SIM_WORDS; w++ )
+            pSim[w] = Aig_ManRandom64( 0 );
+    }
+    // simulate the internal nodes
+    Aig_ManForEachNode( pAig, pObj, i )
+    {
+        pSim  = Mfs_SimObj( p, pObj->Id );
+        pSim0 = Mfs_SimObj( p, Aig_ObjFaninId0(pObj) );
+        pSim1 = Mfs_SimObj( p, Aig_ObjFaninId1(pObj) );
+        for ( w = 0; w < MFS_SIM_WORDS; w++ )
+            pSim[w] = (Aig_ObjFaninC0(pObj) ? ~pSim0[w] : pSim0[w]) & (Aig_ObjFaninC1(pObj) ? ~pSim1[w] : pSim1[w]);
+    }
+    // collect the outputs
+    pCare = Mfs_SimCare( p );
+    for ( w = 0; w < MFS_SIM_WORDS; w++ )
+        pCare[w] = ~(word)0;
+    Aig_ManForEachCo( pAig, pObj, i )
+    {
+        pSim0 = Mfs_SimObj( p, Aig_ObjFaninId0(pObj) );
+        if ( i < nCares )
+        {
+            for ( w = 0; w < MFS_SIM_WORDS; w++ )
+                pCare[w] &= Aig_ObjFaninC0(pObj) ? ~pSim0[w] : pSim0[w];
+            continue;
+        }
+        pSim = i == nCares ? Mfs_SimFunc(p) : Mfs_SimDiv(p, i - nCares - 1);
+        for ( w = 0; w < MFS_SIM_WORDS; w++ )
+            pSim[w] = Aig_ObjFaninC0(pObj) ? ~pSim0[w] : pSim0[w];
+    }
+    p->fSimValid = 1;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Seeds the counter-examples using simulation patterns.]
+
+  Description [Looks for pairs of care patterns, in which the node has
+  different values while the fanins, other than iFanin and iFanin2, have
+  the same values. Each pair is a counter-example to removing these
+  fanins and is recorded in p->vDivCexes in the same way as the pairs
+  produced by the SAT solver. Returns the number of pairs found. If it
+  is non-zero, the fanins cannot be removed without adding divisors.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Abc_NtkMfsSimSeedCexes( Mfs_Man_t * p, Abc_Obj_t * pNode, int iFanin, int iFanin2 )
+{
+    word * pCare = Mfs_SimCare( p );
+    word * pFunc = Mfs_SimFunc( p );
+    int nFanins  = Abc_ObjFaninNum( pNode );
+    int nDivs    = Vec_PtrSize( p->vDivs );
+    int nPairsMax = Abc_MinInt( MFS_SIM_PAIRS, p->pPars->nWinMax / 2 );
+    int i, k, d, Key, Value, iPat, nPairs = 0;
+    assert( p->fSimValid );
+    assert( p->nCexes == 0 );
+    assert( nFanins <= MFS_FANIN_MAX );
+    // for each key, the first onset and offset pattern (-2 if the key is used)
+    Vec_IntFill( p->vSimKeys, 2 << nFanins, -1 );
+    for ( k = 0; k < 64 * MFS_SIM_WORDS && nPairs < nPairsMax; k++ )
+    {
+        if ( !Abc_TtGetBit(pCare, k) )
+            continue;
+        // the fanins are the last divisors
+        Key = 0;
+        for ( i = 0; i < nFanins; i++ )
+            if ( i != iFanin && i != iFanin2 && Abc_TtGetBit(Mfs_SimDiv(p, nDivs - nFanins + i), k) )
+                Key |= (1 << i);
+        Value = Abc_TtGetBit( pFunc, k );
+        if ( Vec_IntEntry(p->vSimKeys, 2*Key + Value) == -1 )
+            Vec_IntWriteEntry( p->vSimKeys, 2*Key + Value, k );
+        iPat = Vec_IntEntry( p->vSimKeys, 2*Key + !Value );
+        if ( iPat < 0 )
+            continue;
+        // the divisors that agree in the pair cannot distinguish it
+        for ( d = 0; d < nDivs; d++ )
+            if ( Abc_TtGetBit(Mfs_SimDiv(p, d), k) == Abc_TtGetBit(Mfs_SimDiv(p, d), iPat) )
+                Abc_InfoXorBit( (unsigned *)Vec_PtrEntry(p->vDivCexes, d), p->nCexes );
+        p->nCexes++;
+        nPairs++;
+        // use one pair per key to diversify the counter-examples
+        Vec_IntWriteEntry( p->vSimKeys, 2*Key,   -2 );
+        Vec_IntWriteEntry( p->vSimKeys, 2*Key+1, -2 );
+    }
+    p->nSimPairs += nPairs;
+    return nPairs;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Returns 1 if one of the divisors survives the counter-examples.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static int Abc_NtkMfsSimHasDivisor( Mfs_Man_t * p, Abc_Obj_t * pNode )
+{
+    unsigned * pData;
+    int nWords = Abc_BitWordNum( p->nCexes );
+    int iVar, w;
+    for ( iVar = 0; iVar < Vec_PtrSize(p->vDivs) - Abc_ObjFaninNum(pNode); iVar++ )
+    {
+        pData = (unsigned *)Vec_PtrEntry( p->vDivCexes, iVar );
+        for ( w = 0; w < nWords; w++ )
+            if ( pData[w] != ~0 )
+                break;
+        if ( w == nWords )
+            return 1;
+    }
+    return 0;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Returns 1 if resubstitution of the node cannot succeed.]
+
+  Description [Mirrors the candidates tried by Abc_NtkMfsResubNode():
+  area-critical fanins are tried with and without a divisor, while the
+  other fanins are tried for removal. The node is hopeless if every
+  candidate is refuted by the simulation patterns alone, in which case
+  neither CNF nor the SAT solver are needed.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Abc_NtkMfsSimNodeIsHopeless( Mfs_Man_t * p, Abc_Obj_t * pNode )
+{
+    Abc_Obj_t * pFanin;
+    int i, fCritical;
+    Abc_ObjForEachFanin( pNode, pFanin, i )
+    {
+        fCritical = !Abc_ObjIsCi(pFanin) && Abc_ObjFanoutNum(pFanin) == 1;
+        if ( !fCritical && p->pPars->fArea )
+            continue;
+        Vec_PtrFillSimInfo( p->vDivCexes, 0, p->nDivWords );
+        p->nCexes = 0;
+        if ( Abc_NtkMfsSimSeedCexes( p, pNode, i, -1 ) == 0 )
+            return 0;
+        if ( fCritical && !p->pPars->fRrOnly && Abc_NtkMfsSimHasDivisor( p, pNode ) )
+            return 0;
+    }
+    return 1;
+}
+
+////////////////////////////////////////////////////////////////////////
+///                       END OF FILE                                ///
+////////////////////////////////////////////////////////////////////////
+
+
+ABC_NAMESPACE_IMPL_END
+
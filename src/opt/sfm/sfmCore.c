@@ -19,6 +19,7 @@
 ***********************************************************************/
 
 #include "sfmInt.h"
+#include "misc/util/utilTask.h"
 
 ABC_NAMESPACE_IMPL_START
 
@@ -27,6 +28,24 @@ ABC_NAMESPACE_IMPL_START
 ///                        DECLARATIONS                              ///
 ////////////////////////////////////////////////////////////////////////
 
+// the number of nodes whose windows are processed concurrently
+// (it does not depend on the number of threads, so the result is the same)
+#define SFM_BATCH_SIZE 256
+
+typedef struct Sfm_Job_t_ Sfm_Job_t;
+struct Sfm_Job_t_
+{
+    Sfm_Ntk_t **      pWorkers;    // the workers (one per thread)
+    Util_Pool_t *     pPool;       // the thread pool
+    int               iNode;       // the node
+    int               LevelR;      // the reverse level of the node
+    int               fFound;      // the resubstitution is found
+    int               iFanin;      // the fanin to be replaced
+    int               iDiv;        // the divisor (-1 if the fanin is removed)
+    word              uTruth;      // the new function of the node
+    Vec_Int_t *       vWindow;     // the objects of the window
+};
+
 ////////////////////////////////////////////////////////////////////////
 ///                     FUNCTION DEFINITIONS                         ///
 ////////////////////////////////////////////////////////////////////////
@@ -51,6 +70,7 @@ void Sfm_ParSetDefault( Sfm_Par_t * pPars )
     pPars->nWinSizeMax  =  300;  // the maximum window size
     pPars->nGrowthLevel =    0;  // the maximum allowed growth in level
     pPars->nBTLimit     = 5000;  // the maximum number of conflicts in one SAT run
+    pPars->nProcs       =    1;  // the number of threads
     pPars->fRrOnly      =    0;  // perform redundancy removal
     pPars->fArea        =    0;  // performs optimization for area
     pPars->fMoreEffort  =    0;  // performs high-affort minimization
@@ -196,6 +216,14 @@ finish:
             iNode, f, Sfm_ObjFanin(p, iNode, f), iVar, Vec_IntEntry(p->vDivs, iVar) );
         Kit_DsdPrintFromTruth( (unsigned *)&uTruth, Vec_IntSize(p->vDivIds) ); printf( "\n" );
     }
+    if ( p->fDelayUpdate )
+    {
+        // record the resubstitution to be committed later
+        p->iUpdFanin = f;
+        p->iUpdDiv   = iVar == -1 ? -1 : Vec_IntEntry(p->vDivs, iVar);
+        p->uUpdTruth = uTruth;
+        return 1;
+    }
     if ( iVar == -1 )
         p->nRemoves++;
     else
@@ -244,6 +272,172 @@ int Sfm_NodeResub( Sfm_Ntk_t * p, int iNode )
     return 0;
 }
 
+/**Function*************************************************************
+
+  Synopsis    [Returns 1 if the node should be tried.]
+
+  Description []
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static inline int Sfm_NodeIsCandidate( Sfm_Ntk_t * p, int i )
+{
+    if ( Sfm_ObjIsFixed( p, i ) )
+        return 0;
+    if ( p->pPars->nDepthMax && Sfm_ObjLevel(p, i) > p->pPars->nDepthMax )
+        return 0;
+    if ( Sfm_ObjFaninNum(p, i) < 2 || Sfm_ObjFaninNum(p, i) > 6 )
+        return 0;
+    return 1;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Computes the resubstitution of one node by a worker.]
+
+  Description [The network is not updated. The window is saved to check
+  later whether it was changed by the resubstitutions committed before.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static void * Sfm_NodeResubJob( void * pArg )
+{
+    Sfm_Job_t * pJob = (Sfm_Job_t *)pArg;
+    Sfm_Ntk_t * pW = pJob->pWorkers[Abc_MaxInt(0, Util_TaskWorkerId(pJob->pPool))];
+    Vec_IntClear( pW->vOrder );
+    pJob->fFound = Sfm_NodeResub( pW, pJob->iNode );
+    pJob->iFanin = pW->iUpdFanin;
+    pJob->iDiv   = pW->iUpdDiv;
+    pJob->uTruth = pW->uUpdTruth;
+    Vec_IntClear( pJob->vWindow );
+    Vec_IntAppend( pJob->vWindow, pW->vOrder );
+    return NULL;
+}
+static int Sfm_NodeJobIsValid( Sfm_Ntk_t * p, Sfm_Job_t * pJob )
+{
+    int i, iObj;
+    if ( Sfm_ObjLevelR(p, pJob->iNode) != pJob->LevelR )
+        return 0;
+    Vec_IntForEachEntry( pJob->vWindow, iObj, i )
+        if ( Vec_IntEntry(p->vUpdated, iObj) == p->nUpdSteps )
+            return 0;
+    return 1;
+}
+static void Sfm_NtkAddWorkerStats( Sfm_Ntk_t * p, Sfm_Ntk_t * pW )
+{
+    p->nTryRemoves += pW->nTryRemoves;
+    p->nTryResubs  += pW->nTryResubs;
+    p->nNodesTried += pW->nNodesTried;
+    p->nTotalDivs  += pW->nTotalDivs;
+    p->nSatCalls   += pW->nSatCalls;
+    p->nTimeOuts   += pW->nTimeOuts;
+    p->nMaxDivs    += pW->nMaxDivs;
+    p->timeWin     += pW->timeWin;
+    p->timeDiv     += pW->timeDiv;
+    p->timeCnf     += pW->timeCnf;
+    p->timeSat     += pW->timeSat;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Performs resubstitution using several threads.]
+
+  Description [The nodes are processed in batches. The windows of the nodes
+  in the batch are computed and solved concurrently by the workers, each
+  with its own SAT solver, while the network is not changed. After that,
+  the resubstitutions are committed in the order of the nodes. If the window
+  of the node contains an object changed by an earlier commit in the same
+  batch, or the reverse level of the node has changed, the node is tried
+  again by the manager. The result does not depend on the number of threads.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static int Sfm_NtkPerformPar( Sfm_Ntk_t * p )
+{
+    Sfm_Ntk_t ** pWorkers;
+    Sfm_Job_t * pJobs, * pJob;
+    Util_Pool_t * pPool;
+    int i, k, b, nJobs, Counter = 0, fStop = 0;
+    pPool    = Util_PoolStart( p->pPars->nProcs );
+    pWorkers = ABC_ALLOC( Sfm_Ntk_t *, p->pPars->nProcs );
+    for ( i = 0; i < p->pPars->nProcs; i++ )
+        pWorkers[i] = Sfm_NtkStartWorker( p );
+    pJobs = ABC_CALLOC( Sfm_Job_t, SFM_BATCH_SIZE );
+    for ( b = 0; b < SFM_BATCH_SIZE; b++ )
+        pJobs[b].vWindow = Vec_IntAlloc( 100 );
+    p->vUpdated = Vec_IntStartFull( p->nObjs );
+    i = p->nPis;
+    while ( !fStop && i + p->nPos < p->nObjs )
+    {
+        // collect the nodes of the batch
+        for ( nJobs = 0; nJobs < SFM_BATCH_SIZE && i + p->nPos < p->nObjs; i++ )
+        {
+            if ( !Sfm_NodeIsCandidate(p, i) )
+                continue;
+            pJob = pJobs + nJobs++;
+            pJob->pWorkers = pWorkers;
+            pJob->pPool    = pPool;
+            pJob->iNode    = i;
+            pJob->LevelR   = Sfm_ObjLevelR(p, i);
+        }
+        // solve them in parallel
+        for ( b = 0; b < nJobs; b++ )
+            Util_PoolSpawn( pPool, Sfm_NodeResubJob, (void *)(pJobs + b) );
+        Util_PoolWaitIdle( pPool );
+        // commit the results in order
+        p->nUpdSteps++;
+        for ( b = 0; b < nJobs; b++ )
+        {
+            pJob = pJobs + b;
+            if ( !Sfm_NodeIsCandidate(p, pJob->iNode) )
+                continue;
+            k = 0;
+            if ( Sfm_NodeJobIsValid(p, pJob) )
+            {
+                // the window did not change, so the result still holds
+                if ( !pJob->fFound )
+                    continue;
+                if ( pJob->iDiv == -1 )
+                    p->nRemoves++;
+                else
+                    p->nResubs++;
+                Sfm_NtkUpdate( p, pJob->iNode, pJob->iFanin, pJob->iDiv, pJob->uTruth );
+                k++;
+            }
+            // continue with the current network
+            for ( ; Sfm_NodeResub(p, pJob->iNode); k++ )
+                ;
+            Counter += (k > 0);
+            if ( p->pPars->nNodesMax && Counter >= p->pPars->nNodesMax )
+            {
+                fStop = 1;
+                break;
+            }
+        }
+    }
+    for ( b = 0; b < SFM_BATCH_SIZE; b++ )
+        Vec_IntFree( pJobs[b].vWindow );
+    ABC_FREE( pJobs );
+    for ( b = 0; b < p->pPars->nProcs; b++ )
+    {
+        Sfm_NtkAddWorkerStats( p, pWorkers[b] );
+        Sfm_NtkStopWorker( pWorkers[b] );
+    }
+    ABC_FREE( pWorkers );
+    Vec_IntFreeP( &p->vUpdated );
+    Util_PoolStop( pPool );
+    return Counter;
+}
+
 /**Function*************************************************************
 
   Synopsis    []
@@ -272,6 +466,9 @@ int Sfm_NtkPerform( Sfm_Ntk_t * p, Sfm_Par_t * pPars )
 //    return 0;
     p->nTotalNodesBeg = Vec_WecSizeUsedLimits( &p->vFanins, Sfm_NtkPiNum(p), Vec_WecSize(&p->vFanins) - Sfm_NtkPoNum(p) );
     p->nTotalEdgesBeg = Vec_WecSizeSize(&p->vFanins) - Sfm_NtkPoNum(p);
+    if ( pPars->nProcs > 1 && !pPars->fVeryVerbose )
+        Counter = Sfm_NtkPerformPar( p );
+    else
     Sfm_NtkForEachNode( p, i )
     {
         if ( Sfm_ObjIsFixed( p, i ) )
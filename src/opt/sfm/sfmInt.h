@@ -108,6 +108,13 @@ struct Sfm_Ntk_t_
     int               nTryResubs;  // number of resubstitutions
     int               nRemoves;    // number of fanin removals
     int               nResubs;     // number of resubstitutions
+    // parallel resubstitution
+    int               fDelayUpdate;// record the resubstitution without updating the network
+    int               iUpdFanin;   // the recorded fanin to be replaced
+    int               iUpdDiv;     // the recorded divisor (-1 if the fanin is removed)
+    word              uUpdTruth;   // the recorded function of the node
+    int               nUpdSteps;   // the current commit step
+    Vec_Int_t *       vUpdated;    // the last commit step when the object was changed
     // counter-examples
     int               nCexes;      // number of CEXes
     Vec_Wrd_t *       vDivCexes;   // counter-examples
@@ -176,6 +183,8 @@ static inline void Sfm_ObjSetLevelR( Sfm_Ntk_t * p, int iObj, int Lev ) { Vec_In
 static inline int  Sfm_ObjUpdateFaninCount( Sfm_Ntk_t * p, int iObj )   { return Vec_IntAddToEntry(&p->vCounts, iObj, -1);                  }
 static inline void Sfm_ObjResetFaninCount( Sfm_Ntk_t * p, int iObj )    { Vec_IntWriteEntry(&p->vCounts, iObj, Sfm_ObjFaninNum(p, iObj)-1); }
 
+static inline void Sfm_NtkMarkUpdated( Sfm_Ntk_t * p, int iObj )        { if ( p->vUpdated && iObj >= 0 ) Vec_IntWriteEntry(p->vUpdated, iObj, p->nUpdSteps); }
+
 extern void        Kit_DsdPrintFromTruth( unsigned * pTruth, int nVars );
 
 ////////////////////////////////////////////////////////////////////////
@@ -212,6 +221,8 @@ extern int          Sfm_LibImplementGatesDelay( Sfm_Lib_t * p, int * pFanins, Mi
 /*=== sfmNtk.c ==========================================================*/
 extern Sfm_Ntk_t *  Sfm_ConstructNetwork( Vec_Wec_t * vFanins, int nPis, int nPos );
 extern void         Sfm_NtkPrepare( Sfm_Ntk_t * p );
+extern Sfm_Ntk_t *  Sfm_NtkStartWorker( Sfm_Ntk_t * p );
+extern void         Sfm_NtkStopWorker( Sfm_Ntk_t * p );
 extern void         Sfm_NtkUpdate( Sfm_Ntk_t * p, int iNode, int f, int iFaninNew, word uTruth );
 /*=== sfmSat.c ==========================================================*/
 extern int          Sfm_NtkWindowToSolver( Sfm_Ntk_t * p );
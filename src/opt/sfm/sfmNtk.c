@@ -241,6 +241,73 @@ void Sfm_NtkFree( Sfm_Ntk_t * p )
     Vec_IntFreeP( &p->vValues );
     Vec_WecFreeP( &p->vClauses );
     Vec_IntFreeP( &p->vFaninMap );
+    Vec_IntFreeP( &p->vUpdated );
+    if ( p->pSat  ) sat_solver_delete( p->pSat );
+    ABC_FREE( p );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Starts the worker used to compute resubstitutions in parallel.]
+
+  Description [The worker shares the network with the manager and has its
+  own parameters, traversal IDs, SAT variable maps, window, and solver.
+  It can only read the network, which is updated by the manager.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Sfm_Ntk_t * Sfm_NtkStartWorker( Sfm_Ntk_t * p )
+{
+    Sfm_Ntk_t * pNew = ABC_CALLOC( Sfm_Ntk_t, 1 );
+    pNew->pPars     = ABC_ALLOC( Sfm_Par_t, 1 );
+    *pNew->pPars    = *p->pPars;
+    pNew->nObjs     = p->nObjs;
+    pNew->nPis      = p->nPis;
+    pNew->nPos      = p->nPos;
+    pNew->nNodes    = p->nNodes;
+    // shared data
+    pNew->vFixed    = p->vFixed;
+    pNew->vEmpty    = p->vEmpty;
+    pNew->vTruths   = p->vTruths;
+    pNew->vFanins   = p->vFanins;
+    pNew->vFanouts  = p->vFanouts;
+    pNew->vLevels   = p->vLevels;
+    pNew->vLevelsR  = p->vLevelsR;
+    pNew->vCnfs     = p->vCnfs;
+    // private data
+    Vec_IntFill( &pNew->vCounts,   p->nObjs,  0 );
+    Vec_IntFill( &pNew->vTravIds,  p->nObjs,  0 );
+    Vec_IntFill( &pNew->vTravIds2, p->nObjs,  0 );
+    Vec_IntFill( &pNew->vId2Var,   2*p->nObjs, -1 );
+    Vec_IntFill( &pNew->vVar2Id,   2*p->nObjs, -1 );
+    Sfm_NtkPrepare( pNew );
+    pNew->nLevelMax    = p->nLevelMax;
+    pNew->fDelayUpdate = 1;
+    return pNew;
+}
+void Sfm_NtkStopWorker( Sfm_Ntk_t * p )
+{
+    ABC_FREE( p->pPars );
+    ABC_FREE( p->vCounts.pArray );
+    ABC_FREE( p->vTravIds.pArray );
+    ABC_FREE( p->vTravIds2.pArray );
+    ABC_FREE( p->vId2Var.pArray );
+    ABC_FREE( p->vVar2Id.pArray );
+    Vec_IntFreeP( &p->vNodes );
+    Vec_IntFreeP( &p->vDivs  );
+    Vec_IntFreeP( &p->vRoots );
+    Vec_IntFreeP( &p->vTfo   );
+    Vec_WrdFreeP( &p->vDivCexes );
+    Vec_IntFreeP( &p->vOrder );
+    Vec_IntFreeP( &p->vDivVars );
+    Vec_IntFreeP( &p->vDivIds );
+    Vec_IntFreeP( &p->vLits  );
+    Vec_IntFreeP( &p->vValues );
+    Vec_WecFreeP( &p->vClauses );
+    Vec_IntFreeP( &p->vFaninMap );
     if ( p->pSat  ) sat_solver_delete( p->pSat );
     ABC_FREE( p );
 }
@@ -290,6 +357,7 @@ void Sfm_NtkDeleteObj_rec( Sfm_Ntk_t * p, int iNode )
     }
     Vec_IntClear( Sfm_ObjFiArray(p, iNode) );
     Vec_WrdWriteEntry( p->vTruths, iNode, (word)0 );
+    Sfm_NtkMarkUpdated( p, iNode );
 }
 void Sfm_NtkUpdateLevel_rec( Sfm_Ntk_t * p, int iNode )
 {
@@ -321,6 +389,7 @@ void Sfm_NtkUpdate( Sfm_Ntk_t * p, int iNode, int f, int iFaninNew, word uTruth
         Sfm_ObjForEachFanin( p, iNode, iFanin, f )
         {
             int RetValue = Vec_IntRemove( Sfm_ObjFoArray(p, iFanin), iNode );  assert( RetValue );
+            Sfm_NtkMarkUpdated( p, iFanin );
             Sfm_NtkDeleteObj_rec( p, iFanin );
         }
         Vec_IntClear( Sfm_ObjFiArray(p, iNode) );
@@ -330,6 +399,8 @@ void Sfm_NtkUpdate( Sfm_Ntk_t * p, int iNode, int f, int iFaninNew, word uTruth
         // replace old fanin by new fanin
         Sfm_NtkRemoveFanin( p, iNode, iFanin );
         Sfm_NtkAddFanin( p, iNode, iFaninNew );
+        Sfm_NtkMarkUpdated( p, iFanin );
+        Sfm_NtkMarkUpdated( p, iFaninNew );
         // recursively remove MFFC
         Sfm_NtkDeleteObj_rec( p, iFanin );
     }
@@ -341,6 +412,7 @@ void Sfm_NtkUpdate( Sfm_Ntk_t * p, int iNode, int f, int iFaninNew, word uTruth
         Sfm_NtkUpdateLevelR_rec( p, iFanin );
     // update truth table
     Vec_WrdWriteEntry( p->vTruths, iNode, uTruth );
+    Sfm_NtkMarkUpdated( p, iNode );
     Sfm_TruthToCnf( uTruth, Sfm_ObjFaninNum(p, iNode), p->vCover, (Vec_Str_t *)Vec_WecEntry(p->vCnfs, iNode) );
 }
 
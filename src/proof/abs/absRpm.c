@@ -322,7 +322,7 @@ void Gia_ManCountFanoutlessFlops( Gia_Man_t * p )
         if ( Gia_ObjRefNum(p, pObj) == 0 )
             Counter++;
     printf( "Fanoutless flops = %d.\n", Counter );
-    ABC_FREE( p->pRefs );
+    Gia_ManAuxIntFreeP( p, &p->pRefs );
 }
 
 /**Function*************************************************************
@@ -788,7 +788,7 @@ void Abs_RpmPerformMark( Gia_Man_t * p, int nCutMax, int fVerbose, int fVeryVerb
     Vec_IntFree( vSupp1 );
     Vec_IntFree( vSupp2 );
 //    Gia_ManCleanMark1( p ); // this will erase markings
-    ABC_FREE( p->pRefs );
+    Gia_ManAuxIntFreeP( p, &p->pRefs );
 }
 
 /**Function*************************************************************
@@ -75,7 +75,7 @@ Vec_Int_t * Gia_ManDetectHalfAdders( Gia_Man_t * p, int fVerbose )
     }
     else
     {
-        ABC_FREE( p->pRefs );
+        Gia_ManAuxIntFreeP( p, &p->pRefs );
         Gia_ManCreateRefs( p );
         Gia_ManForEachAnd( p, pObj, i )
         {
@@ -106,7 +106,7 @@ Vec_Int_t * Gia_ManDetectHalfAdders( Gia_Man_t * p, int fVerbose )
             }
             Counts[Count]++;
         }
-        ABC_FREE( p->pRefs );
+        Gia_ManAuxIntFreeP( p, &p->pRefs );
     }
     Gia_ManHashStop( p );
     if ( fVerbose )
@@ -992,7 +992,7 @@ Gia_Man_t * Gia_ManDupWithArtificalFaddBoxes( Gia_Man_t * p, int fUseFanout, int
     }
     Gia_ManCleanPhase( p );
     Vec_IntFreeP( &vCarries );
-    ABC_FREE( p->pRefs );
+    Gia_ManAuxIntFreeP( p, &p->pRefs );
     assert( !Gia_ManHasDangling(pNew) );
     // other information
 //    nBoxes += (Gia_ManCiNum(pNew) - Gia_ManCiNum(p)) / 2;
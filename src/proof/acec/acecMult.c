@@ -382,7 +382,7 @@ Vec_Int_t * Acec_MultDetectInputs( Gia_Man_t * p, Vec_Wec_t * vLeafLits, Vec_Wec
     Vec_Int_t * vLevel;
     int i, k, iLit, iObj, j, Entry;
 
-    ABC_FREE( p->pRefs );
+    Gia_ManAuxIntFreeP( p, &p->pRefs );
     Gia_ManCreateRefs( p );
     Gia_ManForEachCiId( p, iObj, i )
         printf( "%d=%d ", iObj, Gia_ObjRefNumId(p, iObj) );
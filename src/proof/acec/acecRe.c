@@ -516,7 +516,7 @@ void Ree_ManRemoveTrivial( Gia_Man_t * p, Vec_Int_t * vAdds )
 {
     Gia_Obj_t * pObjX, * pObjM;
     int i, k = 0;
-    ABC_FREE( p->pRefs );
+    Gia_ManAuxIntFreeP( p, &p->pRefs );
     Gia_ManCreateRefs( p );
     for ( i = 0; 6*i < Vec_IntSize(vAdds); i++ )
     {
@@ -58,12 +58,12 @@ Vec_Int_t * Gia_PolynCollectLastXor( Gia_Man_t * pGia, int fVerbose )
 {
     Vec_Int_t * vXors = Vec_IntAlloc( 100 );
     Gia_Obj_t * pObj = Gia_ManCo( pGia, Gia_ManCoNum(pGia)-1 );
-    ABC_FREE( pGia->pRefs );
+    Gia_ManAuxIntFreeP( pGia, &pGia->pRefs );
     Gia_ManCreateRefs( pGia );
     Gia_ManIncrementTravId( pGia );
     Gia_PolynCollectXors_rec( pGia, Gia_ObjFaninId0p(pGia, pObj), vXors );
     Vec_IntReverseOrder( vXors );
-    ABC_FREE( pGia->pRefs );
+    Gia_ManAuxIntFreeP( pGia, &pGia->pRefs );
     return vXors;
 }
 void Gia_PolynAnalyzeXors( Gia_Man_t * pGia, int fVerbose )
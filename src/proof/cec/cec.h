@@ -51,6 +51,7 @@ struct Cec_ParSat_t_
     int              fCheckMiter;   // the circuit is the miter
 //    int              fFirstStop;    // stop on the first sat output
     int              fLearnCls;     // perform clause learning
+    int              nThreads;      // the number of threads
     int              fVerbose;      // verbose stats
 };
 
@@ -110,6 +111,8 @@ struct Cec_ParFra_t_
     int              fRunCSat;      // enable another solver
     int              fUseCones;     // use cones
     int              fUseOrigIds;   // enable recording of original IDs
+    int              nThreads;      // the number of threads
+    int              SolverType;    // the SAT solver used by &fraig -g (see Sat_IfaceType_t)
     int              fVeryVerbose;  // verbose stats
     int              fVerbose;      // verbose stats
     int              iOutFail;      // the failed output
@@ -125,6 +128,7 @@ struct Cec_ParCec_t_
     int              fUseSmartCnf;  // use smart CNF computation
     int              fRewriting;    // enables AIG rewriting
     int              fNaive;        // performs naive SAT-based checking
+    int              nThreads;      // the number of threads
     int              fSilent;       // print no messages
     int              fVeryVerbose;  // verbose stats
     int              fVerbose;      // verbose stats
@@ -19,6 +19,7 @@
 ***********************************************************************/
 
 #include "cecInt.h"
+#include "sat/bsat/satIface.h"
 
 ABC_NAMESPACE_IMPL_START
 
@@ -53,6 +54,7 @@ void Cec_ManSatSetDefaultParams( Cec_ParSat_t * p )
     p->fCheckMiter    =       0;  // the circuit is the miter
 //    p->fFirstStop     =       0;  // stop on the first sat output
     p->fLearnCls      =       0;  // perform clause learning
+    p->nThreads       =       1;  // the number of threads
     p->fVerbose       =       0;  // verbose stats
 }  
 
@@ -139,6 +141,8 @@ void Cec_ManFraSetDefaultParams( Cec_ParFra_t * p )
     p->fColorDiff     =       0;  // miter with separate outputs
     p->fSatSweeping   =       0;  // enable SAT sweeping
     p->fUseCones      =       0;  // use cones
+    p->nThreads       =       1;  // the number of threads
+    p->SolverType     = SAT_IFACE_GLUCOSE; // the SAT solver
     p->fVeryVerbose   =       0;  // verbose stats
     p->fVerbose       =       0;  // verbose stats
     p->iOutFail       =      -1;  // the failed output
@@ -163,6 +167,7 @@ void Cec_ManCecSetDefaultParams( Cec_ParCec_t * p )
 //    p->fFirstStop     =       0;  // stop on the first sat output
     p->fUseSmartCnf   =       0;  // use smart CNF computation
     p->fRewriting     =       0;  // enables AIG rewriting
+    p->nThreads       =       1;  // the number of threads
     p->fVeryVerbose   =       0;  // verbose stats
     p->fVerbose       =       0;  // verbose stats
     p->iOutFail       =      -1;  // the number of failed output
@@ -375,6 +380,7 @@ Gia_Man_t * Cec_ManSatSweeping( Gia_Man_t * pAig, Cec_ParFra_t * pPars, int fSil
     // SAT solving
     Cec_ManSatSetDefaultParams( pParsSat );
     pParsSat->nBTLimit = pPars->nBTLimit;
+    pParsSat->nThreads = pPars->nThreads;
     pParsSat->fVerbose = pPars->fVeryVerbose;
     // simulation patterns
     pPat = Cec_ManPatStart();
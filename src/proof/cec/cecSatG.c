@@ -20,7 +20,9 @@
 
 #include "aig/gia/gia.h"
 #include "misc/util/utilTruth.h"
-#include "sat/glucose/AbcGlucose.h"
+#include "misc/util/utilSimd.h"
+#include "sat/bsat/satIface.h"
+#include "sat/cnf/cnf.h"
 #include "cec.h"
 
 ABC_NAMESPACE_IMPL_START
@@ -39,6 +41,8 @@ struct Cec3_Par_t_
     int              nConfLimit;    // SAT solver conflict limit
     int              fIsMiter;      // this is a miter
     int              fUseCones;     // use logic cones
+    int              nThreads;      // the number of simulation threads
+    int              SolverType;    // the SAT solver (see Sat_IfaceType_t)
     int              fVeryVerbose;  // verbose stats
     int              fVerbose;      // verbose stats
 };
@@ -51,7 +55,7 @@ struct Cec3_Man_t_
     Gia_Man_t *      pAig;           // user's AIG
     Gia_Man_t *      pNew;           // internal AIG
     // SAT solving
-    bmcg_sat_solver* pSat;           // SAT solver
+    Sat_Iface_t *    pSat;           // SAT solver
     Vec_Ptr_t *      vFrontier;      // CNF construction
     Vec_Ptr_t *      vFanins;        // CNF construction
     Vec_Wrd_t *      vSims;          // CI simulation info
@@ -59,6 +63,7 @@ struct Cec3_Man_t_
     Vec_Int_t *      vSatVars;       // nodes
     Vec_Int_t *      vObjSatPairs;   // nodes
     Vec_Int_t *      vCexTriples;    // nodes
+    Gia_SimPar_t *   pSimPar;        // multi-threaded simulation
     // statistics
     int              nPatterns;
     int              nSatSat;
@@ -77,9 +82,6 @@ static inline int    Cec3_ObjSatId( Gia_Man_t * p, Gia_Obj_t * pObj )
 static inline int    Cec3_ObjSetSatId( Gia_Man_t * p, Gia_Obj_t * pObj, int Num ) { assert(Cec3_ObjSatId(p, pObj) == -1); Gia_ObjSetCopy2Array(p, Gia_ObjId(p, pObj), Num); return Num;  }
 static inline void   Cec3_ObjCleanSatId( Gia_Man_t * p, Gia_Obj_t * pObj )        { assert(Cec3_ObjSatId(p, pObj) != -1); Gia_ObjSetCopy2Array(p, Gia_ObjId(p, pObj), -1);               }
 
-static inline void   satoko_mark_cone( bmcg_sat_solver * p, int * pVars, int nVars )   {}
-static inline void   satoko_unmark_cone( bmcg_sat_solver * p, int * pVars, int nVars ) {}
-
 ////////////////////////////////////////////////////////////////////////
 ///                     FUNCTION DEFINITIONS                         ///
 ////////////////////////////////////////////////////////////////////////
@@ -104,6 +106,8 @@ void Cec3_SetDefaultParams( Cec3_Par_t * p )
     p->nConfLimit     =    1000;    // conflict limit at a node
     p->fIsMiter       =       0;    // this is a miter
     p->fUseCones      =       0;    // use logic cones
+    p->nThreads       =       1;    // the number of simulation threads
+    p->SolverType     = SAT_IFACE_GLUCOSE; // the SAT solver
     p->fVeryVerbose   =       0;    // verbose stats
     p->fVerbose       =       0;    // verbose stats
 }  
@@ -119,7 +123,7 @@ void Cec3_SetDefaultParams( Cec3_Par_t * p )
   SeeAlso     []
 
 ***********************************************************************/
-void Cec3_AddClausesMux( Gia_Man_t * p, Gia_Obj_t * pNode, bmcg_sat_solver * pSat )
+void Cec3_AddClausesMux( Gia_Man_t * p, Gia_Obj_t * pNode, Sat_Iface_t * pSat )
 {
     int fPolarFlip = 0;
     Gia_Obj_t * pNodeI, * pNodeT, * pNodeE;
@@ -155,7 +159,7 @@ void Cec3_AddClausesMux( Gia_Man_t * p, Gia_Obj_t * pNode, bmcg_sat_solver * pSa
         if ( Gia_Regular(pNodeT)->fPhase )  pLits[1] = Abc_LitNot( pLits[1] );
         if ( pNode->fPhase )                pLits[2] = Abc_LitNot( pLits[2] );
     }
-    RetValue = bmcg_sat_solver_addclause( pSat, pLits, 3 );
+    RetValue = Sat_IfaceAddClause( pSat, pLits, 3 );
     assert( RetValue );
     pLits[0] = Abc_Var2Lit(VarI, 1);
     pLits[1] = Abc_Var2Lit(VarT, 0^fCompT);
@@ -166,7 +170,7 @@ void Cec3_AddClausesMux( Gia_Man_t * p, Gia_Obj_t * pNode, bmcg_sat_solver * pSa
         if ( Gia_Regular(pNodeT)->fPhase )  pLits[1] = Abc_LitNot( pLits[1] );
         if ( pNode->fPhase )                pLits[2] = Abc_LitNot( pLits[2] );
     }
-    RetValue = bmcg_sat_solver_addclause( pSat, pLits, 3 );
+    RetValue = Sat_IfaceAddClause( pSat, pLits, 3 );
     assert( RetValue );
     pLits[0] = Abc_Var2Lit(VarI, 0);
     pLits[1] = Abc_Var2Lit(VarE, 1^fCompE);
@@ -177,7 +181,7 @@ void Cec3_AddClausesMux( Gia_Man_t * p, Gia_Obj_t * pNode, bmcg_sat_solver * pSa
         if ( Gia_Regular(pNodeE)->fPhase )  pLits[1] = Abc_LitNot( pLits[1] );
         if ( pNode->fPhase )                pLits[2] = Abc_LitNot( pLits[2] );
     }
-    RetValue = bmcg_sat_solver_addclause( pSat, pLits, 3 );
+    RetValue = Sat_IfaceAddClause( pSat, pLits, 3 );
     assert( RetValue );
     pLits[0] = Abc_Var2Lit(VarI, 0);
     pLits[1] = Abc_Var2Lit(VarE, 0^fCompE);
@@ -188,7 +192,7 @@ void Cec3_AddClausesMux( Gia_Man_t * p, Gia_Obj_t * pNode, bmcg_sat_solver * pSa
         if ( Gia_Regular(pNodeE)->fPhase )  pLits[1] = Abc_LitNot( pLits[1] );
         if ( pNode->fPhase )                pLits[2] = Abc_LitNot( pLits[2] );
     }
-    RetValue = bmcg_sat_solver_addclause( pSat, pLits, 3 );
+    RetValue = Sat_IfaceAddClause( pSat, pLits, 3 );
     assert( RetValue );
 
     // two additional clauses
@@ -213,7 +217,7 @@ void Cec3_AddClausesMux( Gia_Man_t * p, Gia_Obj_t * pNode, bmcg_sat_solver * pSa
         if ( Gia_Regular(pNodeE)->fPhase )  pLits[1] = Abc_LitNot( pLits[1] );
         if ( pNode->fPhase )                pLits[2] = Abc_LitNot( pLits[2] );
     }
-    RetValue = bmcg_sat_solver_addclause( pSat, pLits, 3 );
+    RetValue = Sat_IfaceAddClause( pSat, pLits, 3 );
     assert( RetValue );
     pLits[0] = Abc_Var2Lit(VarT, 1^fCompT);
     pLits[1] = Abc_Var2Lit(VarE, 1^fCompE);
@@ -224,10 +228,10 @@ void Cec3_AddClausesMux( Gia_Man_t * p, Gia_Obj_t * pNode, bmcg_sat_solver * pSa
         if ( Gia_Regular(pNodeE)->fPhase )  pLits[1] = Abc_LitNot( pLits[1] );
         if ( pNode->fPhase )                pLits[2] = Abc_LitNot( pLits[2] );
     }
-    RetValue = bmcg_sat_solver_addclause( pSat, pLits, 3 );
+    RetValue = Sat_IfaceAddClause( pSat, pLits, 3 );
     assert( RetValue );
 }
-void Cec3_AddClausesSuper( Gia_Man_t * p, Gia_Obj_t * pNode, Vec_Ptr_t * vSuper, bmcg_sat_solver * pSat )
+void Cec3_AddClausesSuper( Gia_Man_t * p, Gia_Obj_t * pNode, Vec_Ptr_t * vSuper, Sat_Iface_t * pSat )
 {
     int fPolarFlip = 0;
     Gia_Obj_t * pFanin;
@@ -248,7 +252,7 @@ void Cec3_AddClausesSuper( Gia_Man_t * p, Gia_Obj_t * pNode, Vec_Ptr_t * vSuper,
             if ( Gia_Regular(pFanin)->fPhase )  pLits[0] = Abc_LitNot( pLits[0] );
             if ( pNode->fPhase )                pLits[1] = Abc_LitNot( pLits[1] );
         }
-        RetValue = bmcg_sat_solver_addclause( pSat, pLits, 2 );
+        RetValue = Sat_IfaceAddClause( pSat, pLits, 2 );
         assert( RetValue );
     }
     // add A & B => C   or   !A + !B + C
@@ -265,7 +269,7 @@ void Cec3_AddClausesSuper( Gia_Man_t * p, Gia_Obj_t * pNode, Vec_Ptr_t * vSuper,
     {
         if ( pNode->fPhase )  pLits[nLits-1] = Abc_LitNot( pLits[nLits-1] );
     }
-    RetValue = bmcg_sat_solver_addclause( pSat, pLits, nLits );
+    RetValue = Sat_IfaceAddClause( pSat, pLits, nLits );
     assert( RetValue );
     ABC_FREE( pLits );
 }
@@ -302,14 +306,14 @@ void Cec3_CollectSuper( Gia_Obj_t * pObj, int fUseMuxes, Vec_Ptr_t * vSuper )
     Vec_PtrClear( vSuper );
     Cec3_CollectSuper_rec( pObj, vSuper, 1, fUseMuxes );
 }
-void Cec3_ObjAddToFrontier( Gia_Man_t * p, Gia_Obj_t * pObj, Vec_Ptr_t * vFrontier, bmcg_sat_solver * pSat )
+void Cec3_ObjAddToFrontier( Gia_Man_t * p, Gia_Obj_t * pObj, Vec_Ptr_t * vFrontier, Sat_Iface_t * pSat )
 {
     assert( !Gia_IsComplement(pObj) );
     assert( !Gia_ObjIsConst0(pObj) );
     if ( Cec3_ObjSatId(p, pObj) >= 0 )
         return;
     assert( Cec3_ObjSatId(p, pObj) == -1 );
-    Cec3_ObjSetSatId( p, pObj, bmcg_sat_solver_addvar(pSat) );
+    Cec3_ObjSetSatId( p, pObj, Sat_IfaceAddVar(pSat) );
     if ( Gia_ObjIsAnd(pObj) )
         Vec_PtrPush( vFrontier, pObj );
 }
@@ -323,7 +327,7 @@ int Cec3_ObjGetCnfVar( Cec3_Man_t * p, int iObj )
         return Cec3_ObjSatId(p->pNew,pObj);
     assert( iObj > 0 );
     if ( Gia_ObjIsCi(pObj) )
-        return Cec3_ObjSetSatId( p->pNew, pObj, bmcg_sat_solver_addvar(p->pSat) );
+        return Cec3_ObjSetSatId( p->pNew, pObj, Sat_IfaceAddVar(p->pSat) );
     assert( Gia_ObjIsAnd(pObj) );
     // start the frontier
     Vec_PtrClear( p->vFrontier );
@@ -402,23 +406,11 @@ static inline void Cec3_ObjSimCo( Gia_Man_t * p, int iObj )
 }
 static inline void Cec3_ObjSimAnd( Gia_Man_t * p, int iObj )
 {
-    int w;
     Gia_Obj_t * pObj = Gia_ManObj( p, iObj );
     word * pSim  = Cec3_ObjSim( p, iObj );
     word * pSim0 = Cec3_ObjSim( p, Gia_ObjFaninId0(pObj, iObj) );
     word * pSim1 = Cec3_ObjSim( p, Gia_ObjFaninId1(pObj, iObj) );
-    if ( Gia_ObjFaninC0(pObj) && Gia_ObjFaninC1(pObj) )
-        for ( w = 0; w < p->nSimWords; w++ )
-            pSim[w] = ~pSim0[w] & ~pSim1[w];
-    else if ( Gia_ObjFaninC0(pObj) && !Gia_ObjFaninC1(pObj) )
-        for ( w = 0; w < p->nSimWords; w++ )
-            pSim[w] = ~pSim0[w] & pSim1[w];
-    else if ( !Gia_ObjFaninC0(pObj) && Gia_ObjFaninC1(pObj) )
-        for ( w = 0; w < p->nSimWords; w++ )
-            pSim[w] = pSim0[w] & ~pSim1[w];
-    else
-        for ( w = 0; w < p->nSimWords; w++ )
-            pSim[w] = pSim0[w] & pSim1[w];
+    Util_SimdAnd( pSim, pSim0, pSim1, Gia_ObjFaninC0(pObj), Gia_ObjFaninC1(pObj), p->nSimWords );
 }
 static inline int Cec3_ObjSimEqual( Gia_Man_t * p, int iObj0, int iObj1 )
 {
@@ -497,8 +489,11 @@ int Cec3_ManSimulate( Gia_Man_t * p, Vec_Int_t * vTriples, Cec3_Man_t * pMan )
     Gia_Obj_t * pObj; 
     int i, iRepr, iObj, Entry, Count = 0;
     //Cec3_ManSaveCis( p );
-    Gia_ManForEachAnd( p, pObj, i )
-        Cec3_ObjSimAnd( p, i );
+    if ( pMan->pSimPar )
+        Gia_SimParSimulate( pMan->pSimPar );
+    else
+        Gia_ManForEachAnd( p, pObj, i )
+            Cec3_ObjSimAnd( p, i );
     pMan->timeSim += Abc_Clock() - clk;
     if ( p->pReprs == NULL )
         return 0;
@@ -679,7 +674,7 @@ Cec3_Man_t * Cec3_ManCreate( Gia_Man_t * pAig, Cec3_Par_t * pPars )
     Vec_IntFill( &p->pNew->vCopies2, Gia_ManObjNum(p->pNew), -1 );
     // SAT solving
     //memset( &Pars, 0, sizeof(satoko_opts_t) );
-    p->pSat         = bmcg_sat_solver_start();
+    p->pSat         = Sat_IfaceStart( pPars->SolverType );
     p->vFrontier    = Vec_PtrAlloc( 1000 );
     p->vFanins      = Vec_PtrAlloc( 100 );
     p->vNodesNew    = Vec_IntAlloc( 100 );
@@ -709,13 +704,16 @@ void Cec3_ManDestroy( Cec3_Man_t * p )
         ABC_PRTP( "Rollback   ", p->timeExtra,     timeTotal );
         ABC_PRTP( "Other      ", timeOther,        timeTotal );
         ABC_PRTP( "TOTAL      ", timeTotal,        timeTotal );
+        if ( p->pSimPar )
+            Gia_SimParPrintStats( p->pSimPar );
         fflush( stdout );
     }
-
+    if ( p->pSimPar )
+        Gia_SimParStop( p->pSimPar );
     Vec_WrdFreeP( &p->pAig->vSims );
     //Vec_WrdFreeP( &p->pAig->vSimsPi );
     Gia_ManCleanMark01( p->pAig );
-    bmcg_sat_solver_stop( p->pSat );
+    Sat_IfaceStop( p->pSat );
     Gia_ManStopP( &p->pNew );
     Vec_PtrFreeP( &p->vFrontier );
     Vec_PtrFreeP( &p->vFanins );
@@ -738,7 +736,7 @@ void Cec3_ManDestroy( Cec3_Man_t * p )
   SeeAlso     []
 
 ***********************************************************************/
-int Cec3_ManVerify_rec( Gia_Man_t * p, int iObj, bmcg_sat_solver * pSat )
+int Cec3_ManVerify_rec( Gia_Man_t * p, int iObj, Sat_Iface_t * pSat )
 {
     int Value0, Value1;
     Gia_Obj_t * pObj = Gia_ManObj( p, iObj );
@@ -748,13 +746,13 @@ int Cec3_ManVerify_rec( Gia_Man_t * p, int iObj, bmcg_sat_solver * pSat )
     Gia_ObjSetTravIdCurrentId(p, iObj);
     if ( Gia_ObjIsCi(pObj) )
 //        return pObj->fMark1 = satoko_var_polarity(pSat, Cec3_ObjSatId(p, pObj)) == SATOKO_LIT_TRUE;
-        return pObj->fMark1 = bmcg_sat_solver_read_cex_varvalue(pSat, Cec3_ObjSatId(p, pObj));
+        return pObj->fMark1 = Sat_IfaceVarValue(pSat, Cec3_ObjSatId(p, pObj));
     assert( Gia_ObjIsAnd(pObj) );
     Value0 = Cec3_ManVerify_rec( p, Gia_ObjFaninId0(pObj, iObj), pSat ) ^ Gia_ObjFaninC0(pObj);
     Value1 = Cec3_ManVerify_rec( p, Gia_ObjFaninId1(pObj, iObj), pSat ) ^ Gia_ObjFaninC1(pObj);
     return pObj->fMark1 = Value0 & Value1;
 }
-void Cec3_ManVerify( Gia_Man_t * p, int iObj0, int iObj1, int fPhase, bmcg_sat_solver * pSat )
+void Cec3_ManVerify( Gia_Man_t * p, int iObj0, int iObj1, int fPhase, Sat_Iface_t * pSat )
 {
 //    int val0 = satoko_var_polarity(pSat, Cec3_ObjSatId(p, Gia_ManObj(p, iObj0))) == SATOKO_LIT_TRUE;
 //    int val1 = satoko_var_polarity(pSat, Cec3_ObjSatId(p, Gia_ManObj(p, iObj1))) == SATOKO_LIT_TRUE;
@@ -811,9 +809,9 @@ int Cec3_ManSolveTwo( Cec3_Man_t * p, int iObj0, int iObj1, int fPhase )
 	if (iObj1 < iObj0) 
         iObj1 ^= iObj0, iObj0 ^= iObj1, iObj1 ^= iObj0;
     assert( iObj0 < iObj1 );
-    assert( p->pPars->fUseCones || bmcg_sat_solver_varnum(p->pSat) == 0 );
+    assert( p->pPars->fUseCones || Sat_IfaceVarNum(p->pSat) == 0 );
     if ( !iObj0 && Cec3_ObjSatId(p->pNew, Gia_ManConst0(p->pNew)) == -1 )
-        Cec3_ObjSetSatId( p->pNew, Gia_ManConst0(p->pNew), bmcg_sat_solver_addvar(p->pSat) );
+        Cec3_ObjSetSatId( p->pNew, Gia_ManConst0(p->pNew), Sat_IfaceAddVar(p->pSat) );
     iVar0 = Cec3_ObjGetCnfVar( p, iObj0 );
     iVar1 = Cec3_ObjGetCnfVar( p, iObj1 );
     // collect inputs and internal nodes
@@ -825,7 +823,7 @@ int Cec3_ManSolveTwo( Cec3_Man_t * p, int iObj0, int iObj1, int fPhase )
     Cec3_ManCollect_rec( p, iObj1 );
 //printf( "%d ", Vec_IntSize(p->vNodesNew) );
     // solve direct
-    if ( p->pPars->fUseCones )  satoko_mark_cone( p->pSat, Vec_IntArray(p->vSatVars), Vec_IntSize(p->vSatVars) );
+    if ( p->pPars->fUseCones )  Sat_IfaceMarkCone( p->pSat, Vec_IntArray(p->vSatVars), Vec_IntSize(p->vSatVars) );
 //    satoko_assump_push( p->pSat, Abc_Var2Lit(iVar0, 1) );
 //    satoko_assump_push( p->pSat, Abc_Var2Lit(iVar1, fPhase) );
 //    status = satoko_solve( p->pSat );
@@ -833,9 +831,9 @@ int Cec3_ManSolveTwo( Cec3_Man_t * p, int iObj0, int iObj1, int fPhase )
 //    satoko_assump_pop( p->pSat );
     Lits[0] = Abc_Var2Lit(iVar0, 1);
     Lits[1] = Abc_Var2Lit(iVar1, fPhase);
-    bmcg_sat_solver_set_conflict_budget( p->pSat, p->pPars->nConfLimit );
-    status = bmcg_sat_solver_solve( p->pSat, Lits, 2 );
-    if ( status == GLUCOSE_UNSAT && iObj0 > 0 )
+    Sat_IfaceSetConflictLimit( p->pSat, p->pPars->nConfLimit );
+    status = Sat_IfaceSolve( p->pSat, Lits, 2 );
+    if ( status == SAT_IFACE_UNSAT && iObj0 > 0 )
     {
         // solve reverse
 //        satoko_assump_push( p->pSat, Abc_Var2Lit(iVar0, 0) );
@@ -845,10 +843,10 @@ int Cec3_ManSolveTwo( Cec3_Man_t * p, int iObj0, int iObj1, int fPhase )
 //        satoko_assump_pop( p->pSat );
         Lits[0] = Abc_Var2Lit(iVar0, 0);
         Lits[1] = Abc_Var2Lit(iVar1, !fPhase);
-        bmcg_sat_solver_set_conflict_budget( p->pSat, p->pPars->nConfLimit );
-        status = bmcg_sat_solver_solve( p->pSat, Lits, 2 );
+        Sat_IfaceSetConflictLimit( p->pSat, p->pPars->nConfLimit );
+        status = Sat_IfaceSolve( p->pSat, Lits, 2 );
     }
-    if ( p->pPars->fUseCones )  satoko_unmark_cone( p->pSat, Vec_IntArray(p->vSatVars), Vec_IntSize(p->vSatVars) );
+    if ( p->pPars->fUseCones )  Sat_IfaceUnmarkCone( p->pSat, Vec_IntArray(p->vSatVars), Vec_IntSize(p->vSatVars) );
     //if ( status == SATOKO_SAT )
     //    Cec3_ManVerify( p->pNew, iObj0, iObj1, fPhase, p->pSat );
     if ( p->pPars->fUseCones )
@@ -866,7 +864,7 @@ int Cec3_ManSweepNode( Cec3_Man_t * p, int iObj )
     Gia_Obj_t * pRepr = Gia_ObjReprObj( p->pAig, iObj );
     int fCompl = Abc_LitIsCompl(pObj->Value) ^ Abc_LitIsCompl(pRepr->Value) ^ pObj->fPhase ^ pRepr->fPhase;
     status = Cec3_ManSolveTwo( p, Abc_Lit2Var(pRepr->Value), Abc_Lit2Var(pObj->Value), fCompl );
-    if ( status == GLUCOSE_SAT )
+    if ( status == SAT_IFACE_SAT )
     {
         p->nSatSat++;
         p->nPatterns++;
@@ -874,11 +872,11 @@ int Cec3_ManSweepNode( Cec3_Man_t * p, int iObj )
         assert( p->pAig->iPatsPi > 0 && p->pAig->iPatsPi < 64 * p->pAig->nSimWords );
         Vec_IntForEachEntryDouble( p->vObjSatPairs, IdAig, IdSat, i )
 //            Cec3_ObjSimSetInputBit( p->pAig, IdAig, satoko_var_polarity(p->pSat, IdSat) == SATOKO_LIT_TRUE );
-            Cec3_ObjSimSetInputBit( p->pAig, IdAig, bmcg_sat_solver_read_cex_varvalue(p->pSat, IdSat) );
+            Cec3_ObjSimSetInputBit( p->pAig, IdAig, Sat_IfaceVarValue(p->pSat, IdSat) );
         p->timeSatSat += Abc_Clock() - clk;
         RetValue = 0;
     }
-    else if ( status == GLUCOSE_UNSAT )
+    else if ( status == SAT_IFACE_UNSAT )
     {
         p->nSatUnsat++;
         pObj->Value = Abc_LitNotCond( pRepr->Value, fCompl );
@@ -889,7 +887,7 @@ int Cec3_ManSweepNode( Cec3_Man_t * p, int iObj )
     else 
     {
         p->nSatUndec++;
-        assert( status == GLUCOSE_UNDEC );
+        assert( status == SAT_IFACE_UNDEC );
         Gia_ObjSetFailed( p->pAig, iObj );
         p->timeSatUndec += Abc_Clock() - clk;
         RetValue = 2;
@@ -897,7 +895,7 @@ int Cec3_ManSweepNode( Cec3_Man_t * p, int iObj )
     if ( p->pPars->fUseCones )
         return RetValue;
     clk = Abc_Clock();
-    bmcg_sat_solver_reset( p->pSat );
+    Sat_IfaceReset( p->pSat );
     p->timeExtra += Abc_Clock() - clk;
 //    satoko_stats(p->pSat)->n_conflicts = 0;
     return RetValue;
@@ -932,6 +930,8 @@ int Cec3_ManPerformSweeping( Gia_Man_t * p, Cec3_Par_t * pPars, Gia_Man_t ** ppN
 
     // simulate one round and create classes
     Cec3_ManSimAlloc( p, pPars->nSimWords );
+    if ( pPars->nThreads > 1 )
+        pMan->pSimPar = Gia_SimParStart( p, Vec_WrdArray(p->vSims), pPars->nSimWords, pPars->nThreads );
     Cec3_ManSimulateCis( p );
     Cec3_ManSimulate( p, NULL, pMan );
     if ( pPars->fIsMiter && !Cec3_ManSimulateCos(p) ) // cex detected
@@ -1031,6 +1031,8 @@ Gia_Man_t * Cec3_ManSimulateTest( Gia_Man_t * p, Cec_ParFra_t * pPars0 )
 //    pPars->nItersMax  = pPars0->nItersMax;  // max number of iterations
     pPars->nConfLimit = pPars0->nBTLimit;   // conflict limit at a node
     pPars->fUseCones  = pPars0->fUseCones;
+    pPars->nThreads   = pPars0->nThreads;
+    pPars->SolverType = pPars0->SolverType;
     pPars->fVerbose   = pPars0->fVerbose;
 //    Gia_ManComputeGiaEquivs( p, 100000, 0 );
 //    Gia_ManEquivPrintClasses( p, 1, 0 );
@@ -1039,6 +1041,60 @@ Gia_Man_t * Cec3_ManSimulateTest( Gia_Man_t * p, Cec_ParFra_t * pPars0 )
     return pNew;
 }
 
+/**Function*************************************************************
+
+  Synopsis    [Solves the outputs of the miter using the given solvers.]
+
+  Description [If more than one solver is given, they are run in parallel
+  as a portfolio sharing learnt clauses. The CNF is derived once and
+  the outputs are solved incrementally. Returns 1 if all outputs are 
+  UNSAT, 0 if one of them is SAT (the counter-example for the first one
+  is stored in p->pCexComb), and -1 if undecided.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Cec3_ManSolveOutputs( Gia_Man_t * p, Vec_Int_t * vTypes, int nConfLimit, int fVerbose )
+{
+    abctime clk = Abc_ClockWall();
+    Cnf_Dat_t * pCnf = (Cnf_Dat_t *)Mf_ManGenerateCnf( p, 8, 0, 0, 0, 0 );
+    Sat_Iface_t * pSat = Vec_IntSize(vTypes) == 1 ? Sat_IfaceStart( Vec_IntEntry(vTypes, 0) ) : Sat_IfaceStartPortfolio( vTypes );
+    int i, k, Lit, status, fUnsat = 0, nSat = 0, nUnsat = 0, nUndec = 0;
+    int iFirstCi = pCnf->nVars - Gia_ManCiNum(p); // the CNF variables of the COs are 1, 2, etc
+    Gia_Obj_t * pObj;
+    Sat_IfaceSetVarNum( pSat, pCnf->nVars );
+    for ( i = 0; i < pCnf->nClauses && !fUnsat; i++ )
+        fUnsat = !Sat_IfaceAddClause( pSat, pCnf->pClauses[i], pCnf->pClauses[i+1]-pCnf->pClauses[i] );
+    Sat_IfaceSetConflictLimit( pSat, nConfLimit );
+    Abc_CexFreeP( &p->pCexComb );
+    Gia_ManForEachCo( p, pObj, i )
+    {
+        Lit = Abc_Var2Lit( 1 + i, 0 );
+        status = fUnsat ? SAT_IFACE_UNSAT : Sat_IfaceSolve( pSat, &Lit, 1 );
+        if ( status == SAT_IFACE_UNSAT )
+            nUnsat++;
+        else if ( status == SAT_IFACE_UNDEC )
+            nUndec++;
+        else if ( nSat++ == 0 )
+        {
+            p->pCexComb = Abc_CexAlloc( 0, Gia_ManCiNum(p), 1 );
+            p->pCexComb->iPo = i;
+            for ( k = 0; k < Gia_ManCiNum(p); k++ )
+                if ( Sat_IfaceVarValue(pSat, iFirstCi + k) )
+                    Abc_InfoSetBit( p->pCexComb->pData, k );
+        }
+    }
+    printf( "Outputs = %d.  Unsat = %d.  Sat = %d.  Undec = %d.  ", Gia_ManCoNum(p), nUnsat, nSat, nUndec );
+    Abc_PrintTime( 1, "Time", Abc_ClockWall() - clk );
+    if ( fVerbose && Sat_IfaceType(pSat) == SAT_IFACE_PORT )
+        Sat_PortPrintStats( (Sat_Port_t *)Sat_IfaceSolver(pSat) );
+    Sat_IfaceStop( pSat );
+    Cnf_DataFree( pCnf );
+    return nSat ? 0 : nUndec ? -1 : 1;
+}
+
 ////////////////////////////////////////////////////////////////////////
 ///                       END OF FILE                                ///
 ////////////////////////////////////////////////////////////////////////
@@ -20,6 +20,17 @@
 
 #include "cecInt.h"
 
+#ifdef ABC_USE_PTHREADS
+
+#ifdef _WIN32
+#include "../lib/pthread.h"
+#else
+#include <pthread.h>
+#include <unistd.h>
+#endif
+
+#endif
+
 ABC_NAMESPACE_IMPL_START
 
 
@@ -30,6 +41,11 @@ ABC_NAMESPACE_IMPL_START
 static inline int  Cec_ObjSatNum( Cec_ManSat_t * p, Gia_Obj_t * pObj )             { return p->pSatVars[Gia_ObjId(p->pAig,pObj)]; }
 static inline void Cec_ObjSetSatNum( Cec_ManSat_t * p, Gia_Obj_t * pObj, int Num ) { p->pSatVars[Gia_ObjId(p->pAig,pObj)] = Num;  }
 
+#define PAR_THR_MAX 100
+
+// the number of outputs taken by a thread at a time
+#define CEC_SAT_PAR_CHUNK 16
+
 ////////////////////////////////////////////////////////////////////////
 ///                     FUNCTION DEFINITIONS                         ///
 ////////////////////////////////////////////////////////////////////////
@@ -688,6 +704,11 @@ void Cec_ManSatSolve( Cec_ManPat_t * pPat, Gia_Man_t * pAig, Cec_ParSat_t * pPar
         pPat->nPatLits = 0;
         pPat->nPatLitsMin = 0;
     } 
+    if ( pPars->nThreads > 1 && Gia_ManPoNum(pAig) > CEC_SAT_PAR_CHUNK )
+    {
+        Cec_ManSatSolvePar( pPat, pAig, pPars, vIdsOrig, vMiterPairs, vEquivPairs );
+        return;
+    }
     Gia_ManSetPhase( pAig );
     Gia_ManLevelNum( pAig );
     Gia_ManIncrementTravId( pAig );
@@ -745,6 +766,164 @@ clk2 = Abc_Clock();
     Cec_ManSatStop( p );
 }
 
+#ifdef ABC_USE_PTHREADS
+
+/**Function*************************************************************
+
+  Synopsis    [Performs one round of solving using several threads.]
+
+  Description [Each thread owns a SAT solver and takes the outputs of
+  the speculatively reduced miter in chunks of CEC_SAT_PAR_CHUNK, so
+  that the neighboring candidate pairs, which often share logic, are
+  solved by the same solver. The AIG is only read by the solvers.
+  Counter-examples are derived and stored under the lock because they 
+  use the traversal IDs and node marks of the AIG. The results are the 
+  same as those of Cec_ManSatSolve(), except that the order of the 
+  stored patterns depends on thread scheduling.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+typedef struct Cec_SatParShared_t_
+{
+    Gia_Man_t *      pAig;
+    Cec_ManPat_t *   pPat;
+    Vec_Int_t *      vIdsOrig;
+    Vec_Int_t *      vMiterPairs;
+    Vec_Int_t *      vEquivPairs;
+    pthread_mutex_t  Mutex;           // protects the fields below and the AIG traversal
+    int              iNext;           // the next output to solve
+    volatile int     fStop;           // a miter output is satisfiable
+} Cec_SatParShared_t;
+typedef struct Cec_SatParThData_t_
+{
+    Cec_SatParShared_t * pShared;
+    Cec_ManSat_t *   pSat;            // the solver of this thread
+} Cec_SatParThData_t;
+static void * Cec_ManSatSolveParThread( void * pArg )
+{
+    Cec_SatParThData_t * pThData = (Cec_SatParThData_t *)pArg;
+    Cec_SatParShared_t * pShared = pThData->pShared;
+    Cec_ManSat_t * p = pThData->pSat;
+    Gia_Man_t * pAig = pShared->pAig;
+    Gia_Obj_t * pObj;
+    int i, iStart, iStop, status;
+    while ( !pShared->fStop )
+    {
+        pthread_mutex_lock( &pShared->Mutex );
+        iStart = pShared->iNext;
+        pShared->iNext += CEC_SAT_PAR_CHUNK;
+        pthread_mutex_unlock( &pShared->Mutex );
+        if ( iStart >= Gia_ManPoNum(pAig) )
+            break;
+        iStop = Abc_MinInt( iStart + CEC_SAT_PAR_CHUNK, Gia_ManPoNum(pAig) );
+        for ( i = iStart; i < iStop && !pShared->fStop; i++ )
+        {
+            pObj = Gia_ManCo( pAig, i );
+            if ( Gia_ObjIsConst0(Gia_ObjFanin0(pObj)) )
+            {
+                pObj->fMark0 = 0;
+                pObj->fMark1 = 1;
+                continue;
+            }
+            status = Cec_ManSatCheckNode( p, Gia_ObjChild0(pObj) );
+            pObj->fMark0 = (status == 0);
+            pObj->fMark1 = (status == 1);
+            if ( status == 1 && pShared->vIdsOrig )
+            {
+                int iObj1 = Vec_IntEntry(pShared->vMiterPairs, 2*i);
+                int iObj2 = Vec_IntEntry(pShared->vMiterPairs, 2*i+1);
+                int OrigId1 = Vec_IntEntry(pShared->vIdsOrig, iObj1);
+                int OrigId2 = Vec_IntEntry(pShared->vIdsOrig, iObj2);
+                assert( OrigId1 >= 0 && OrigId2 >= 0 );
+                pthread_mutex_lock( &pShared->Mutex );
+                Vec_IntPushTwo( pShared->vEquivPairs, OrigId1, OrigId2 );
+                pthread_mutex_unlock( &pShared->Mutex );
+            }
+            if ( status != 0 )
+                continue;
+            pthread_mutex_lock( &pShared->Mutex );
+            // save the pattern
+            if ( pShared->pPat )
+            {
+                abctime clk3 = Abc_Clock();
+                Cec_ManPatSavePattern( pShared->pPat, p, pObj );
+                pShared->pPat->timeTotalSave += Abc_Clock() - clk3;
+            }
+            // quit if one of them is solved
+            if ( p->pPars->fCheckMiter )
+                pShared->fStop = 1;
+            pthread_mutex_unlock( &pShared->Mutex );
+        }
+    }
+    return NULL;
+}
+void Cec_ManSatSolvePar( Cec_ManPat_t * pPat, Gia_Man_t * pAig, Cec_ParSat_t * pPars, Vec_Int_t * vIdsOrig, Vec_Int_t * vMiterPairs, Vec_Int_t * vEquivPairs )
+{
+    pthread_t WorkerThread[PAR_THR_MAX];
+    Cec_SatParThData_t ThData[PAR_THR_MAX];
+    Cec_SatParShared_t Shared, * pShared = &Shared;
+    Cec_ManSat_t * p;
+    int i, status, nThreads = Abc_MinInt( pPars->nThreads, PAR_THR_MAX );
+    abctime clk = Abc_Clock();
+    Gia_ManSetPhase( pAig );
+    Gia_ManLevelNum( pAig );
+    Gia_ManIncrementTravId( pAig );
+    memset( pShared, 0, sizeof(Cec_SatParShared_t) );
+    pShared->pAig        = pAig;
+    pShared->pPat        = pPat;
+    pShared->vIdsOrig    = vIdsOrig;
+    pShared->vMiterPairs = vMiterPairs;
+    pShared->vEquivPairs = vEquivPairs;
+    pthread_mutex_init( &pShared->Mutex, NULL );
+    for ( i = 0; i < nThreads; i++ )
+    {
+        ThData[i].pShared = pShared;
+        ThData[i].pSat    = Cec_ManSatCreate( pAig, pPars );
+        status = pthread_create( WorkerThread + i, NULL, Cec_ManSatSolveParThread, (void *)(ThData + i) );  assert( status == 0 );
+    }
+    for ( i = 0; i < nThreads; i++ )
+    {
+        status = pthread_join( WorkerThread[i], NULL );  assert( status == 0 );
+    }
+    pthread_mutex_destroy( &pShared->Mutex );
+    // collect statistics in the first manager
+    p = ThData[0].pSat;
+    for ( i = 1; i < nThreads; i++ )
+    {
+        p->nSatUnsat    += ThData[i].pSat->nSatUnsat;
+        p->nSatSat      += ThData[i].pSat->nSatSat;
+        p->nSatUndec    += ThData[i].pSat->nSatUndec;
+        p->nSatTotal    += ThData[i].pSat->nSatTotal;
+        p->nConfUnsat   += ThData[i].pSat->nConfUnsat;
+        p->nConfSat     += ThData[i].pSat->nConfSat;
+        p->nConfUndec   += ThData[i].pSat->nConfUndec;
+        p->nRecycles    += ThData[i].pSat->nRecycles;
+        p->timeSatUnsat += ThData[i].pSat->timeSatUnsat;
+        p->timeSatSat   += ThData[i].pSat->timeSatSat;
+        p->timeSatUndec += ThData[i].pSat->timeSatUndec;
+        Cec_ManSatStop( ThData[i].pSat );
+    }
+    p->timeTotal = Abc_Clock() - clk;
+    if ( pPars->fVerbose )
+        Cec_ManSatPrintStats( p );
+    Cec_ManSatStop( p );
+}
+
+#else
+
+void Cec_ManSatSolvePar( Cec_ManPat_t * pPat, Gia_Man_t * pAig, Cec_ParSat_t * pPars, Vec_Int_t * vIdsOrig, Vec_Int_t * vMiterPairs, Vec_Int_t * vEquivPairs )
+{
+    int nThreads = pPars->nThreads;
+    pPars->nThreads = 1;
+    Cec_ManSatSolve( pPat, pAig, pPars, vIdsOrig, vMiterPairs, vEquivPairs );
+    pPars->nThreads = nThreads;
+}
+
+#endif // pthreads are used
+
 /**Function*************************************************************
 
   Synopsis    [Performs one round of solving for the POs of the AIG.]
@@ -24,6 +24,7 @@
 #include "sat/cnf/cnf.h"
 #include "sat/bsat/satSolver.h"
 #include "misc/util/utilTruth.h"
+#include "misc/util/utilTask.h"
 //#include "bdd/cudd/cuddInt.h"
 
 #ifdef ABC_USE_PTHREADS
@@ -148,7 +149,7 @@ void Cec_GiaSplitExplore( Gia_Man_t * p )
     Gia_Obj_t * pObj, * pFan0, * pFan1;
     int i, Counter = 0;
     assert( p->pMuxes == NULL );
-    ABC_FREE( p->pRefs );
+    Gia_ManAuxIntFreeP( p, &p->pRefs );
     Gia_ManCreateRefs( p ); 
     Gia_ManForEachAnd( p, pObj, i )
     {
@@ -528,57 +529,126 @@ int Cec_GiaSplitTest2( Gia_Man_t * p, int nProcs, int nTimeOut, int nIterMax, in
 
 /**Function*************************************************************
 
-  Synopsis    []
+  Synopsis    [Solves the cofactors in parallel using the task pool.]
 
-  Description []
+  Description [Each task solves one cofactor. If the result is undecided,
+  the task splits the cofactor further and spawns two new tasks, which
+  are placed into the deque of the current worker and can be stolen by
+  the idle workers.]
                
   SideEffects []
 
   SeeAlso     []
 
 ***********************************************************************/
-#define PAR_THR_MAX 100
-typedef struct Par_ThData_t_
+typedef struct Cec_SplitMan_t_ Cec_SplitMan_t;
+struct Cec_SplitMan_t_
 {
-    Gia_Man_t * p;
-    Cnf_Dat_t * pCnf;
-    int         iThread;
-    int         nTimeOut;
-    int         fWorking;
-    int         Result;
-    int         nVars;
-    int         nConfs;
-} Par_ThData_t;
-void * Cec_GiaSplitWorkerThread( void * pArg )
+    Gia_Man_t *     pGia;         // the original problem
+    Util_Pool_t *   pPool;        // the task pool
+    pthread_mutex_t Mutex;        // protects the data below and the CNF computation
+    int             nTimeOut;
+    int             nIterMax;
+    int             LookAhead;
+    int             fVerbose;
+    int             fVeryVerbose;
+    abctime         clkTotal;
+    double          Progress;     // the fraction of the solved space
+    int             nIter;        // the number of case-splits
+    int             fSat;         // a satisfying assignment is found
+    int             fUndec;       // some cofactors are not solved
+};
+typedef struct Cec_SplitTask_t_
+{
+    Cec_SplitMan_t * pMan;        // the manager
+    Gia_Man_t *      pPart;       // the cofactor
+    int              fSolved;     // the cofactor is known to be undecided
+} Cec_SplitTask_t;
+
+void * Cec_GiaSplitSolveTask( void * pArg );
+static void Cec_GiaSplitSpawn( Cec_SplitMan_t * p, Gia_Man_t * pPart, int fSolved )
+{
+    Cec_SplitTask_t * pTask = ABC_CALLOC( Cec_SplitTask_t, 1 );
+    pTask->pMan    = p;
+    pTask->pPart   = pPart;
+    pTask->fSolved = fSolved;
+    Util_PoolSpawn( p->pPool, Cec_GiaSplitSolveTask, pTask );
+}
+void * Cec_GiaSplitSolveTask( void * pArg )
 {
-    Par_ThData_t * pThData = (Par_ThData_t *)pArg;
-    volatile int * pPlace = &pThData->fWorking;
-    while ( 1 )
+    Cec_SplitTask_t * pTask = (Cec_SplitTask_t *)pArg;
+    Cec_SplitMan_t * p = pTask->pMan;
+    Gia_Man_t * pLast = pTask->pPart, * pPart;
+    int fSolved = pTask->fSolved;
+    int Depth = pLast->vCofVars ? Vec_IntSize(pLast->vCofVars) : 0;
+    int c, status = -1, nSatVars = 0, nSatConfs = 0, fSplit = 0;
+    ABC_FREE( pTask );
+    if ( pLast->vCofVars == NULL )
+        pLast->vCofVars = Vec_IntAlloc( 100 );
+    if ( !fSolved && !Util_PoolIsCanceled(p->pPool) )
     {
-        while ( *pPlace == 0 );
-        assert( pThData->fWorking );
-        if ( pThData->p == NULL )
+        Cnf_Dat_t * pCnf;
+        // the CNF computation uses the global manager
+        pthread_mutex_lock( &p->Mutex );
+        pCnf = Cec_GiaDeriveGiaRemapped( pLast );
+        pthread_mutex_unlock( &p->Mutex );
+        status = Cnf_GiaSolveOne( pLast, pCnf, p->nTimeOut, &nSatVars, &nSatConfs );
+        Cnf_DataFree( pCnf );
+    }
+    pthread_mutex_lock( &p->Mutex );
+    if ( !fSolved && !Util_PoolIsCanceled(p->pPool) && p->fVerbose )
+        Cec_GiaSplitPrint( Util_TaskWorkerId(p->pPool)+1, Depth, nSatVars, nSatConfs, status, p->Progress, Abc_ClockWall() - p->clkTotal );
+    if ( status == 0 ) // SAT
+    {
+        if ( !p->fSat )
         {
-	        pthread_exit( NULL );
-            assert( 0 );
-            return NULL;
+            p->pGia->pCexComb = pLast->pCexComb;  pLast->pCexComb = NULL;
+            p->fSat = 1;
         }
-        pThData->Result = Cnf_GiaSolveOne( pThData->p, pThData->pCnf, pThData->nTimeOut, &pThData->nVars, &pThData->nConfs );
-        pThData->fWorking = 0;
+        Util_PoolCancel( p->pPool );
+    }
+    else if ( status == 1 ) // UNSAT
+        p->Progress += 1.0 / pow(2, Depth);
+    else if ( Util_PoolIsCanceled(p->pPool) || (p->nIterMax && p->nIter >= p->nIterMax) )
+    {
+        p->fUndec = 1;
+        Util_PoolCancel( p->pPool );
     }
-	assert( 0 );
-	return NULL;
+    else
+    {
+        p->nIter++;
+        fSplit = 1;
+    }
+    pthread_mutex_unlock( &p->Mutex );
+    if ( fSplit )
+    {
+        // determine cofactoring variable
+        int nFanouts, Cost, iVar = Gia_SplitCofVar( pLast, p->LookAhead, &nFanouts, &Cost );
+        for ( c = 1; c >= 0; c-- )
+        {
+            pPart = Gia_ManDupCofactorVar( pLast, iVar, c );
+            pPart->vCofVars = Vec_IntAlloc( Vec_IntSize(pLast->vCofVars) + 1 );
+            Vec_IntAppend( pPart->vCofVars, pLast->vCofVars );
+            Vec_IntPush( pPart->vCofVars, Abc_Var2Lit(iVar, !c) );
+            if ( p->fVeryVerbose )
+            {
+                pthread_mutex_lock( &p->Mutex );
+                printf( "Var = %5d. Fanouts = %5d. Cost = %8d.  AndBefore = %6d.  AndAfter = %6d.\n", 
+                    iVar, nFanouts, Cost, Gia_ManAndNum(pLast), Gia_ManAndNum(pPart) );
+                pthread_mutex_unlock( &p->Mutex );
+            }
+            Cec_GiaSplitSpawn( p, pPart, 0 );
+        }
+    }
+    Gia_ManStop( pLast );
+    return NULL;
 }
 int Cec_GiaSplitTestInt( Gia_Man_t * p, int nProcs, int nTimeOut, int nIterMax, int LookAhead, int fVerbose, int fVeryVerbose, int fSilent )
 {
-    abctime clkTotal = Abc_Clock();
-    Par_ThData_t ThData[PAR_THR_MAX];
-	pthread_t WorkerThread[PAR_THR_MAX];
-    Vec_Ptr_t * vStack;
+    abctime clkTotal = Abc_ClockWall();
+    Cec_SplitMan_t Man, * pMan = &Man;
     Cnf_Dat_t * pCnf;
-    double Progress = 0;
-    int i, status, nSatVars, nSatConfs;
-    int nIter = 0, RetValue = -1, fWorkToDo = 1;
+    int status, nSatVars, nSatConfs, RetValue;
     Abc_CexFreeP( &p->pCexComb );
     if ( fVerbose )
         printf( "Solving CEC problem by cofactoring with the following parameters:\n" );
@@ -587,15 +657,12 @@ int Cec_GiaSplitTestInt( Gia_Man_t * p, int nProcs, int nTimeOut, int nIterMax,
     fflush( stdout );
     if ( nProcs == 1 )
         return Cec_GiaSplitTest2( p, nProcs, nTimeOut, nIterMax, LookAhead, fVerbose, fVeryVerbose, fSilent );
-    // subtract manager thread
-    nProcs--;
-    assert( nProcs >= 1 && nProcs <= PAR_THR_MAX );
     // check the problem
     pCnf = Cec_GiaDeriveGiaRemapped( p );
     status = Cnf_GiaSolveOne( p, pCnf, nTimeOut, &nSatVars, &nSatConfs );
     Cnf_DataFree( pCnf );
     if ( fVerbose && status != -1 )
-        Cec_GiaSplitPrint( 0, 0, nSatVars, nSatConfs, status, Progress, Abc_Clock() - clkTotal );
+        Cec_GiaSplitPrint( 0, 0, nSatVars, nSatConfs, status, 0, Abc_ClockWall() - clkTotal );
     if ( status == 0 )
     {
 		if ( !fSilent )
@@ -609,119 +676,22 @@ int Cec_GiaSplitTestInt( Gia_Man_t * p, int nProcs, int nTimeOut, int nIterMax,
         return 1;
     }
     assert( status == -1 );
-    // create local copy
-    vStack = Vec_PtrAlloc( 1000 );
-    Vec_PtrPush( vStack, Gia_ManDup(p) );
-    // start threads
-    for ( i = 0; i < nProcs; i++ )
-    {
-        ThData[i].p        = NULL;
-        ThData[i].pCnf     = NULL;
-        ThData[i].iThread  = i;
-        ThData[i].nTimeOut = nTimeOut;
-        ThData[i].fWorking = 0;
-        ThData[i].Result   = -1;
-        ThData[i].nVars    = -1;
-        ThData[i].nConfs   = -1;
-        status = pthread_create( WorkerThread + i, NULL,Cec_GiaSplitWorkerThread, (void *)(ThData + i) );  assert( status == 0 );
-    }
-    // look at the threads
-    while ( fWorkToDo )
-    {
-        fWorkToDo = (int)(Vec_PtrSize(vStack) > 0);
-        for ( i = 0; i < nProcs; i++ )
-        {
-            // check if this thread is working
-            if ( ThData[i].fWorking )
-            {
-                fWorkToDo = 1;
-                continue;
-            }
-            // check if this thread has recently finished
-            if ( ThData[i].p != NULL )
-            {
-                Gia_Man_t * pLast = ThData[i].p;
-                int Depth = pLast->vCofVars ? Vec_IntSize(pLast->vCofVars) : 0;
-                if ( pLast->vCofVars == NULL )
-                    pLast->vCofVars = Vec_IntAlloc( 100 );
-                if ( fVerbose )
-                    Cec_GiaSplitPrint( i+1, Depth, ThData[i].nVars, ThData[i].nConfs, ThData[i].Result, Progress, Abc_Clock() - clkTotal );
-                if ( ThData[i].Result == 0 ) // SAT
-                {
-                    p->pCexComb = pLast->pCexComb;  pLast->pCexComb = NULL;
-                    RetValue = 0;
-                    goto finish;
-                }
-                if ( ThData[i].Result == -1 ) // UNDEC
-                {
-                    // determine cofactoring variable
-                    int nFanouts, Cost, iVar = Gia_SplitCofVar( pLast, LookAhead, &nFanouts, &Cost );
-                    // cofactor
-                    Gia_Man_t * pPart = Gia_ManDupCofactorVar( pLast, iVar, 0 );
-                    pPart->vCofVars = Vec_IntAlloc( Vec_IntSize(pLast->vCofVars) + 1 );
-                    Vec_IntAppend( pPart->vCofVars, pLast->vCofVars );
-                    Vec_IntPush( pPart->vCofVars, Abc_Var2Lit(iVar, 1) );
-                    Vec_PtrPush( vStack, pPart );
-                    // print results
-                    if ( fVeryVerbose )
-                    {
-//                        Cec_GiaSplitPrintRefs( pLast );
-                        printf( "Var = %5d. Fanouts = %5d. Cost = %8d.  AndBefore = %6d.  AndAfter = %6d.\n", 
-                            iVar, nFanouts, Cost, Gia_ManAndNum(pLast), Gia_ManAndNum(pPart) );
-//                        Cec_GiaSplitPrintRefs( pPart );
-                    }
-                    // cofactor
-                    pPart = Gia_ManDupCofactorVar( pLast, iVar, 1 );
-                    pPart->vCofVars = Vec_IntAlloc( Vec_IntSize(pLast->vCofVars) + 1 );
-                    Vec_IntAppend( pPart->vCofVars, pLast->vCofVars );
-                    Vec_IntPush( pPart->vCofVars, Abc_Var2Lit(iVar, 1) );
-                    Vec_PtrPush( vStack, pPart );
-                    // keep working
-                    fWorkToDo = 1;
-                    nIter++;
-                }
-                else
-                    Progress += 1.0 / pow(2, Depth);
-                Gia_ManStopP( &ThData[i].p );
-                if ( ThData[i].pCnf == NULL )
-                    continue;
-                Cnf_DataFree( ThData[i].pCnf );
-                ThData[i].pCnf = NULL;
-            }
-            if ( Vec_PtrSize(vStack) == 0 )
-                continue;
-            // start a new thread
-            assert( ThData[i].p == NULL );
-            ThData[i].p = (Gia_Man_t*)Vec_PtrPop( vStack );
-            ThData[i].pCnf = Cec_GiaDeriveGiaRemapped( ThData[i].p );
-            ThData[i].fWorking = 1;
-        }
-        if ( nIterMax && nIter >= nIterMax )
-            break;
-    }
-    if ( !fWorkToDo )
-        RetValue = 1;
-finish:
-    // wait till threads finish
-    for ( i = 0; i < nProcs; i++ )
-        if ( ThData[i].fWorking )
-            i = 0;
-    // stop threads
-    for ( i = 0; i < nProcs; i++ )
-    {
-        assert( !ThData[i].fWorking );
-        // cleanup
-        Gia_ManStopP( &ThData[i].p );
-        if ( ThData[i].pCnf == NULL )
-            continue;
-        Cnf_DataFree( ThData[i].pCnf );
-        ThData[i].pCnf = NULL;
-        // stop
-        ThData[i].p = NULL;
-        ThData[i].fWorking = 1;
-    }
-    // finish
-    Cec_GiaSplitClean( vStack );
+    // the workers take the cofactors while the calling thread waits
+    memset( pMan, 0, sizeof(Cec_SplitMan_t) );
+    pMan->pGia         = p;
+    pMan->pPool        = Util_PoolStart( nProcs );
+    pMan->nTimeOut     = nTimeOut;
+    pMan->nIterMax     = nIterMax;
+    pMan->LookAhead    = LookAhead;
+    pMan->fVerbose     = fVerbose;
+    pMan->fVeryVerbose = fVeryVerbose;
+    pMan->clkTotal     = clkTotal;
+    pthread_mutex_init( &pMan->Mutex, NULL );
+    Cec_GiaSplitSpawn( pMan, Gia_ManDup(p), 1 );
+    Util_PoolWaitIdle( pMan->pPool );
+    Util_PoolStop( pMan->pPool );
+    pthread_mutex_destroy( &pMan->Mutex );
+    RetValue = pMan->fSat ? 0 : (pMan->fUndec ? -1 : 1);
 	if ( !fSilent )
 	{
 		if ( RetValue == 0 )
@@ -731,8 +701,8 @@ finish:
 		else if ( RetValue == -1 )
 			printf( "Problem is UNDECIDED " );
 		else assert( 0 );
-		printf( "after %d case-splits.  ", nIter );
-		Abc_PrintTime( 1, "Time", Abc_Clock() - clkTotal );
+		printf( "after %d case-splits.  ", pMan->nIter );
+		Abc_PrintTime( 1, "Time", Abc_ClockWall() - clkTotal );
 		fflush( stdout );
 	}
     return RetValue;
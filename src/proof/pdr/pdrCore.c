@@ -59,6 +59,7 @@ void Pdr_ManSetDefaultParams( Pdr_Par_t * pPars )
     pPars->nConfGenLimit  =       0;  // limit on SAT solver conflicts during generalization
     pPars->nRestLimit     =       0;  // limit on the number of proof-obligations
     pPars->nRandomSeed   = 91648253;  // value to seed the SAT solver with
+    pPars->nThreads       =       1;  // the number of concurrent workers
     pPars->fTwoRounds     =       0;  // use two rounds for generalization
     pPars->fMonoCnf       =       0;  // monolythic CNF
     pPars->fNewXSim       =       0;  // updated X-valued simulation
@@ -154,6 +155,9 @@ int Pdr_ManPushClauses( Pdr_Man_t * p )
     int Counter = 0;
     abctime clk = Abc_Clock();
     assert( p->iUseFrame > 0 );
+    // add the lemmas of the other workers and of the previous run, so that they are pushed too
+    if ( Pdr_ManImportReloaded( p, 0 ) == -1 || Pdr_ManShareImport( p ) == -1 )
+        return -1;
     Vec_VecForEachLevelStartStop( p->vClauses, vArrayK, k, iStartFrame, kMax )
     {
         Vec_PtrSort( vArrayK, (int (*)(void))Pdr_SetCompare );
@@ -205,6 +209,7 @@ int Pdr_ManPushClauses( Pdr_Man_t * p )
             }
             // add the last clause
             Vec_PtrPush( vArrayK1, pCubeK );
+            Pdr_ManShareExport( p, k+1, pCubeK );
             Vec_PtrWriteEntry( vArrayK, j, Vec_PtrEntryLast(vArrayK) );
             Vec_PtrPop(vArrayK);
             j--;
@@ -917,6 +922,8 @@ int Pdr_ManBlockCube( Pdr_Man_t * p, Pdr_Set_t * pCube )
             Pdr_QueueStop( p );
             return 1; // restart
         }
+        if ( Pdr_ManImportReloaded( p, 1 ) == -1 || Pdr_ManShareImport( p ) == -1 )
+            return -1;
         pThis = Pdr_QueuePop( p );
         assert( pThis->iFrame > 0 );
         assert( !Pdr_SetIsInit(pThis->pState, -1) );
@@ -985,6 +992,7 @@ int Pdr_ManBlockCube( Pdr_Man_t * p, Pdr_Set_t * pCube )
                     p->nAbsFlops++;
                 Vec_IntAddToEntry( p->vPrio, pCubeMin->Lits[i] / 2, 1 << p->nPrioShift );
             }
+            Pdr_ManShareExport( p, k, pCubeMin );
             Vec_VecPush( p->vClauses, k, pCubeMin );   // consume ref
             p->nCubes++;
             // add clause
@@ -1015,6 +1023,8 @@ int Pdr_ManBlockCube( Pdr_Man_t * p, Pdr_Set_t * pCube )
         // check termination
         if ( p->pPars->pFuncStop && p->pPars->pFuncStop(p->pPars->RunId) )
             return -1;
+        if ( Pdr_ManShareIsStopped(p) )
+            return -1;
         if ( p->timeToStop && Abc_Clock() > p->timeToStop )
             return -1;
         if ( p->timeToStopOne && Abc_Clock() > p->timeToStopOne )
@@ -1144,6 +1154,11 @@ int Pdr_ManSolveInt( Pdr_Man_t * p )
                 RetValue = Pdr_ManCheckCube( p, iFrame, NULL, &pCube, p->pPars->nConfLimit, 0, 1 );
                 if ( RetValue == 1 )
                     break;
+                if ( RetValue == -1 && Pdr_ManShareIsStopped(p) )
+                {
+                    p->pPars->iFrame = iFrame;
+                    return -1;
+                }
                 if ( RetValue == -1 )
                 {
                     if ( p->pPars->fVerbose )
@@ -1168,6 +1183,11 @@ int Pdr_ManSolveInt( Pdr_Man_t * p )
                 if ( RetValue == 0 )
                 {
                     RetValue = Pdr_ManBlockCube( p, pCube );
+                    if ( RetValue == -1 && Pdr_ManShareIsStopped(p) )
+                    {
+                        p->pPars->iFrame = iFrame;
+                        return -1;
+                    }
                     if ( RetValue == -1 )
                     {
                         if ( p->pPars->fVerbose )
@@ -1287,6 +1307,11 @@ int Pdr_ManSolveInt( Pdr_Man_t * p )
         }
         // push clauses into this timeframe
         RetValue = Pdr_ManPushClauses( p );
+        if ( RetValue == -1 && Pdr_ManShareIsStopped(p) )
+        {
+            p->pPars->iFrame = iFrame;
+            return -1;
+        }
         if ( RetValue == -1 )
         {
             if ( p->pPars->fVerbose )
@@ -1305,9 +1330,10 @@ int Pdr_ManSolveInt( Pdr_Man_t * p )
         {
             if ( p->pPars->fVerbose )
                 Pdr_ManPrintProgress( p, 1, Abc_Clock() - clkStart );
-            if ( !p->pPars->fSilent )
+            // in the parallel mode, the invariant is reported after the other workers stop
+            if ( !p->pPars->fSilent && !p->pShare )
                 Pdr_ManReportInvariant( p );
-            if ( !p->pPars->fSilent )
+            if ( !p->pPars->fSilent && !p->pShare )
                 Pdr_ManVerifyInvariant( p );
             p->pPars->iFrame = iFrame;
             // count the number of UNSAT outputs
@@ -1336,6 +1362,11 @@ int Pdr_ManSolveInt( Pdr_Man_t * p )
             p->pPars->iFrame = iFrame;
             return -1;
         }
+        if ( Pdr_ManShareIsStopped(p) )
+        {
+            p->pPars->iFrame = iFrame;
+            return -1;
+        }
         if ( p->timeToStop && Abc_Clock() > p->timeToStop )
         {
             if ( fPrintClauses )
@@ -1392,6 +1423,7 @@ int Pdr_ManSolveInt( Pdr_Man_t * p )
 int Pdr_ManSolve( Aig_Man_t * pAig, Pdr_Par_t * pPars )
 {
     Pdr_Man_t * p;
+    Vec_Int_t * vLemmas = NULL;
     int k, RetValue;
     abctime clk = Abc_Clock();
     if ( pPars->nTimeOutOne && !pPars->fSolveAll )
@@ -1412,8 +1444,17 @@ int Pdr_ManSolve( Aig_Man_t * pAig, Pdr_Par_t * pPars )
             pPars->fSolveAll ?    "yes" : "no" );
     }
     ABC_FREE( pAig->pSeqModel );
-    p = Pdr_ManStart( pAig, pPars, NULL );
-    RetValue = Pdr_ManSolveInt( p );
+    // the lemmas of the previous run are not used with abstraction
+    if ( pPars->pLemFile && !pPars->fUseAbs )
+        vLemmas = Pdr_ManReadLemmas( pAig, pPars->pLemFile, pPars->fVerbose );
+    if ( pPars->nThreads > 1 )
+        p = Pdr_ManSolvePar( pAig, pPars, vLemmas, &RetValue );
+    else
+    {
+        p = Pdr_ManStart( pAig, pPars, NULL );
+        p->vLemmas = vLemmas;
+        RetValue = Pdr_ManSolveInt( p );
+    }
     if ( RetValue == 0 )
         assert( pAig->pSeqModel != NULL || p->vCexes != NULL );
     if ( p->vCexes )
@@ -1430,6 +1471,8 @@ int Pdr_ManSolve( Aig_Man_t * pAig, Pdr_Par_t * pPars )
     }
     else if ( RetValue == 1 )
         Abc_FrameSetInv( Pdr_ManDeriveInfinityClauses( p, RetValue!=1 ) );
+    if ( pPars->pLemFile && !pPars->fUseAbs )
+        Pdr_ManWriteLemmas( p, pPars->pLemFile, RetValue==1 );
     p->tTotal += Abc_Clock() - clk;
     Pdr_ManStop( p );
     pPars->iFrame--;
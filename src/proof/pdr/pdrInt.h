@@ -55,6 +55,7 @@
     #define sat_solver_set_runtime_limit     satoko_set_runtime_limit
     #define sat_solver_set_runid             satoko_set_runid           
     #define sat_solver_set_stop_func         satoko_set_stop_func          
+    #define sat_solver_set_stop              satoko_set_stop
     #define sat_solver_compress(s)             
 #endif
 
@@ -71,6 +72,9 @@ ABC_NAMESPACE_HEADER_START
 typedef struct Txs_Man_t_  Txs_Man_t;
 typedef struct Txs3_Man_t_ Txs3_Man_t;
 
+// the database of lemmas shared by the workers of the parallel PDR
+typedef struct Pdr_Share_t_ Pdr_Share_t;
+
 typedef struct Pdr_Set_t_ Pdr_Set_t;
 struct Pdr_Set_t_
 {
@@ -140,6 +144,15 @@ struct Pdr_Man_t_
     Vec_Int_t * vRes;      // final result
     abctime *   pTime4Outs;// timeout per output
     Vec_Ptr_t * vInfCubes; // infinity clauses/cubes
+    // parallel solving
+    Pdr_Share_t * pShare;  // the shared lemmas
+    int         iWorker;   // the number of this worker
+    int         iShareRead;// the first shared lemma not imported yet
+    int         fOwnAig;   // the AIG is a copy owned by the manager
+    int         nShareExp; // the number of exported lemmas
+    int         nShareImp; // the number of imported lemmas
+    Vec_Int_t * vLemmas;   // the lemmas reloaded from file (in the format of the shared lemmas)
+    int         iLemmaFrame;// the last frame, in which the reloaded lemmas were added
     // statistics
     int         nBlocks;   // the number of times blockState was called
     int         nObligs;   // the number of proof obligations derived
@@ -202,11 +215,14 @@ extern int             Pdr_ManFreeVar( Pdr_Man_t * p, int k );
 extern sat_solver *    Pdr_ManNewSolver( sat_solver * pSat, Pdr_Man_t * p, int k, int fInit );
 /*=== pdrCore.c ==========================================================*/
 extern int             Pdr_ManCheckContainment( Pdr_Man_t * p, int k, Pdr_Set_t * pSet );
+extern int             Pdr_ManSolveInt( Pdr_Man_t * p );
 /*=== pdrInv.c ==========================================================*/
 extern Vec_Int_t *     Pdr_ManCountFlopsInv( Pdr_Man_t * p );
 extern void            Pdr_ManPrintProgress( Pdr_Man_t * p, int fClose, abctime Time );
 extern void            Pdr_ManPrintClauses( Pdr_Man_t * p, int kStart );
 extern void            Pdr_ManDumpClauses( Pdr_Man_t * p, char * pFileName, int fProved );
+extern void            Pdr_ManWriteLemmas( Pdr_Man_t * p, char * pFileName, int fProved );
+extern Vec_Int_t *     Pdr_ManReadLemmas( Aig_Man_t * pAig, char * pFileName, int fVerbose );
 extern Vec_Str_t *     Pdr_ManDumpString( Pdr_Man_t * p );
 extern void            Pdr_ManReportInvariant( Pdr_Man_t * p );
 extern void            Pdr_ManVerifyInvariant( Pdr_Man_t * p );
@@ -216,6 +232,13 @@ extern Pdr_Man_t *     Pdr_ManStart( Aig_Man_t * pAig, Pdr_Par_t * pPars, Vec_In
 extern void            Pdr_ManStop( Pdr_Man_t * p );
 extern Abc_Cex_t *     Pdr_ManDeriveCex( Pdr_Man_t * p );
 extern Abc_Cex_t *     Pdr_ManDeriveCexAbs( Pdr_Man_t * p );
+/*=== pdrPar.c ==========================================================*/
+extern int             Pdr_ManShareIsStopped( Pdr_Man_t * p );
+extern int *           Pdr_ManShareStopFlag( Pdr_Man_t * p );
+extern void            Pdr_ManShareExport( Pdr_Man_t * p, int k, Pdr_Set_t * pCube );
+extern int             Pdr_ManShareImport( Pdr_Man_t * p );
+extern int             Pdr_ManImportReloaded( Pdr_Man_t * p, int fBounded );
+extern Pdr_Man_t *     Pdr_ManSolvePar( Aig_Man_t * pAig, Pdr_Par_t * pPars, Vec_Int_t * vLemmas, int * pRetValue );
 /*=== pdrSat.c ==========================================================*/
 extern sat_solver *    Pdr_ManCreateSolver( Pdr_Man_t * p, int k );
 extern sat_solver *    Pdr_ManFetchSolver( Pdr_Man_t * p, int k );
@@ -22,6 +22,7 @@
 #include "base/abc/abc.h"      // for Abc_NtkCollectCioNames()
 #include "base/main/main.h"    // for Abc_FrameReadGlobalFrame()
 #include "aig/ioa/ioa.h"
+#include "misc/util/utilNam.h"
 
 ABC_NAMESPACE_IMPL_START
 
@@ -421,6 +422,224 @@ void Pdr_ManDumpClauses( Pdr_Man_t * p, char * pFileName, int fProved )
         Abc_Print( 1, "Clauses of the last timeframe were written into file \"%s\".\n", pFileName );
 }
 
+/**Function*************************************************************
+
+  Synopsis    [Returns the names of the flops of the current network.]
+
+  Description [Returns NULL if the current network does not match the AIG.]
+               
+  SideEffects []
+
+  SeeAlso     [] 
+
+***********************************************************************/
+static char ** Pdr_ManCollectCiNames( Aig_Man_t * pAig )
+{
+    Abc_Ntk_t * pNtk = Abc_FrameReadNtk( Abc_FrameReadGlobalFrame() );
+    if ( pNtk == NULL || Abc_NtkPiNum(pNtk) != Saig_ManPiNum(pAig) || Abc_NtkLatchNum(pNtk) != Saig_ManRegNum(pAig) )
+        return NULL;
+    return Abc_NtkCollectCioNames( pNtk, 0 );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Writes the frame lemmas into a file.]
+
+  Description [The lemmas are tied to the names of the flops, so that
+  they can be reloaded after the design is changed. The file lists the
+  names of the flops used in the lemmas, followed by the lemmas. Each 
+  lemma is given by its frame, the number of literals, and the literals
+  of the cube, which refer to the flops in the list (2*i+c for flop i 
+  and complement c). The lemmas of the inductive invariant are written
+  first, with frame 0 (infinity), followed by the lemmas of the other 
+  frames in the decreasing order of frames.]
+               
+  SideEffects []
+
+  SeeAlso     [] 
+
+***********************************************************************/
+void Pdr_ManWriteLemmas( Pdr_Man_t * p, char * pFileName, int fProved )
+{
+    FILE * pFile;
+    Vec_Int_t * vFlops, * vMap;
+    Vec_Ptr_t * vArrayK;
+    Pdr_Set_t * pCube;
+    char ** pNamesCi;
+    int i, k, m, kStart, Count = 0;
+    pNamesCi = Pdr_ManCollectCiNames( p->pAig );
+    if ( pNamesCi == NULL )
+    {
+        Abc_Print( 1, "Cannot write lemmas because the flop names are not available.\n" );
+        return;
+    }
+    pFile = fopen( pFileName, "w" );
+    if ( pFile == NULL )
+    {
+        Abc_Print( 1, "Cannot open file \"%s\" for writing lemmas.\n", pFileName );
+        ABC_FREE( pNamesCi );
+        return;
+    }
+    // collect the flops used in the lemmas
+    vFlops = Vec_IntAlloc( 100 );
+    vMap   = Vec_IntStartFull( Aig_ManRegNum(p->pAig) );
+    Vec_VecForEachLevelStart( p->vClauses, vArrayK, k, 1 )
+        Vec_PtrForEachEntry( Pdr_Set_t *, vArrayK, pCube, i )
+        {
+            if ( pCube->nRefs == -1 )
+                continue;
+            for ( m = 0; m < pCube->nLits; m++ )
+                if ( Vec_IntEntry(vMap, Abc_Lit2Var(pCube->Lits[m])) == -1 )
+                {
+                    Vec_IntWriteEntry( vMap, Abc_Lit2Var(pCube->Lits[m]), Vec_IntSize(vFlops) );
+                    Vec_IntPush( vFlops, Abc_Lit2Var(pCube->Lits[m]) );
+                }
+            Count++;
+        }
+    // write the flops and the lemmas
+    kStart = fProved ? Pdr_ManFindInvariantStart( p ) : ABC_INFINITY;
+    fprintf( pFile, "# Frame lemmas for \"%s\"\n", p->pAig->pName );
+    fprintf( pFile, "# generated by PDR in ABC on %s\n", Aig_TimeStamp() );
+    fprintf( pFile, ".flops %d\n", Vec_IntSize(vFlops) );
+    Vec_IntForEachEntry( vFlops, k, i )
+        fprintf( pFile, "%s\n", pNamesCi[Saig_ManPiNum(p->pAig) + k] );
+    fprintf( pFile, ".lemmas %d\n", Count );
+    Vec_VecForEachLevelReverseStartStop( p->vClauses, vArrayK, k, Vec_VecSize(p->vClauses), 1 )
+        Vec_PtrForEachEntry( Pdr_Set_t *, vArrayK, pCube, i )
+        {
+            if ( pCube->nRefs == -1 )
+                continue;
+            fprintf( pFile, "%d %d", k >= kStart ? 0 : k, pCube->nLits );
+            for ( m = 0; m < pCube->nLits; m++ )
+                fprintf( pFile, " %d", Abc_Lit2LitV(Vec_IntArray(vMap), pCube->Lits[m]) );
+            fprintf( pFile, "\n" );
+        }
+    fprintf( pFile, ".e\n\n" );
+    fclose( pFile );
+    if ( p->pPars->fVerbose )
+        Abc_Print( 1, "Written %d lemmas over %d flops into file \"%s\".\n", Count, Vec_IntSize(vFlops), pFileName );
+    ABC_FREE( pNamesCi );
+    Vec_IntFree( vFlops );
+    Vec_IntFree( vMap );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Reads the frame lemmas written by Pdr_ManWriteLemmas().]
+
+  Description [The flops are matched with the flops of the AIG by name.
+  The lemmas with the flops that are not found are dropped. The other
+  lemmas are returned in the format of the shared lemmas, which is the 
+  worker (-1), the frame, the number of literals, and the literals.
+  They are validated by SAT when they are added to the frames. Returns
+  NULL if the file does not exist or cannot be used.]
+               
+  SideEffects []
+
+  SeeAlso     [] 
+
+***********************************************************************/
+Vec_Int_t * Pdr_ManReadLemmas( Aig_Man_t * pAig, char * pFileName, int fVerbose )
+{
+    Abc_Nam_t * pNam;
+    Vec_Int_t * vId2Flop, * vMap, * vLemmas = NULL;
+    char ** pNamesCi, * pContents, * pToken, * pTemp;
+    int i, k, Frame, nLits, nFlops, nLemmas, fFound, fMissing, nDropped = 0;
+    pContents = Extra_FileReadContents( pFileName );
+    if ( pContents == NULL )
+    {
+        if ( fVerbose )
+            Abc_Print( 1, "Lemma file \"%s\" does not exist. Starting from scratch.\n", pFileName );
+        return NULL;
+    }
+    pNamesCi = Pdr_ManCollectCiNames( pAig );
+    if ( pNamesCi == NULL )
+    {
+        Abc_Print( 1, "Cannot read lemmas because the flop names are not available.\n" );
+        ABC_FREE( pContents );
+        return NULL;
+    }
+    // hash the names of the flops (the flops with the same name are not used)
+    pNam = Abc_NamStart( Saig_ManRegNum(pAig), 16 );
+    vId2Flop = Vec_IntStartFull( Saig_ManRegNum(pAig) + 1 );
+    for ( i = 0; i < Saig_ManRegNum(pAig); i++ )
+    {
+        k = Abc_NamStrFindOrAdd( pNam, pNamesCi[Saig_ManPiNum(pAig) + i], &fFound );
+        if ( fFound ) // unmap the name, including the first flop that had it
+            Vec_IntWriteEntry( vId2Flop, k, -1 );
+        else
+            Vec_IntWriteEntry( vId2Flop, k, i );
+    }
+    // skip the comments
+    for ( pTemp = pContents; *pTemp; pTemp++ )
+        if ( *pTemp == '#' )
+            while ( *pTemp && *pTemp != '\n' )
+                *pTemp++ = ' ';
+    // map the flops of the file
+    pToken = strtok( pContents, " \t\r\n" );
+    if ( pToken == NULL || strcmp(pToken, ".flops") || (pToken = strtok(NULL, " \t\r\n")) == NULL )
+        goto finish;
+    nFlops = atoi( pToken );
+    if ( nFlops < 0 )
+        goto finish;
+    vMap = Vec_IntAlloc( 2 * nFlops );
+    for ( i = 0; i < nFlops && (pToken = strtok(NULL, " \t\r\n")); i++ )
+    {
+        k = Vec_IntEntry( vId2Flop, Abc_NamStrFind(pNam, pToken) );
+        Vec_IntPush( vMap, k == -1 ? -1 : Abc_Var2Lit(k, 0) );
+        Vec_IntPush( vMap, k == -1 ? -1 : Abc_Var2Lit(k, 1) );
+    }
+    // read the lemmas
+    pToken = strtok( NULL, " \t\r\n" );
+    if ( pToken == NULL || strcmp(pToken, ".lemmas") || (pToken = strtok(NULL, " \t\r\n")) == NULL )
+    {
+        Vec_IntFree( vMap );
+        goto finish;
+    }
+    nLemmas = atoi( pToken );
+    vLemmas = Vec_IntAlloc( 1000 );
+    for ( i = 0; i < nLemmas; i++ )
+    {
+        if ( (pToken = strtok(NULL, " \t\r\n")) == NULL )
+            break;
+        Frame = atoi( pToken );
+        if ( (pToken = strtok(NULL, " \t\r\n")) == NULL )
+            break;
+        nLits = atoi( pToken );
+        if ( nLits < 0 || nLits > nFlops ) // the file is corrupted
+        {
+            Abc_Print( 1, "Lemma %d in file \"%s\" has %d literals. Skipping the remaining lemmas.\n", i, pFileName, nLits );
+            break;
+        }
+        Vec_IntPush( vLemmas, -1 );
+        Vec_IntPush( vLemmas, Frame ? Frame : ABC_INFINITY );
+        Vec_IntPush( vLemmas, nLits );
+        for ( fMissing = k = 0; k < nLits && (pToken = strtok(NULL, " \t\r\n")); k++ )
+        {
+            int Lit = atoi( pToken );
+            Lit = (Lit >= 0 && Lit < Vec_IntSize(vMap)) ? Vec_IntEntry(vMap, Lit) : -1;
+            fMissing |= (int)(Lit == -1);
+            Vec_IntPush( vLemmas, Lit );
+        }
+        if ( k < nLits || fMissing || nLits == 0 || nLits > Saig_ManRegNum(pAig) )
+        {
+            Vec_IntShrink( vLemmas, Vec_IntSize(vLemmas) - 3 - k );
+            nDropped++;
+        }
+    }
+    Vec_IntFree( vMap );
+    if ( fVerbose )
+        Abc_Print( 1, "Read %d lemmas from file \"%s\" (%d lemmas with unknown flops are dropped).\n", i - nDropped, pFileName, nDropped );
+finish:
+    if ( vLemmas == NULL )
+        Abc_Print( 1, "Cannot read lemmas from file \"%s\".\n", pFileName );
+    Abc_NamStop( pNam );
+    Vec_IntFree( vId2Flop );
+    ABC_FREE( pNamesCi );
+    ABC_FREE( pContents );
+    return vLemmas;
+}
+
 /**Function*************************************************************
 
   Synopsis    []
@@ -480,7 +699,7 @@ void Pdr_ManReportInvariant( Pdr_Man_t * p )
     int kStart = Pdr_ManFindInvariantStart( p );
     vCubes = Pdr_ManCollectCubes( p, kStart );
     Abc_Print( 1, "Invariant F[%d] : %d clauses with %d flops (out of %d) (cex = %d, ave = %.2f)\n", 
-        kStart, Vec_PtrSize(vCubes), Pdr_ManCountVariables(p, kStart), Aig_ManRegNum(p->pAig), p->nCexesTotal, 1.0*p->nXsimLits/p->nXsimRuns );
+        kStart, Vec_PtrSize(vCubes), Pdr_ManCountVariables(p, kStart), Aig_ManRegNum(p->pAig), p->nCexesTotal, p->nXsimRuns ? 1.0*p->nXsimLits/p->nXsimRuns : 0.0 );
 //    Abc_Print( 1, "Invariant F[%d] : %d clauses with %d flops (out of %d)\n", 
 //        kStart, Vec_PtrSize(vCubes), Pdr_ManCountVariables(p, kStart), Aig_ManRegNum(p->pAig) );
     Vec_PtrFree( vCubes );
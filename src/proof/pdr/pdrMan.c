@@ -134,7 +134,7 @@ Vec_Int_t * Pdr_ManDeriveFlopPriorities3( Gia_Man_t * p, int fMuxCtrls )
     assert( MaxEntry == Gia_ManRegNum(p) );
     Vec_WecFree( vLevels );
     Vec_IntFree( vCosts );
-    ABC_FREE( p->pRefs );
+    Gia_ManAuxIntFreeP( p, &p->pRefs );
 //Vec_IntPrint( vRes );
     return vRes;
 }
@@ -181,7 +181,7 @@ Vec_Int_t * Pdr_ManDeriveFlopPriorities2( Gia_Man_t * p, int fMuxCtrls )
         MaxEntry = Abc_MaxInt( MaxEntry, Gia_ObjRefNum(p, pObj) );
     }
     MaxEntry++;
-    ABC_FREE( p->pRefs );
+    Gia_ManAuxIntFreeP( p, &p->pRefs );
     // add costs due to MUX inputs
     if ( fMuxCtrls )
     {
@@ -383,6 +383,7 @@ void Pdr_ManStop( Pdr_Man_t * p )
     Vec_IntFree( p->vCi2Rem   );  // CIs to be removed
     Vec_IntFree( p->vRes      );  // final result
     Vec_PtrFreeP( &p->vInfCubes );
+    Vec_IntFreeP( &p->vLemmas );
     ABC_FREE( p->pTime4Outs );
     if ( p->vCexes )
         Vec_PtrFreeFree( p->vCexes );
@@ -391,6 +392,8 @@ void Pdr_ManStop( Pdr_Man_t * p )
         Aig_ManFanoutStop( p->pAig );
     if ( p->pAig->pTerSimData != NULL )
         ABC_FREE( p->pAig->pTerSimData );
+    if ( p->fOwnAig )
+        Aig_ManStop( p->pAig );
     ABC_FREE( p );
 }
 
@@ -0,0 +1,499 @@
+/**CFile****************************************************************
+
+  FileName    [pdrPar.c]
+
+  SystemName  [ABC: Logic synthesis and verification system.]
+
+  PackageName [Property driven reachability.]
+
+  Synopsis    [Parallel PDR with the shared database of frame lemmas.]
+
+  Author      [Alan Mishchenko]
+
+  Affiliation [UC Berkeley]
+
+  Date        [Ver. 1.0. Started - November 20, 2010.]
+
+  Revision    [$Id: pdrPar.c,v 1.00 2010/11/20 00:00:00 alanmi Exp $]
+
+***********************************************************************/
+
+#include "pdrInt.h"
+#include "misc/util/utilTask.h"
+
+#ifdef ABC_USE_PTHREADS
+
+#ifdef _WIN32
+#include "../lib/pthread.h"
+#else
+#include <pthread.h>
+#include <unistd.h>
+#endif
+
+#endif
+
+ABC_NAMESPACE_IMPL_START
+
+
+////////////////////////////////////////////////////////////////////////
+///                        DECLARATIONS                              ///
+////////////////////////////////////////////////////////////////////////
+
+#define PDR_PAR_MAX    64        // the max number of workers
+
+// The lemmas are stored one after another as the worker number,
+// the frame number, the number of literals, and the literals.
+// The workers append the lemmas and read them starting from the
+// position, up to which they have already read.
+struct Pdr_Share_t_
+{
+#ifdef ABC_USE_PTHREADS
+    pthread_mutex_t   Mutex;     // protects the lemmas
+#endif
+    Vec_Int_t *       vData;     // the lemmas
+    volatile int      nData;     // the size of the lemma data
+    volatile int      fStop;     // the flag to stop the workers
+    volatile int      iWinner;   // the worker that solved the problem
+};
+
+typedef struct Pdr_ParWorker_t_ Pdr_ParWorker_t;
+struct Pdr_ParWorker_t_
+{
+    Pdr_Man_t *       pMan;      // the PDR manager
+    Pdr_Par_t         Pars;      // the parameters of this worker
+    int               RetValue;  // the result
+};
+
+////////////////////////////////////////////////////////////////////////
+///                     FUNCTION DEFINITIONS                         ///
+////////////////////////////////////////////////////////////////////////
+
+/**Function*************************************************************
+
+  Synopsis    [Starts and stops the lemma database.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static Pdr_Share_t * Pdr_ShareStart()
+{
+    Pdr_Share_t * p = ABC_CALLOC( Pdr_Share_t, 1 );
+#ifdef ABC_USE_PTHREADS
+    pthread_mutex_init( &p->Mutex, NULL );
+#endif
+    p->vData   = Vec_IntAlloc( 1 << 12 );
+    p->iWinner = -1;
+    return p;
+}
+static void Pdr_ShareStop( Pdr_Share_t * p )
+{
+#ifdef ABC_USE_PTHREADS
+    pthread_mutex_destroy( &p->Mutex );
+#endif
+    Vec_IntFree( p->vData );
+    ABC_FREE( p );
+}
+static inline void Pdr_ShareLock( Pdr_Share_t * p )
+{
+#ifdef ABC_USE_PTHREADS
+    pthread_mutex_lock( &p->Mutex );
+#endif
+}
+static inline void Pdr_ShareUnlock( Pdr_Share_t * p )
+{
+#ifdef ABC_USE_PTHREADS
+    pthread_mutex_unlock( &p->Mutex );
+#endif
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Records the worker that solved the problem.]
+
+  Description [Returns 1 if this worker is the first one to finish.
+  The other workers are stopped.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static int Pdr_ShareSetWinner( Pdr_Share_t * p, int iWorker )
+{
+    int fFirst = 0;
+    Pdr_ShareLock( p );
+    if ( p->iWinner == -1 )
+    {
+        p->iWinner = iWorker;
+        fFirst = 1;
+    }
+    p->fStop = 1;
+    Pdr_ShareUnlock( p );
+    return fFirst;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Returns 1 if the worker should stop.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Pdr_ManShareIsStopped( Pdr_Man_t * p )
+{
+    return p->pShare && p->pShare->fStop;
+}
+int * Pdr_ManShareStopFlag( Pdr_Man_t * p )
+{
+    return p->pShare ? (int *)&p->pShare->fStop : NULL;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Publishes the lemma added to the given frame.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Pdr_ManShareExport( Pdr_Man_t * p, int k, Pdr_Set_t * pCube )
+{
+    Pdr_Share_t * pShare = p->pShare;
+    if ( pShare == NULL )
+        return;
+    Pdr_ShareLock( pShare );
+    Vec_IntPush( pShare->vData, p->iWorker );
+    Vec_IntPush( pShare->vData, k );
+    Vec_IntPush( pShare->vData, pCube->nLits );
+    Vec_IntPushArray( pShare->vData, pCube->Lits, pCube->nLits );
+    pShare->nData = Vec_IntSize( pShare->vData );
+    Pdr_ShareUnlock( pShare );
+    p->nShareExp++;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Adds the lemmas derived elsewhere to the frames.]
+
+  Description [A lemma derived by another worker, or by an earlier run,
+  cannot be added to the frames as it is, because the frames of this 
+  worker may be weaker. The lemma is added to the highest frame, in which
+  it is inductive relative to the previous frame, which is checked in the
+  same way as when this worker derives its own lemmas. The lemmas already
+  subsumed by the clauses of this worker are skipped. Returns the number 
+  of the imported lemmas, or -1 if the resource limit is reached.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static int Pdr_ManImportLemmas( Pdr_Man_t * p, Vec_Int_t * vData )
+{
+    Vec_Int_t * vLits, * vPiLits;
+    Pdr_Set_t * pCube;
+    int i, k, m, nLits, kMax, RetValue = 0, Counter = 0;
+    vLits   = Vec_IntAlloc( 100 );
+    vPiLits = Vec_IntAlloc( 0 );
+    kMax    = Vec_PtrSize(p->vSolvers)-1;
+    for ( i = 0; i < Vec_IntSize(vData); i += 3 + nLits )
+    {
+        nLits = Vec_IntEntry( vData, i+2 );
+        if ( Vec_IntEntry(vData, i) == p->iWorker )
+            continue;
+        Vec_IntClear( vLits );
+        Vec_IntPushArray( vLits, Vec_IntEntryP(vData, i+3), nLits );
+        pCube = Pdr_SetCreate( vLits, vPiLits );
+        k = Abc_MinInt( Vec_IntEntry(vData, i+1), kMax );
+        if ( k < 1 || Pdr_SetIsInit(pCube, -1) || Pdr_ManCheckContainment(p, k, pCube) )
+        {
+            Pdr_SetDeref( pCube );
+            continue;
+        }
+        for ( ; k > 0; k-- )
+        {
+            RetValue = Pdr_ManCheckCube( p, k-1, pCube, NULL, 0, 0, 1 );
+            if ( RetValue != 0 ) // blocked or resource limit
+                break;
+        }
+        if ( RetValue == -1 || k == 0 )
+        {
+            Pdr_SetDeref( pCube );
+            if ( RetValue == -1 )
+                break;
+            continue;
+        }
+        // the cube is blocked in frame k
+        for ( m = 1; m <= k; m++ )
+            Pdr_ManSolverAddClause( p, m, pCube );
+        Vec_VecPush( p->vClauses, k, pCube );   // consume ref
+        Counter++;
+    }
+    Vec_IntFree( vLits );
+    Vec_IntFree( vPiLits );
+    return RetValue == -1 ? -1 : Counter;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Adds the lemmas reloaded from file.]
+
+  Description [The lemmas of the inductive invariant are added when 
+  the first frame is created. If they still form an invariant, they are
+  pushed to the next frame, which leaves the first frame empty and proves
+  the property. The other lemmas are added only when the proof obligations
+  are blocked (fBounded is 1) in the frames, in which they were derived, 
+  or later. Returns the number of the imported lemmas, or -1 if the 
+  resource limit is reached.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Pdr_ManImportReloaded( Pdr_Man_t * p, int fBounded )
+{
+    Vec_Int_t * vReady, * vLeft;
+    int i, Frame, nLits, nReady = 0, RetValue, kMax = Vec_PtrSize(p->vSolvers)-1;
+    abctime clk = Abc_Clock();
+    if ( p->vLemmas == NULL || kMax < 1 || kMax == p->iLemmaFrame || (!fBounded && p->iLemmaFrame > 0) )
+        return 0;
+    p->iLemmaFrame = kMax;
+    vReady = Vec_IntAlloc( 100 );
+    vLeft  = Vec_IntAlloc( Vec_IntSize(p->vLemmas) );
+    for ( i = 0; i < Vec_IntSize(p->vLemmas); i += 3 + nLits )
+    {
+        Frame = Vec_IntEntry( p->vLemmas, i+1 );
+        nLits = Vec_IntEntry( p->vLemmas, i+2 );
+        if ( Frame == ABC_INFINITY || (fBounded && Frame <= kMax) )
+        {
+            Vec_IntPushArray( vReady, Vec_IntEntryP(p->vLemmas, i), 3 + nLits );
+            nReady++;
+        }
+        else
+            Vec_IntPushArray( vLeft, Vec_IntEntryP(p->vLemmas, i), 3 + nLits );
+    }
+    Vec_IntFree( p->vLemmas );
+    p->vLemmas = vLeft;
+    if ( Vec_IntSize(vLeft) == 0 )
+        Vec_IntFreeP( &p->vLemmas );
+    RetValue = Pdr_ManImportLemmas( p, vReady );
+    Vec_IntFree( vReady );
+    if ( p->pPars->fVerbose && nReady )
+    {
+        Abc_Print( 1, "Added %d out of %d reloaded lemmas in frame %d.  ", Abc_MaxInt(RetValue, 0), nReady, kMax );
+        Abc_PrintTime( 1, "Time", Abc_Clock() - clk );
+    }
+    return RetValue;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Adds the lemmas published by the other workers.]
+
+  Description [Returns the number of the imported lemmas, or -1 if 
+  the resource limit is reached.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Pdr_ManShareImport( Pdr_Man_t * p )
+{
+    Pdr_Share_t * pShare = p->pShare;
+    Vec_Int_t * vData;
+    int RetValue;
+    if ( pShare == NULL || p->iShareRead == pShare->nData )
+        return 0;
+    // copy the new lemmas
+    Pdr_ShareLock( pShare );
+    vData = Vec_IntAlloc( Vec_IntSize(pShare->vData) - p->iShareRead );
+    Vec_IntPushArray( vData, Vec_IntEntryP(pShare->vData, p->iShareRead), Vec_IntSize(pShare->vData) - p->iShareRead );
+    p->iShareRead = Vec_IntSize( pShare->vData );
+    Pdr_ShareUnlock( pShare );
+    // add them to the frames
+    RetValue = Pdr_ManImportLemmas( p, vData );
+    Vec_IntFree( vData );
+    if ( RetValue > 0 )
+        p->nShareImp += RetValue;
+    return RetValue;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Sets the parameters of the worker.]
+
+  Description [The first worker uses the user's parameters. The other
+  workers are silent and differ in the random seed and in the way the
+  proof obligations are generalized.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static void Pdr_ManSetWorkerParams( Pdr_Par_t * pNew, Pdr_Par_t * pPars, int iWorker )
+{
+    *pNew = *pPars;
+    if ( iWorker == 0 )
+        return;
+    pNew->nRandomSeed  = pPars->nRandomSeed + 7919 * iWorker;
+    pNew->nRecycle     = pPars->nRecycle * (1 + iWorker / 4);
+    pNew->fDumpInv     = 0;
+    pNew->fVerbose     = 0;
+    pNew->fVeryVerbose = 0;
+    pNew->fNotVerbose  = 1;
+    pNew->fSilent      = 1;
+    pNew->pFuncStop    = NULL;
+    if ( iWorker % 4 == 1 )
+        pNew->fTwoRounds ^= 1;
+    else if ( iWorker % 4 == 2 )
+        pNew->fSkipDown ^= 1;
+    else if ( iWorker % 4 == 3 )
+        pNew->fFlopOrder ^= 1;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Runs one worker.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static void * Pdr_ManSolveParTask( void * pArg )
+{
+    Pdr_ParWorker_t * pWorker = (Pdr_ParWorker_t *)pArg;
+    Pdr_Man_t * p = pWorker->pMan;
+    pWorker->RetValue = Pdr_ManSolveInt( p );
+    // the first worker stops the others also when it gives up
+    if ( pWorker->RetValue != -1 || p->iWorker == 0 )
+        Pdr_ShareSetWinner( p->pShare, p->iWorker );
+    return NULL;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Solves the problem using several workers.]
+
+  Description [Each worker runs PDR with its own parameters on its own
+  copy of the AIG. The lemmas derived by each worker, as well as the
+  lemmas pushed to the next frame, are published in the shared database
+  and imported by the other workers when they block proof obligations
+  and before they push the clauses. The first worker that proves the
+  property or finds a counter-example stops the other workers. Returns
+  the manager of the worker that solved the problem (or the first worker
+  if the problem is not solved) and its result. This manager is used
+  by the caller in the same way as the manager of the serial PDR.
+  The lemmas reloaded from file, if given, are added by each worker.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Pdr_Man_t * Pdr_ManSolvePar( Aig_Man_t * pAig, Pdr_Par_t * pPars, Vec_Int_t * vLemmas, int * pRetValue )
+{
+    Pdr_Share_t * pShare;
+    Pdr_ParWorker_t * pWorkers;
+    Util_Pool_t * pPool;
+    Pdr_Man_t * p;
+    int i, iWinner, nWorkers = Abc_MinInt( pPars->nThreads, PDR_PAR_MAX );
+    // the parallel solving is not used in the multi-output mode and with abstraction
+    if ( nWorkers < 2 || pPars->fSolveAll || pPars->fUseAbs || pPars->fUseBridge || pPars->nTimeOutOne || pPars->pFuncOnFail )
+    {
+        p = Pdr_ManStart( pAig, pPars, NULL );
+        p->vLemmas = vLemmas;
+        *pRetValue = Pdr_ManSolveInt( p );
+        return p;
+    }
+    pShare   = Pdr_ShareStart();
+    pWorkers = ABC_CALLOC( Pdr_ParWorker_t, nWorkers );
+    for ( i = 0; i < nWorkers; i++ )
+    {
+        Pdr_ManSetWorkerParams( &pWorkers[i].Pars, pPars, i );
+        p = Pdr_ManStart( i ? Aig_ManDupSimple(pAig) : pAig, i ? &pWorkers[i].Pars : pPars, NULL );
+        p->pShare  = pShare;
+        p->iWorker = i;
+        p->fOwnAig = (int)(i > 0);
+        p->vLemmas = vLemmas ? Vec_IntDup( vLemmas ) : NULL;
+        pWorkers[i].pMan = p;
+    }
+    pPool = Util_PoolStart( nWorkers );
+    for ( i = 0; i < nWorkers; i++ )
+        Util_PoolSpawn( pPool, Pdr_ManSolveParTask, pWorkers + i );
+    Util_PoolWaitIdle( pPool );
+    Util_PoolStop( pPool );
+    Vec_IntFreeP( &vLemmas );
+    // find the winner
+    iWinner = pShare->iWinner >= 0 ? pShare->iWinner : 0;
+    if ( pWorkers[iWinner].RetValue == -1 )
+        iWinner = 0;
+    if ( pPars->fVerbose )
+    {
+        for ( i = 0; i < nWorkers; i++ )
+        {
+            p = pWorkers[i].pMan;
+            Abc_Print( 1, "Worker %2d : Frames =%4d  Clauses =%7d  Exported =%7d  Imported =%7d  Result = %s\n",
+                i, Vec_PtrSize(p->vSolvers), p->nCubes, p->nShareExp, p->nShareImp,
+                pWorkers[i].RetValue == 1 ? "UNSAT" : (pWorkers[i].RetValue == 0 ? "SAT" : "UNDEC") );
+        }
+        Abc_Print( 1, "The result is produced by worker %d.\n", iWinner );
+    }
+    // stop the other workers (the first one should not print its statistics)
+    pWorkers[0].Pars.fVerbose = 0;
+    for ( i = 0; i < nWorkers; i++ )
+        if ( i != iWinner )
+        {
+            pWorkers[i].pMan->pPars = &pWorkers[i].Pars;
+            Pdr_ManStop( pWorkers[i].pMan );
+        }
+    // transfer the results of the winner
+    p = pWorkers[iWinner].pMan;
+    p->pShare = NULL;
+    Pdr_ShareStop( pShare );
+    *pRetValue = pWorkers[iWinner].RetValue;
+    if ( iWinner > 0 )
+    {
+        pPars->iFrame     = p->pPars->iFrame;
+        pPars->nProveOuts = p->pPars->nProveOuts;
+        pPars->nFailOuts  = p->pPars->nFailOuts;
+        p->pPars = pPars;
+        if ( p->pAig->pSeqModel )
+        {
+            // the model may have been left by the first worker or an earlier run
+            ABC_FREE( pAig->pSeqModel );
+            pAig->pSeqModel = p->pAig->pSeqModel;
+            p->pAig->pSeqModel = NULL;
+        }
+    }
+    if ( *pRetValue == 1 && !pPars->fSilent )
+    {
+        Pdr_ManReportInvariant( p );
+        Pdr_ManVerifyInvariant( p );
+    }
+    ABC_FREE( pWorkers );
+    return p;
+}
+
+////////////////////////////////////////////////////////////////////////
+///                       END OF FILE                                ///
+////////////////////////////////////////////////////////////////////////
+
+
+ABC_NAMESPACE_IMPL_END
@@ -54,6 +54,8 @@ sat_solver * Pdr_ManCreateSolver( Pdr_Man_t * p, int k )
 //    pSat = sat_solver_new();
     pSat = zsat_solver_new_seed(p->pPars->nRandomSeed);
     pSat = Pdr_ManNewSolver( pSat, p, k, (int)(k == 0) );
+    if ( p->pShare )
+        sat_solver_set_stop( pSat, Pdr_ManShareStopFlag(p) );
     Vec_PtrPush( p->vSolvers, pSat );
     Vec_VecExpand( p->vClauses, k );
     Vec_IntPush( p->vActVars, 0 );
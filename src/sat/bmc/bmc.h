@@ -120,12 +120,14 @@ struct Bmc_AndPar_t_
     int         nTimeOut;       // timeout in seconds
     int         nLutSize;       // LUT size for cut computation
     int         nProcs;         // the number of parallel solvers
+    int         nFramesWin;     // the number of frames kept in the unfolding (0 = all)
     int         fLoadCnf;       // dynamic CNF loading
     int         fDumpFrames;    // dump unrolled timeframes
     int         fUseSynth;      // use synthesis
     int         fUseOldCnf;     // use old CNF construction
     int         fUseGlucose;    // use Glucose 3.0 as the default solver
     int         fUseEliminate;  // use variable elimination
+    char *      pSolvers;       // the SAT solvers used by the threads (comma-separated)
     int         fVerbose;       // verbose 
     int         fVeryVerbose;   // very verbose 
     int         fNotVerbose;    // skip line-by-line print-out 
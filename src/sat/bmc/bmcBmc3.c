@@ -21,8 +21,8 @@
 #include "proof/fra/fra.h"
 #include "sat/cnf/cnf.h"
 #include "sat/bsat/satStore.h"
+#include "sat/bsat/satIface.h"
 #include "sat/satoko/satoko.h"
-#include "sat/glucose/AbcGlucose.h"
 #include "misc/vec/vecHsh.h"
 #include "misc/vec/vecWec.h"
 #include "bmc.h"
@@ -62,8 +62,7 @@ struct Gia_ManBmc_t_
     int               nLitUseless; // useless literals
     // SAT solver
     sat_solver *      pSat;        // SAT solver
-    satoko_t *        pSat2;       // SAT solver
-    bmcg_sat_solver * pSat3;       // SAT solver
+    Sat_Iface_t *     pSat2;       // SAT solver used through the common interface
     int               nSatVars;    // SAT variables
     int               nObjNums;    // SAT objects
     int               nWordNum;    // unsigned words for ternary simulation
@@ -747,21 +746,11 @@ Gia_ManBmc_t * Saig_Bmc3ManStart( Aig_Man_t * pAig, int nTimeOutOne, int nConfLi
     p->vVisited = Vec_WecAlloc( 100 );
     // create solver
     p->nSatVars = 1;
-    if ( fUseSatoko )
+    if ( fUseSatoko || fUseGlucose )
     {
-        satoko_opts_t opts;
-        satoko_default_opts(&opts);
-        opts.conf_limit = nConfLimit;
-        p->pSat2 = satoko_create();  
-        satoko_configure(p->pSat2, &opts);
-        satoko_setnvars(p->pSat2, 1000);
-    }
-    else if ( fUseGlucose )
-    {
-        //opts.conf_limit = nConfLimit;
-        p->pSat3 = bmcg_sat_solver_start();  
-        for ( i = 0; i < 1000; i++ )
-            bmcg_sat_solver_addvar( p->pSat3 );
+        p->pSat2 = Sat_IfaceStart( fUseSatoko ? SAT_IFACE_SATOKO : SAT_IFACE_GLUCOSE );
+        Sat_IfaceSetConflictLimit( p->pSat2, nConfLimit );
+        Sat_IfaceSetVarNum( p->pSat2, 1000 );
     }
     else
     {
@@ -806,9 +795,9 @@ void Saig_Bmc3ManStop( Gia_ManBmc_t * p )
             p->pSat ? p->pSat->nLearntDelta     : 0, 
             p->pSat ? p->pSat->nLearntRatio     : 0, 
             p->pSat ? p->pSat->nDBreduces       : 0, 
-            p->pSat ? sat_solver_nvars(p->pSat) : p->pSat3 ? bmcg_sat_solver_varnum(p->pSat3) : satoko_varnum(p->pSat2), 
+            p->pSat ? sat_solver_nvars(p->pSat) : Sat_IfaceVarNum(p->pSat2), 
             nUsedVars, 
-            100.0*nUsedVars/(p->pSat ? sat_solver_nvars(p->pSat) : p->pSat3 ? bmcg_sat_solver_varnum(p->pSat3) : satoko_varnum(p->pSat2)) );
+            100.0*nUsedVars/(p->pSat ? sat_solver_nvars(p->pSat) : Sat_IfaceVarNum(p->pSat2)) );
         Abc_Print( 1, "Buffs = %d. Dups = %d.   Hash hits = %d.  Hash misses = %d.  UniProps = %d.\n", 
             p->nBufNum, p->nDupNum, p->nHashHit, p->nHashMiss, p->nUniProps );
     }
@@ -828,8 +817,7 @@ void Saig_Bmc3ManStop( Gia_ManBmc_t * p )
     Vec_VecFree( (Vec_Vec_t *)p->vId2Var );
     Vec_PtrFreeFree( p->vTerInfo );
     if ( p->pSat )  sat_solver_delete( p->pSat );
-    if ( p->pSat2 ) satoko_destroy( p->pSat2 );
-    if ( p->pSat3 ) bmcg_sat_solver_stop( p->pSat3 );
+    if ( p->pSat2 ) Sat_IfaceStop( p->pSat2 );
     ABC_FREE( p->pTime4Outs );
     Vec_IntFree( p->vData );
     Hsh_IntManStop( p->vHash );
@@ -1021,12 +1009,7 @@ static inline void Saig_ManBmcAddClauses( Gia_ManBmc_t * p, int uTruth, int Lits
             }
             if ( p->pSat2 )
             {
-                if ( !satoko_add_clause( p->pSat2, ClaLits, nClaLits ) )
-                    assert( 0 );
-            }
-            else if ( p->pSat3 )
-            {
-                if ( !bmcg_sat_solver_addclause( p->pSat3, ClaLits, nClaLits ) )
+                if ( !Sat_IfaceAddClause( p->pSat2, ClaLits, nClaLits ) )
                     assert( 0 );
             }
             else
@@ -1281,12 +1264,7 @@ int Saig_ManBmcCreateCnf( Gia_ManBmc_t * p, Aig_Obj_t * pObj, int iFrame )
     Lit = Saig_ManBmcLiteral( p, pObj, iFrame );
     // extend the SAT solver
     if ( p->pSat2 )
-        satoko_setnvars( p->pSat2, p->nSatVars );
-    else if ( p->pSat3 )
-    {
-        for ( i = bmcg_sat_solver_varnum(p->pSat3); i < p->nSatVars; i++ )
-            bmcg_sat_solver_addvar( p->pSat3 );
-    }
+        Sat_IfaceSetVarNum( p->pSat2, p->nSatVars );
     else
         sat_solver_setnvars( p->pSat, p->nSatVars );
     return Lit;
@@ -1401,12 +1379,7 @@ Abc_Cex_t * Saig_ManGenerateCex( Gia_ManBmc_t * p, int f, int i )
             int iLit = Saig_ManBmcLiteral( p, pObjPi, j );
             if ( p->pSat2 )
             {
-                if ( iLit != ~0 && satoko_read_cex_varvalue(p->pSat2, lit_var(iLit)) )
-                    Abc_InfoSetBit( pCex->pData, iBit + k );
-            }
-            else if ( p->pSat3 )
-            {
-                if ( iLit != ~0 && bmcg_sat_solver_read_cex_varvalue(p->pSat3, lit_var(iLit)) )
+                if ( iLit != ~0 && Sat_IfaceVarValue(p->pSat2, lit_var(iLit)) )
                     Abc_InfoSetBit( pCex->pData, iBit + k );
             }
             else
@@ -1437,12 +1410,7 @@ int Saig_ManCallSolver( Gia_ManBmc_t * p, int Lit )
     if ( Lit == 1 )
         return l_True;
     if ( p->pSat2 )
-        return satoko_solve_assumptions_limit( p->pSat2, &Lit, 1, p->pPars->nConfLimit );
-    else if ( p->pSat3 )
-    {
-        bmcg_sat_solver_set_conflict_budget( p->pSat3, p->pPars->nConfLimit );
-        return bmcg_sat_solver_solve( p->pSat3, &Lit, 1 );
-    }
+        return Sat_IfaceSolve( p->pSat2, &Lit, 1 );
     else
         return sat_solver_solve( p->pSat, &Lit, &Lit + 1, (ABC_INT64_T)p->pPars->nConfLimit, (ABC_INT64_T)0, (ABC_INT64_T)0, (ABC_INT64_T)0 );
 }
@@ -1492,15 +1460,10 @@ int Saig_ManBmcScalable( Aig_Man_t * pAig, Saig_ParBmc_t * pPars )
         p->pSat->RunId        = p->pPars->RunId;
         p->pSat->pFuncStop    = p->pPars->pFuncStop;
     }
-    else if ( p->pSat3 )
+    else if ( Sat_IfaceType(p->pSat2) == SAT_IFACE_SATOKO )
     {
-//        satoko_set_runid(p->pSat3, p->pPars->RunId);
-//        satoko_set_stop_func(p->pSat3, p->pPars->pFuncStop);
-    }
-    else
-    {
-        satoko_set_runid(p->pSat2, p->pPars->RunId);
-        satoko_set_stop_func(p->pSat2, p->pPars->pFuncStop);
+        satoko_set_runid((satoko_t *)Sat_IfaceSolver(p->pSat2), p->pPars->RunId);
+        satoko_set_stop_func((satoko_t *)Sat_IfaceSolver(p->pSat2), p->pPars->pFuncStop);
     }
     if ( pPars->fSolveAll && p->vCexes == NULL )
         p->vCexes = Vec_PtrStart( Saig_ManPoNum(pAig) );
@@ -1517,9 +1480,7 @@ int Saig_ManBmcScalable( Aig_Man_t * pAig, Saig_ParBmc_t * pPars )
     if ( nTimeToStop )
     {
         if ( p->pSat2 )
-            satoko_set_runtime_limit( p->pSat2, nTimeToStop );
-        else if ( p->pSat3 )
-            bmcg_sat_solver_set_runtime_limit( p->pSat3, nTimeToStop );
+            Sat_IfaceSetRuntimeLimit( p->pSat2, nTimeToStop );
         else
             sat_solver_set_runtime_limit( p->pSat, nTimeToStop );
     }
@@ -1650,9 +1611,7 @@ clkOther += Abc_Clock() - clk2;
                 assert( p->pTime4Outs[i] > 0 );
                 clkOne = Abc_Clock();
                 if ( p->pSat2 )
-                    satoko_set_runtime_limit( p->pSat2, p->pTime4Outs[i] + Abc_Clock() );
-                else if ( p->pSat3 )
-                    bmcg_sat_solver_set_runtime_limit( p->pSat3, p->pTime4Outs[i] + Abc_Clock() );
+                    Sat_IfaceSetRuntimeLimit( p->pSat2, p->pTime4Outs[i] + Abc_Clock() );
                 else
                     sat_solver_set_runtime_limit( p->pSat, p->pTime4Outs[i] + Abc_Clock() );
             }
@@ -1679,9 +1638,7 @@ nTimeUnsat += clkSatRun;
                     // add final unit clause
                     Lit = lit_neg( Lit );
                     if ( p->pSat2 )
-                        status = satoko_add_clause( p->pSat2, &Lit, 1 );
-                    else if ( p->pSat3 )
-                        status = bmcg_sat_solver_addclause( p->pSat3, &Lit, 1 );
+                        status = Sat_IfaceAddClause( p->pSat2, &Lit, 1 );
                     else
                         status = sat_solver_addclause( p->pSat, &Lit, &Lit + 1 );
                     assert( status );
@@ -1713,12 +1670,12 @@ nTimeSat += clkSatRun;
                     {
                         Abc_Print( 1, "%4d %s : ", f,  fUnfinished ? "-" : "+" );
                         Abc_Print( 1, "Var =%8.0f. ",  (double)p->nSatVars );
-                        Abc_Print( 1, "Cla =%9.0f. ",  (double)(p->pSat ? p->pSat->stats.clauses   : p->pSat3 ? bmcg_sat_solver_clausenum(p->pSat3)   : satoko_clausenum(p->pSat2)) );
-                        Abc_Print( 1, "Conf =%7.0f. ", (double)(p->pSat ? p->pSat->stats.conflicts : p->pSat3 ? bmcg_sat_solver_conflictnum(p->pSat3) : satoko_conflictnum(p->pSat2)) );
+                        Abc_Print( 1, "Cla =%9.0f. ",  (double)(p->pSat ? p->pSat->stats.clauses   : Sat_IfaceClauseNum(p->pSat2)) );
+                        Abc_Print( 1, "Conf =%7.0f. ", (double)(p->pSat ? p->pSat->stats.conflicts : Sat_IfaceConflictNum(p->pSat2)) );
 //                        Abc_Print( 1, "Imp =%10.0f. ", (double)p->pSat->stats.propagations );
 //                        Abc_Print( 1, "Uni =%7.0f. ",(double)(p->pSat ? sat_solver_count_assigned(p->pSat) : 0) );
 //                        ABC_PRT( "Time", Abc_Clock() - clk );
-                        Abc_Print( 1, "Learn =%7.0f. ", (double)(p->pSat ? p->pSat->stats.learnts : p->pSat3 ? bmcg_sat_solver_learntnum(p->pSat3) : satoko_learntnum(p->pSat2)) );
+                        Abc_Print( 1, "Learn =%7.0f. ", (double)(p->pSat ? p->pSat->stats.learnts : Sat_IfaceLearntNum(p->pSat2)) );
                         Abc_Print( 1, "%4.0f MB",      4.25*(f+1)*p->nObjNums /(1<<20) );
                         Abc_Print( 1, "%4.0f MB",      1.0*(p->pSat ? sat_solver_memory(p->pSat) : 0)/(1<<20) );
                         Abc_Print( 1, "%9.2f sec  ",   (float)(Abc_Clock() - clkTotal)/(float)(CLOCKS_PER_SEC) );
@@ -1762,9 +1719,7 @@ nTimeSat += clkSatRun;
                 if ( nTimeToStop )
                 {
                     if ( p->pSat2 )
-                        satoko_set_runtime_limit( p->pSat2, nTimeToStop );
-                    else if ( p->pSat3 )
-                        bmcg_sat_solver_set_runtime_limit( p->pSat3, nTimeToStop );
+                        Sat_IfaceSetRuntimeLimit( p->pSat2, nTimeToStop );
                     else
                         sat_solver_set_runtime_limit( p->pSat, nTimeToStop );
                 }
@@ -1781,12 +1736,7 @@ nTimeSat += clkSatRun;
                     Lit = Saig_ManBmcCreateCnf( p, pObj, f );
                     if ( p->pSat2 )
                     {
-                        if ( satoko_read_cex_varvalue(p->pSat2, lit_var(Lit)) == Abc_LitIsCompl(Lit) )
-                            continue;
-                    }
-                    else if ( p->pSat3 )
-                    {
-                        if ( bmcg_sat_solver_read_cex_varvalue(p->pSat3, lit_var(Lit)) == Abc_LitIsCompl(Lit) )
+                        if ( Sat_IfaceVarValue(p->pSat2, lit_var(Lit)) == Abc_LitIsCompl(Lit) )
                             continue;
                     }
                     else
@@ -1829,7 +1779,7 @@ nTimeUndec += clkSatRun;
         }
         if ( pPars->fVerbose ) 
         {
-            if ( fFirst == 1 && f > 0 && (p->pSat ? p->pSat->stats.conflicts : p->pSat3 ? bmcg_sat_solver_conflictnum(p->pSat3) : satoko_conflictnum(p->pSat2)) > 1 )
+            if ( fFirst == 1 && f > 0 && (p->pSat ? p->pSat->stats.conflicts : Sat_IfaceConflictNum(p->pSat2)) > 1 )
             {
                 fFirst = 0;
 //                Abc_Print( 1, "Outputs of frames up to %d are trivially UNSAT.\n", f );
@@ -1837,11 +1787,11 @@ nTimeUndec += clkSatRun;
             Abc_Print( 1, "%4d %s : ", f, fUnfinished ? "-" : "+" );
             Abc_Print( 1, "Var =%8.0f. ", (double)p->nSatVars );
 //            Abc_Print( 1, "Used =%8.0f. ", (double)sat_solver_count_usedvars(p->pSat) );
-            Abc_Print( 1, "Cla =%9.0f. ", (double)(p->pSat ? p->pSat->stats.clauses   : p->pSat3 ? bmcg_sat_solver_clausenum(p->pSat3)   : satoko_clausenum(p->pSat2))   );
-            Abc_Print( 1, "Conf =%7.0f. ",(double)(p->pSat ? p->pSat->stats.conflicts : p->pSat3 ? bmcg_sat_solver_conflictnum(p->pSat3) : satoko_conflictnum(p->pSat2)) );
+            Abc_Print( 1, "Cla =%9.0f. ", (double)(p->pSat ? p->pSat->stats.clauses   : Sat_IfaceClauseNum(p->pSat2))   );
+            Abc_Print( 1, "Conf =%7.0f. ",(double)(p->pSat ? p->pSat->stats.conflicts : Sat_IfaceConflictNum(p->pSat2)) );
 //            Abc_Print( 1, "Imp =%10.0f. ", (double)p->pSat->stats.propagations );
 //            Abc_Print( 1, "Uni =%7.0f. ", (double)(p->pSat ? sat_solver_count_assigned(p->pSat) : 0) );
-            Abc_Print( 1, "Learn =%7.0f. ", (double)(p->pSat ? p->pSat->stats.learnts : p->pSat3 ? bmcg_sat_solver_learntnum(p->pSat3) : satoko_learntnum(p->pSat2)) );
+            Abc_Print( 1, "Learn =%7.0f. ", (double)(p->pSat ? p->pSat->stats.learnts : Sat_IfaceLearntNum(p->pSat2)) );
             if ( pPars->fSolveAll )
                 Abc_Print( 1, "CEX =%5d. ", pPars->nFailOuts );
             if ( pPars->nTimeOutOne )
@@ -20,7 +20,9 @@
 
 #include "bmc.h"
 #include "sat/cnf/cnf.h"
+#include "sat/bsat/satIface.h"
 #include "sat/satoko/satoko.h"
+#include "misc/util/utilTask.h"
 
 
 //#define ABC_USE_EXT_SOLVERS 1
@@ -34,14 +36,14 @@
     #define l_Undef  0
     #define l_True   1
     #define l_False -1
-    #define bmc_sat_solver                     satoko_t
-    #define bmc_sat_solver_start(type)         satoko_create()
-    #define bmc_sat_solver_stop                satoko_destroy
-    #define bmc_sat_solver_addclause           satoko_add_clause
-    #define bmc_sat_solver_addvar(s)           satoko_add_variable(s, 0)
-    #define bmc_sat_solver_solve               satoko_solve_assumptions
-    #define bmc_sat_solver_read_cex_varvalue   satoko_read_cex_varvalue
-    #define bmc_sat_solver_setstop             satoko_set_stop
+    #define bmc_sat_solver                     Sat_Iface_t
+    #define bmc_sat_solver_start(type)         Sat_IfaceStart(type)
+    #define bmc_sat_solver_stop                Sat_IfaceStop
+    #define bmc_sat_solver_addclause           Sat_IfaceAddClause
+    #define bmc_sat_solver_addvar(s)           Sat_IfaceAddVar(s)
+    #define bmc_sat_solver_solve               Sat_IfaceSolve
+    #define bmc_sat_solver_read_cex_varvalue   Sat_IfaceVarValue
+    #define bmc_sat_solver_setstop             Sat_IfaceSetStop
 #endif
 
 
@@ -76,10 +78,15 @@ struct Bmcs_Man_t_
     Vec_Ptr_t         vGia2Fr;             // copies of GIA in each timeframe
     Vec_Int_t         vFr2Sat;             // mapping of objects in pFrames into SAT variables
     Vec_Int_t         vCiMap;              // maps CIs of pFrames into CIs/frames of GIA
+    Vec_Int_t         vPiSat;              // CIs/frames of GIA and SAT variables of the PIs of the released frames
+    int               iFrameBase;          // the first timeframe, whose outputs are in pFrames
+    int               nCompacts;           // the number of times the unfolding was compacted
     bmc_sat_solver *  pSats[PAR_THR_MAX];  // concurrent SAT solvers
+    Sat_Share_t *     pShare;              // learnt clauses shared by the concurrent solvers
     int               nSatVars;            // number of SAT variables used
     int               nSatVarsOld;         // number of SAT variables used
     int               fStopNow;            // signal when it is time to stop
+    int               fWallClock;          // measure the runtime by the wall clock (the solvers run concurrently)
     abctime           timeUnf;             // runtime of unfolding
     abctime           timeCnf;             // runtime of CNF generation
     abctime           timeSat;             // runtime of the solvers
@@ -88,6 +95,8 @@ struct Bmcs_Man_t_
 
 //static inline int * Bmcs_ManCopies( Bmcs_Man_t * p, int f ) { return (int*)Vec_PtrEntry(&p->vGia2Fr, f % Vec_PtrSize(&p->vGia2Fr)); }
 static inline int * Bmcs_ManCopies( Bmcs_Man_t * p, int f ) { return (int*)Vec_PtrEntry(&p->vGia2Fr, f); }
+static inline Gia_Obj_t * Bmcs_ManPo( Bmcs_Man_t * p, int f, int i ) { return Gia_ManCo(p->pFrames, (f - p->iFrameBase) * Gia_ManPoNum(p->pGia) + i); }
+static inline abctime Bmcs_ManClock( Bmcs_Man_t * p ) { return p->fWallClock ? Abc_ClockWall() : Abc_Clock(); }
 
 ////////////////////////////////////////////////////////////////////////
 ///                     FUNCTION DEFINITIONS                         ///
@@ -365,6 +374,7 @@ int Gia_ManCountRanks( Gia_Man_t * p )
 Bmcs_Man_t * Bmcs_ManStart( Gia_Man_t * pGia, Bmc_AndPar_t * pPars )
 {
     Bmcs_Man_t * p = ABC_CALLOC( Bmcs_Man_t, 1 ); 
+    Vec_Int_t * vTypes = pPars->pSolvers ? Sat_IfaceTypesByNames( pPars->pSolvers ) : NULL;
     int i, Lit = Abc_Var2Lit( 0, 1 );
     satoko_opts_t opts;
     satoko_default_opts(&opts);
@@ -388,17 +398,32 @@ Bmcs_Man_t * Bmcs_ManStart( Gia_Man_t * pGia, Bmc_AndPar_t * pPars )
 	    opts.b_rst = 1.4 - i * 0.05;
         opts.garbage_max_ratio = (float) 0.3 + i * 0.05;
         // create SAT solvers
-        p->pSats[i] = bmc_sat_solver_start( i );  
 #ifdef ABC_USE_EXT_SOLVERS
+        p->pSats[i] = bmc_sat_solver_start( i );  
         p->pSats[i]->SolverType = i;
 #else
-        satoko_configure(p->pSats[i], &opts);
+        // the solvers listed by the user are assigned to the threads in a round-robin fashion
+        p->pSats[i] = bmc_sat_solver_start( vTypes ? Vec_IntEntry(vTypes, i % Vec_IntSize(vTypes)) : SAT_IFACE_SATOKO );  
+        if ( Sat_IfaceType(p->pSats[i]) == SAT_IFACE_SATOKO )
+            satoko_configure((satoko_t *)Sat_IfaceSolver(p->pSats[i]), &opts);
+        else
+            Sat_IfaceSetConflictLimit( p->pSats[i], pPars->nConfLimit );
 #endif
         bmc_sat_solver_addvar( p->pSats[i] );
         bmc_sat_solver_addclause( p->pSats[i], &Lit, 1 );  
         bmc_sat_solver_setstop( p->pSats[i], &p->fStopNow );
     }
+#ifndef ABC_USE_EXT_SOLVERS
+    // the concurrent solvers exchange their short learnt clauses
+    if ( pPars->nProcs > 1 )
+    {
+        p->pShare = Sat_ShareStart( pPars->nProcs );
+        for ( i = 0; i < pPars->nProcs; i++ )
+            Sat_IfaceSetShare( p->pSats[i], p->pShare, i );
+    }
+#endif
     p->nSatVars = 1;
+    Vec_IntFreeP( &vTypes );
     return p;
 }
 void Bmcs_ManStop( Bmcs_Man_t * p )
@@ -410,9 +435,12 @@ void Bmcs_ManStop( Bmcs_Man_t * p )
     Vec_PtrErase( &p->vGia2Fr );
     Vec_IntErase( &p->vFr2Sat );
     Vec_IntErase( &p->vCiMap );
+    Vec_IntErase( &p->vPiSat );
     for ( i = 0; i < p->pPars->nProcs; i++ )
         if ( p->pSats[i] ) 
             bmc_sat_solver_stop( p->pSats[i] );
+    if ( p->pShare )
+        Sat_ShareStop( p->pShare );
     ABC_FREE( p );
 }
 
@@ -493,7 +521,7 @@ Gia_Man_t * Bmcs_ManUnfold( Bmcs_Man_t * p, int f, int nFramesAdd )
     Gia_Man_t * pNew = NULL; Gia_Obj_t * pObj;
     int i, k, iLitFrame, iLitClean, fTrivial = 1;
     int * pCopies, nFrameObjs = Gia_ManObjNum(p->pFrames);
-    assert( Gia_ManPoNum(p->pFrames) == f * Gia_ManPoNum(p->pGia) );
+    assert( Gia_ManPoNum(p->pFrames) == (f - p->iFrameBase) * Gia_ManPoNum(p->pGia) );
     for ( k = 0; k < nFramesAdd; k++ )
     {
         // unfold this timeframe
@@ -522,7 +550,7 @@ Gia_Man_t * Bmcs_ManUnfold( Bmcs_Man_t * p, int f, int nFramesAdd )
     for ( k = 0; k < nFramesAdd; k++ )
     for ( i = 0; i < Gia_ManPoNum(p->pGia); i++ )
     {
-        pObj = Gia_ManCo( p->pFrames, (f+k) * Gia_ManPoNum(p->pGia) + i );
+        pObj = Bmcs_ManPo( p, f+k, i );
         iLitClean = Bmcs_ManCollect_rec( p, Gia_ObjFaninId0p(p->pFrames, pObj) );
         iLitClean = Abc_LitNotCond( iLitClean, Gia_ObjFaninC0(pObj) );
         iLitClean = Gia_ManAppendCo( p->pClean, iLitClean );
@@ -536,15 +564,15 @@ Gia_Man_t * Bmcs_ManUnfold( Bmcs_Man_t * p, int f, int nFramesAdd )
 }
 Cnf_Dat_t * Bmcs_ManAddNewCnf( Bmcs_Man_t * p, int f, int nFramesAdd )
 {
-    abctime clk = Abc_Clock();
+    abctime clk = Bmcs_ManClock( p );
     Gia_Man_t * pNew = Bmcs_ManUnfold( p, f, nFramesAdd );
     Cnf_Dat_t * pCnf;
     Gia_Obj_t * pObj; 
     int i, iVar, * pMap;
-    p->timeUnf += Abc_Clock() - clk;
+    p->timeUnf += Bmcs_ManClock( p ) - clk;
     if ( pNew == NULL )
         return NULL;
-    clk = Abc_Clock();
+    clk = Bmcs_ManClock( p );
     pCnf = (Cnf_Dat_t *) Mf_ManGenerateCnf( pNew, 8, 1, 0, 0, 0 );
     pMap = ABC_FALLOC( int, Gia_ManObjNum(pNew) );
     pMap[0] = 0;
@@ -561,10 +589,112 @@ Cnf_Dat_t * Bmcs_ManAddNewCnf( Bmcs_Man_t * p, int f, int nFramesAdd )
     for ( i = 0; i < pCnf->nLiterals; i++ )
         pCnf->pClauses[0][i] = Abc_Lit2LitV( pMap, pCnf->pClauses[0][i] );
     ABC_FREE( pMap );
-    p->timeCnf += Abc_Clock() - clk;
+    p->timeCnf += Bmcs_ManClock( p ) - clk;
     return pCnf;
 }
 
+/**Function*************************************************************
+
+  Synopsis    [Releases the timeframes that have been checked.]
+
+  Description [The unfolding of the checked timeframes is replaced by 
+  the logic cones of the next-state functions of the last timeframe, 
+  which are needed to unfold the following timeframes. The cones are 
+  copied into a new unfolding up to the nodes that already have SAT 
+  variables, which become its CIs. The CIs of the old unfolding that
+  have SAT variables are recorded to derive the counter-examples. The 
+  copies of GIA in the released timeframes are freed. Because the next 
+  timeframe is unfolded using only the copies of the next-state functions,
+  the cones are completed before the old unfolding is released.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Bmcs_ManCompact_rec( Bmcs_Man_t * p, Gia_Man_t * pNew, int iObj, Vec_Int_t * vMap, Vec_Int_t * vFr2Sat, Vec_Int_t * vCiMap )
+{
+    Gia_Obj_t * pObj; 
+    int iSatVar, iLit = Vec_IntEntry( vMap, iObj );
+    if ( iLit >= 0 )
+        return iLit;
+    pObj = Gia_ManObj( p->pFrames, iObj );
+    iSatVar = Vec_IntEntry( &p->vFr2Sat, iObj );
+    if ( iSatVar > 0 || Gia_ObjIsCi(pObj) )
+    {
+        iLit = Gia_ManAppendCi( pNew );
+        Vec_IntFillExtra( vFr2Sat, Gia_ManObjNum(pNew), -1 );
+        Vec_IntWriteEntry( vFr2Sat, Abc_Lit2Var(iLit), iSatVar );
+        // the PIs without SAT variables remain PIs of the unfolding
+        if ( iSatVar <= 0 )
+            Vec_IntPushTwo( vCiMap, Vec_IntEntry(&p->vCiMap, 2*Gia_ObjCioId(pObj)), Vec_IntEntry(&p->vCiMap, 2*Gia_ObjCioId(pObj)+1) );
+        else
+            Vec_IntPushTwo( vCiMap, -1, -1 );
+    }
+    else if ( Gia_ObjIsAnd(pObj) )
+    {
+        int iLit0 = Bmcs_ManCompact_rec( p, pNew, Gia_ObjFaninId0(pObj, iObj), vMap, vFr2Sat, vCiMap );
+        int iLit1 = Bmcs_ManCompact_rec( p, pNew, Gia_ObjFaninId1(pObj, iObj), vMap, vFr2Sat, vCiMap );
+        iLit0 = Abc_LitNotCond( iLit0, Gia_ObjFaninC0(pObj) );
+        iLit1 = Abc_LitNotCond( iLit1, Gia_ObjFaninC1(pObj) );
+        iLit  = Gia_ManHashAnd( pNew, iLit0, iLit1 );
+    }
+    else assert( 0 );
+    Vec_IntWriteEntry( vMap, iObj, iLit );
+    return iLit;
+}
+void Bmcs_ManCompact( Bmcs_Man_t * p, int fNext )
+{
+    Gia_Man_t * pNew; Gia_Obj_t * pObj;
+    Vec_Int_t * vMap, vFr2Sat = {0}, vCiMap = {0};
+    int i, iLit, iFanin, f = fNext - 1, * pCopies, * pCopiesNew;
+    abctime clk = Bmcs_ManClock( p );
+    assert( Vec_PtrSize(&p->vGia2Fr) == fNext );
+    // complete the next-state functions of the last timeframe
+    pCopies = Bmcs_ManCopies( p, f );
+    Gia_ManForEachRi( p->pGia, pObj, i )
+        Bmcs_ManUnfold_rec( p, Gia_ObjFaninId0p(p->pGia, pObj), f );
+    Vec_IntFillExtra( &p->vFr2Sat, Gia_ManObjNum(p->pFrames), -1 );
+    // record the SAT variables of the PIs
+    Gia_ManForEachPi( p->pFrames, pObj, i )
+    {
+        int iSatVar = Vec_IntEntry( &p->vFr2Sat, Gia_ObjId(p->pFrames, pObj) );
+        if ( iSatVar > 0 && Vec_IntEntry(&p->vCiMap, 2*i) >= 0 )
+        {
+            Vec_IntPushTwo( &p->vPiSat, Vec_IntEntry(&p->vCiMap, 2*i), Vec_IntEntry(&p->vCiMap, 2*i+1) );
+            Vec_IntPush( &p->vPiSat, iSatVar );
+        }
+    }
+    // copy the cones of the next-state functions
+    pNew = Gia_ManStart( 3*Gia_ManRegNum(p->pGia) + 1000 );  Gia_ManHashStart( pNew );
+    vMap = Vec_IntStartFull( Gia_ManObjNum(p->pFrames) );
+    Vec_IntWriteEntry( vMap, 0, 0 );
+    Vec_IntPush( &vFr2Sat, 0 );
+    pCopiesNew = ABC_FALLOC( int, Gia_ManObjNum(p->pGia) );
+    pCopiesNew[0] = 0;
+    Gia_ManForEachRi( p->pGia, pObj, i )
+    {
+        iFanin = Gia_ObjFaninId0p( p->pGia, pObj );
+        iLit   = Bmcs_ManCompact_rec( p, pNew, Abc_Lit2Var(pCopies[iFanin]), vMap, &vFr2Sat, &vCiMap );
+        pCopiesNew[iFanin] = Abc_LitNotCond( iLit, Abc_LitIsCompl(pCopies[iFanin]) );
+    }
+    Vec_IntFillExtra( &vFr2Sat, Gia_ManObjNum(pNew), -1 );
+    Vec_IntFree( vMap );
+    // replace the unfolding
+    Gia_ManStop( p->pFrames );
+    p->pFrames = pNew;
+    Vec_IntErase( &p->vFr2Sat );
+    Vec_IntErase( &p->vCiMap );
+    p->vFr2Sat = vFr2Sat;
+    p->vCiMap  = vCiMap;
+    for ( i = p->iFrameBase ? p->iFrameBase - 1 : 0; i <= f; i++ )
+        ABC_FREE( p->vGia2Fr.pArray[i] );
+    Vec_PtrWriteEntry( &p->vGia2Fr, f, pCopiesNew );
+    p->iFrameBase = fNext;
+    p->nCompacts++;
+    p->timeUnf += Bmcs_ManClock( p ) - clk;
+}
+
 /**Function*************************************************************
 
   Synopsis    []
@@ -576,25 +706,25 @@ Cnf_Dat_t * Bmcs_ManAddNewCnf( Bmcs_Man_t * p, int f, int nFramesAdd )
   SeeAlso     []
 
 ***********************************************************************/
-void Bmcs_ManPrintFrame( Bmcs_Man_t * p, int f, int nClauses, int Solver, abctime clkStart )
+void Bmcs_ManPrintFrame( Bmcs_Man_t * p, int f, int nClauses, int Solver, abctime clk )
 {
-    int fUnfinished = 0;
+    int fUnfinished = 0, nCopies = Vec_PtrSize(&p->vGia2Fr) - Abc_MaxInt(p->iFrameBase - 1, 0);
     if ( !p->pPars->fVerbose )
         return;
     Abc_Print( 1, "%4d %s : ", f,   fUnfinished ? "-" : "+" );
 #ifndef ABC_USE_EXT_SOLVERS
-    Abc_Print( 1, "Var =%8.0f.  ",  (double)satoko_varnum(p->pSats[0]) ); 
-    Abc_Print( 1, "Cla =%9.0f.  ",  (double)satoko_clausenum(p->pSats[0]) );  
-    Abc_Print( 1, "Learn =%9.0f.  ",(double)satoko_learntnum(p->pSats[0]) );  
-    Abc_Print( 1, "Conf =%9.0f.  ", (double)satoko_conflictnum(p->pSats[0]) );  
+    Abc_Print( 1, "Var =%8.0f.  ",  (double)Sat_IfaceVarNum(p->pSats[0]) ); 
+    Abc_Print( 1, "Cla =%9.0f.  ",  (double)Sat_IfaceClauseNum(p->pSats[0]) );  
+    Abc_Print( 1, "Learn =%9.0f.  ",(double)Sat_IfaceLearntNum(p->pSats[0]) );  
+    Abc_Print( 1, "Conf =%9.0f.  ", (double)Sat_IfaceConflictNum(p->pSats[0]) );  
 #else
     Abc_Print( 1, "Var =%8.0f.  ",  (double)p->nSatVars ); 
     Abc_Print( 1, "Cla =%9.0f.  ",  (double)nClauses );  
 #endif
     if ( p->pPars->nProcs > 1 )
         Abc_Print( 1, "S = %3d. ",  Solver );
-    Abc_Print( 1, "%4.0f MB",       1.0*((int)Gia_ManMemory(p->pFrames) + Vec_IntMemory(&p->vFr2Sat))/(1<<20) );
-    Abc_Print( 1, "%9.2f sec  ",    (float)(Abc_Clock() - clkStart)/(float)(CLOCKS_PER_SEC) );
+    Abc_Print( 1, "%4.0f MB",       1.0*((int)Gia_ManMemory(p->pFrames) + Vec_IntMemory(&p->vFr2Sat) + 4.0*nCopies*Gia_ManObjNum(p->pGia))/(1<<20) );
+    Abc_Print( 1, "%9.2f sec  ",    (float)(clk)/(float)(CLOCKS_PER_SEC) );
     printf( "\n" );
     fflush( stdout );
 }
@@ -608,6 +738,10 @@ void Bmcs_ManPrintTime( Bmcs_Man_t * p )
     ABC_PRTP( "SAT solving   ", p->timeSat,  clkTotal );
     ABC_PRTP( "Other         ", p->timeOth,  clkTotal );
     ABC_PRTP( "TOTAL         ", clkTotal  ,  clkTotal );
+    if ( p->nCompacts )
+        Abc_Print( 1, "The unfolding was compacted %d times. The last %d timeframes are kept.\n", p->nCompacts, Vec_PtrSize(&p->vGia2Fr) - p->iFrameBase );
+    if ( p->pShare )
+        Sat_SharePrintStats( p->pShare );
 }
 Abc_Cex_t * Bmcs_ManGenerateCex( Bmcs_Man_t * p, int i, int f, int s )
 {
@@ -616,13 +750,15 @@ Abc_Cex_t * Bmcs_ManGenerateCex( Bmcs_Man_t * p, int i, int f, int s )
     Gia_ManForEachPi( p->pFrames, pObj, k )
     {
         int iSatVar = Vec_IntEntry( &p->vFr2Sat, Gia_ObjId(p->pFrames, pObj) );
-        if ( iSatVar > 0 && bmc_sat_solver_read_cex_varvalue(p->pSats[s], iSatVar) ) // 1 bit
-        {
-            int iCiId   = Vec_IntEntry( &p->vCiMap, 2*k+0 );
-            int iFrame  = Vec_IntEntry( &p->vCiMap, 2*k+1 );
+        int iCiId   = Vec_IntEntry( &p->vCiMap, 2*k+0 );
+        int iFrame  = Vec_IntEntry( &p->vCiMap, 2*k+1 );
+        if ( iSatVar > 0 && iCiId >= 0 && bmc_sat_solver_read_cex_varvalue(p->pSats[s], iSatVar) ) // 1 bit
             Abc_InfoSetBit( pCex->pData, Gia_ManRegNum(p->pGia) + iFrame * Gia_ManPiNum(p->pGia) + iCiId );
-        }
     }
+    // add the PIs of the released timeframes
+    for ( k = 0; k < Vec_IntSize(&p->vPiSat); k += 3 )
+        if ( bmc_sat_solver_read_cex_varvalue(p->pSats[s], Vec_IntEntry(&p->vPiSat, k+2)) )
+            Abc_InfoSetBit( pCex->pData, Gia_ManRegNum(p->pGia) + Vec_IntEntry(&p->vPiSat, k+1) * Gia_ManPiNum(p->pGia) + Vec_IntEntry(&p->vPiSat, k) );
     return pCex;
 }
 void Bmcs_ManAddCnf( Bmcs_Man_t * p, bmc_sat_solver * pSat, Cnf_Dat_t * pCnf )
@@ -645,7 +781,7 @@ int Bmcs_ManPerformOne( Gia_Man_t * pGia, Bmc_AndPar_t * pPars )
         Cnf_Dat_t * pCnf = Bmcs_ManAddNewCnf( p, f, pPars->nFramesAdd );
         if ( pCnf == NULL )
         {
-            Bmcs_ManPrintFrame( p, f, nClauses, -1, clkStart );
+            Bmcs_ManPrintFrame( p, f, nClauses, -1, Abc_Clock() - clkStart );
             if( pPars->pFuncOnFrameDone)
                 for ( k = 0; k < pPars->nFramesAdd; k++ )
                 for ( i = 0; i < Gia_ManPoNum(pGia); i++ )
@@ -656,13 +792,13 @@ int Bmcs_ManPerformOne( Gia_Man_t * pGia, Bmc_AndPar_t * pPars )
         Bmcs_ManAddCnf( p, p->pSats[0], pCnf );
         p->nSatVarsOld = p->nSatVars;
         Cnf_DataFree( pCnf );
-        assert( Gia_ManPoNum(p->pFrames) == (f + pPars->nFramesAdd) * Gia_ManPoNum(pGia) );
+        assert( Gia_ManPoNum(p->pFrames) == (f + pPars->nFramesAdd - p->iFrameBase) * Gia_ManPoNum(pGia) );
         for ( k = 0; k < pPars->nFramesAdd; k++ )
         {
             for ( i = 0; i < Gia_ManPoNum(pGia); i++ )
             {
                 abctime clk = Abc_Clock();
-                int iObj = Gia_ObjId( p->pFrames, Gia_ManCo(p->pFrames, (f+k) * Gia_ManPoNum(pGia) + i) );
+                int iObj = Gia_ObjId( p->pFrames, Bmcs_ManPo(p, f+k, i) );
                 int iLit = Abc_Var2Lit( Vec_IntEntry(&p->vFr2Sat, iObj), 0 );
                 if ( pPars->nTimeOut && (Abc_Clock() - clkStart)/CLOCKS_PER_SEC >= pPars->nTimeOut )
                     break;
@@ -670,8 +806,14 @@ int Bmcs_ManPerformOne( Gia_Man_t * pGia, Bmc_AndPar_t * pPars )
                 p->timeSat += Abc_Clock() - clk;
                 if ( status == l_False ) // unsat
                 {
+                    // the output is false in this timeframe in all traces
+                    if ( pPars->nFramesWin )
+                    {
+                        iLit = Abc_LitNot( iLit );
+                        bmc_sat_solver_addclause( p->pSats[0], &iLit, 1 );
+                    }
                     if ( i == Gia_ManPoNum(pGia)-1 )
-                        Bmcs_ManPrintFrame( p, f+k, nClauses, -1, clkStart );
+                        Bmcs_ManPrintFrame( p, f+k, nClauses, -1, Abc_Clock() - clkStart );
                     if( pPars->pFuncOnFrameDone)
                         pPars->pFuncOnFrameDone(f+k, i, 0);
                     continue;
@@ -682,7 +824,7 @@ int Bmcs_ManPerformOne( Gia_Man_t * pGia, Bmc_AndPar_t * pPars )
                     pPars->iFrame = f+k;
                     pGia->pCexSeq = Bmcs_ManGenerateCex( p, i, f+k, 0 );
                     pPars->nFailOuts++;
-                    Bmcs_ManPrintFrame( p, f+k, nClauses, -1, clkStart );
+                    Bmcs_ManPrintFrame( p, f+k, nClauses, -1, Abc_Clock() - clkStart );
                     if ( !pPars->fNotVerbose )
                     {
                         int nOutDigits = Abc_Base10Log( Gia_ManPoNum(pGia) );
@@ -700,6 +842,9 @@ int Bmcs_ManPerformOne( Gia_Man_t * pGia, Bmc_AndPar_t * pPars )
         }
         if ( k < pPars->nFramesAdd )
             break;
+        // release the checked timeframes
+        if ( pPars->nFramesWin && f + pPars->nFramesAdd - p->iFrameBase >= pPars->nFramesWin )
+            Bmcs_ManCompact( p, f + pPars->nFramesAdd );
     }
     p->timeOth = Abc_Clock() - clkStart - p->timeUnf - p->timeCnf - p->timeSat;
     if ( RetValue == -1 && !pPars->fNotVerbose )
@@ -732,78 +877,54 @@ int Bmcs_ManPerformMulti( Gia_Man_t * pGia, Bmc_AndPar_t * pPars ) { return Bmcs
 
 typedef struct Par_ThData_t_
 {
+    Bmcs_Man_t *      p;
     bmc_sat_solver *  pSat;
     int         iLit;
     int         iThread;
-    int         fWorking;
     int         status;
 } Par_ThData_t;
 
-void * Bmcs_ManWorkerThread( void * pArg )
+void * Bmcs_ManSolveTask( void * pArg )
 {
     Par_ThData_t * pThData = (Par_ThData_t *)pArg;
-    volatile int * pPlace = &pThData->fWorking;
-    while ( 1 )
-    {
-        while ( *pPlace == 0 );
-        assert( pThData->fWorking );
-        if ( pThData->pSat == NULL )
-        {
-	        pthread_exit( NULL );
-            assert( 0 );
-            return NULL;
-        }
-
-        pThData->status = bmc_sat_solver_solve( pThData->pSat, &pThData->iLit, 1 );
-
-        //printf( "Thread %d finished with status %d\n", pThData->iThread, pThData->status );
-
-        pThData->fWorking = 0;
-    }
-	assert( 0 );
-	return NULL;
+    pThData->status = bmc_sat_solver_solve( pThData->pSat, &pThData->iLit, 1 );
+    //printf( "Thread %d finished with status %d\n", pThData->iThread, pThData->status );
+    // the first solver to finish stops the others
+    pThData->p->fStopNow = 1;
+    return NULL;
 }
 
-int Bmcs_ManPerform_Solve( Bmcs_Man_t * p, int iLit, pthread_t * WorkerThread, Par_ThData_t * ThData, int nProcs, int * pSolver )
+int Bmcs_ManPerform_Solve( Bmcs_Man_t * p, int iLit, Util_Pool_t * pPool, Par_ThData_t * ThData, int nProcs, int nTimeLeft, int * pSolver )
 {
+    Util_Task_t * pTasks[PAR_THR_MAX];
     int i, status = -1;
-    // set new problem
+    // start solvers on a new problem
     for ( i = 0; i < nProcs; i++ )
     {
-        ThData[i].iLit = iLit;
-        assert( ThData[i].fWorking == 0 );
+        ThData[i].iLit   = iLit;
+        ThData[i].status = l_Undef;
+        pTasks[i] = Util_PoolSubmit( pPool, Bmcs_ManSolveTask, (void *)(ThData + i) );
     }
-    // start solvers on a new problem
+    // wait till the solvers finish or the time limit (in milliseconds) expires
+    if ( nTimeLeft > 0 && !Util_PoolWaitIdleTimed( pPool, nTimeLeft ) )
+        p->fStopNow = 1;
     for ( i = 0; i < nProcs; i++ )
-        ThData[i].fWorking = 1;
-    // check if any of the solvers finished
-    while ( i == nProcs )
     {
-        for ( i = 0; i < nProcs; i++ )
-        {
-            if ( ThData[i].fWorking )
-                continue;
-            // set stop request
-            p->fStopNow = 1;
-            // remember status
-            status = ThData[i].status;
-            //printf( "Solver %d returned status %d.\n", i, status );
-            *pSolver = i;
-            break;
-        }
+        Util_TaskWait( pTasks[i] );
+        Util_TaskFree( pTasks[i] );
     }
-    // wait till threads finish
-    while ( i < nProcs )
+    // take the result of the solver that finished the problem
+    for ( i = 0; i < nProcs; i++ )
     {
-        for ( i = 0; i < nProcs; i++ )
-            if ( ThData[i].fWorking )
-                break;
+        if ( ThData[i].status == l_Undef && i < nProcs - 1 )
+            continue;
+        status = ThData[i].status;
+        //printf( "Solver %d returned status %d.\n", i, status );
+        *pSolver = i;
+        break;
     }
     for ( i = 0; i < nProcs; i++ )
-    {
         ThData[i].iLit = -1;
-        assert( ThData[i].fWorking == 0 );
-    }
     // reset stop request
     p->fStopNow = 0;
     return status;
@@ -811,21 +932,22 @@ int Bmcs_ManPerform_Solve( Bmcs_Man_t * p, int iLit, pthread_t * WorkerThread, P
 
 int Bmcs_ManPerformMulti( Gia_Man_t * pGia, Bmc_AndPar_t * pPars )
 {
-    abctime clkStart = Abc_Clock();
-	pthread_t WorkerThread[PAR_THR_MAX];
+    abctime clkStart = Abc_ClockWall();
+    Util_Pool_t * pPool;
     Par_ThData_t ThData[PAR_THR_MAX];
     Bmcs_Man_t * p = Bmcs_ManStart( pGia, pPars );
-    int f, k = 0, i = Gia_ManPoNum(pGia), status, RetValue = -1, nClauses = 0, Solver = 0;
+    int f, k = 0, i = Gia_ManPoNum(pGia), status, RetValue = -1, nClauses = 0, Solver = 0, nTimeLeft = 0;
     Abc_CexFreeP( &pGia->pCexSeq );
+    p->fWallClock = 1;
     // start threads
+    pPool = Util_PoolStart( pPars->nProcs );
     for ( i = 0; i < pPars->nProcs; i++ )
     {
+        ThData[i].p        = p;
         ThData[i].pSat     = p->pSats[i];
         ThData[i].iLit     = -1;
         ThData[i].iThread  =  i;
-        ThData[i].fWorking =  0;
         ThData[i].status   = -1;
-        status = pthread_create( WorkerThread + i, NULL, Bmcs_ManWorkerThread, (void *)(ThData + i) );  assert( status == 0 );
     }
     // solve properties in each timeframe
     for ( f = 0; !pPars->nFramesMax || f < pPars->nFramesMax; f += pPars->nFramesAdd )
@@ -833,7 +955,7 @@ int Bmcs_ManPerformMulti( Gia_Man_t * pGia, Bmc_AndPar_t * pPars )
         Cnf_Dat_t * pCnf = Bmcs_ManAddNewCnf( p, f, pPars->nFramesAdd );
         if ( pCnf == NULL )
         {
-            Bmcs_ManPrintFrame( p, f, nClauses, 0, clkStart );
+            Bmcs_ManPrintFrame( p, f, nClauses, 0, Abc_ClockWall() - clkStart );
             if( pPars->pFuncOnFrameDone )
                 for ( k = 0; k < pPars->nFramesAdd; k++ )
                 for ( i = 0; i < Gia_ManPoNum(pGia); i++ )
@@ -847,22 +969,31 @@ int Bmcs_ManPerformMulti( Gia_Man_t * pGia, Bmc_AndPar_t * pPars )
         p->nSatVarsOld = p->nSatVars;
         Cnf_DataFree( pCnf );
         // solve outputs
-        assert( Gia_ManPoNum(p->pFrames) == (f + pPars->nFramesAdd) * Gia_ManPoNum(pGia) );
+        assert( Gia_ManPoNum(p->pFrames) == (f + pPars->nFramesAdd - p->iFrameBase) * Gia_ManPoNum(pGia) );
         for ( k = 0; k < pPars->nFramesAdd; k++ )
         {
             for ( i = 0; i < Gia_ManPoNum(pGia); i++ )
             {
-                abctime clk = Abc_Clock();
-                int iObj = Gia_ObjId( p->pFrames, Gia_ManCo(p->pFrames, (f+k) * Gia_ManPoNum(pGia) + i) );
+                abctime clk = Abc_ClockWall();
+                int iObj = Gia_ObjId( p->pFrames, Bmcs_ManPo(p, f+k, i) );
                 int iLit = Abc_Var2Lit( Vec_IntEntry(&p->vFr2Sat, iObj), 0 );
-                if ( pPars->nTimeOut && (Abc_Clock() - clkStart)/CLOCKS_PER_SEC >= pPars->nTimeOut )
+                if ( pPars->nTimeOut && (Abc_ClockWall() - clkStart)/CLOCKS_PER_SEC >= pPars->nTimeOut )
                     break;
-                status = Bmcs_ManPerform_Solve( p, iLit, WorkerThread, ThData, pPars->nProcs, &Solver );
-                p->timeSat += Abc_Clock() - clk;
+                if ( pPars->nTimeOut )
+                    nTimeLeft = Abc_MaxInt( 1, (int)(1000 * pPars->nTimeOut - 1000 * (Abc_ClockWall() - clkStart) / CLOCKS_PER_SEC) );
+                status = Bmcs_ManPerform_Solve( p, iLit, pPool, ThData, pPars->nProcs, nTimeLeft, &Solver );
+                p->timeSat += Abc_ClockWall() - clk;
                 if ( status == l_False ) // unsat
                 {
+                    // the output is false in this timeframe in all traces
+                    if ( pPars->nFramesWin )
+                    {
+                        int s; iLit = Abc_LitNot( iLit );
+                        for ( s = 0; s < pPars->nProcs; s++ )
+                            bmc_sat_solver_addclause( p->pSats[s], &iLit, 1 );
+                    }
                     if ( i == Gia_ManPoNum(pGia)-1 )
-                        Bmcs_ManPrintFrame( p, f+k, nClauses, Solver, clkStart );
+                        Bmcs_ManPrintFrame( p, f+k, nClauses, Solver, Abc_ClockWall() - clkStart );
                     if( pPars->pFuncOnFrameDone )
                         pPars->pFuncOnFrameDone(f+k, i, 0);
                     continue;
@@ -873,7 +1004,7 @@ int Bmcs_ManPerformMulti( Gia_Man_t * pGia, Bmc_AndPar_t * pPars )
                     pPars->iFrame = f+k;
                     pGia->pCexSeq = Bmcs_ManGenerateCex( p, i, f+k, Solver );
                     pPars->nFailOuts++;
-                    Bmcs_ManPrintFrame( p, f+k, nClauses, Solver, clkStart );
+                    Bmcs_ManPrintFrame( p, f+k, nClauses, Solver, Abc_ClockWall() - clkStart );
                     if ( !pPars->fNotVerbose )
                     {
                         int nOutDigits = Abc_Base10Log( Gia_ManPoNum(pGia) );
@@ -891,18 +1022,16 @@ int Bmcs_ManPerformMulti( Gia_Man_t * pGia, Bmc_AndPar_t * pPars )
         }
         if ( k < pPars->nFramesAdd )
             break;
+        // release the checked timeframes
+        if ( pPars->nFramesWin && f + pPars->nFramesAdd - p->iFrameBase >= pPars->nFramesWin )
+            Bmcs_ManCompact( p, f + pPars->nFramesAdd );
     }
     // stop threads
-    for ( i = 0; i < pPars->nProcs; i++ )
-    {
-        assert( !ThData[i].fWorking );
-        ThData[i].pSat = NULL;
-        ThData[i].fWorking = 1;
-    }
-    p->timeOth = Abc_Clock() - clkStart - p->timeUnf - p->timeCnf - p->timeSat;
+    Util_PoolStop( pPool );
+    p->timeOth = Abc_ClockWall() - clkStart - p->timeUnf - p->timeCnf - p->timeSat;
     if ( RetValue == -1 && !pPars->fNotVerbose )
         printf( "No output failed in %d frames.  ", f + (k < pPars->nFramesAdd ? k+1 : 0) );
-    Abc_PrintTime( 1, "Time", Abc_Clock() - clkStart );
+    Abc_PrintTime( 1, "Time", Abc_ClockWall() - clkStart );
     Bmcs_ManPrintTime( p );
     Bmcs_ManStop( p );
     return RetValue;
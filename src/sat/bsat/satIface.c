@@ -0,0 +1,495 @@
+/**CFile****************************************************************
+
+  FileName    [satIface.c]
+
+  SystemName  [ABC: Logic synthesis and verification system.]
+
+  PackageName [SAT solver.]
+
+  Synopsis    [Common interface to the incremental SAT solvers.]
+
+  Author      [Alan Mishchenko]
+
+  Affiliation [UC Berkeley]
+
+  Date        [Ver. 1.0. Started - June 20, 2005.]
+
+  Revision    [$Id: satIface.c,v 1.00 2005/06/20 00:00:00 alanmi Exp $]
+
+***********************************************************************/
+
+#include "satSolver.h"
+#include "satIface.h"
+#include "sat/satoko/satoko.h"
+#include "sat/glucose/AbcGlucose.h"
+
+ABC_NAMESPACE_IMPL_START
+
+////////////////////////////////////////////////////////////////////////
+///                        DECLARATIONS                              ///
+////////////////////////////////////////////////////////////////////////
+
+struct Sat_Iface_t_
+{
+    int              Type;          // the solver type
+    void *           pSat;          // the solver
+    int              nConfLimit;    // the conflict limit for one call (0 = no limit)
+};
+
+static char * s_SatIfaceNames[SAT_IFACE_NUM] = { "bsat", "satoko", "glucose", "portfolio" };
+
+static inline sat_solver *      Sat_IfaceBsat( Sat_Iface_t * p )    { return (sat_solver *)p->pSat;      }
+static inline satoko_t *        Sat_IfaceSatoko( Sat_Iface_t * p )  { return (satoko_t *)p->pSat;        }
+static inline bmcg_sat_solver * Sat_IfaceGlucose( Sat_Iface_t * p ) { return (bmcg_sat_solver *)p->pSat; }
+static inline Sat_Port_t *      Sat_IfacePort( Sat_Iface_t * p )    { return (Sat_Port_t *)p->pSat;      }
+
+// the solver of the portfolio whose results are returned
+static inline Sat_Iface_t *     Sat_IfacePortBest( Sat_Iface_t * p ) { return Sat_PortSolver( Sat_IfacePort(p), Abc_MaxInt(Sat_PortWinner(Sat_IfacePort(p)), 0) ); }
+
+////////////////////////////////////////////////////////////////////////
+///                     FUNCTION DEFINITIONS                         ///
+////////////////////////////////////////////////////////////////////////
+
+/**Function*************************************************************
+
+  Synopsis    [Converts between the solver types and their names.]
+
+  Description [Sat_IfaceTypeByName() returns -1 if the name is unknown.
+  Sat_IfaceTypesByNames() parses a comma-separated list of names and
+  returns NULL if one of them is unknown.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+char * Sat_IfaceTypeName( int Type )
+{
+    assert( Type >= 0 && Type < SAT_IFACE_NUM );
+    return s_SatIfaceNames[Type];
+}
+int Sat_IfaceTypeByName( char * pName )
+{
+    int Type;
+    for ( Type = 0; Type < SAT_IFACE_NUM; Type++ )
+        if ( !strcmp(pName, s_SatIfaceNames[Type]) )
+            return Type;
+    return -1;
+}
+Vec_Int_t * Sat_IfaceTypesByNames( char * pNames )
+{
+    Vec_Int_t * vTypes = Vec_IntAlloc( 4 );
+    char * pCopy = Abc_UtilStrsav( pNames ), * pName;
+    for ( pName = strtok(pCopy, ","); pName; pName = strtok(NULL, ",") )
+    {
+        int Type = Sat_IfaceTypeByName( pName );
+        if ( Type == -1 )
+        {
+            Vec_IntFreeP( &vTypes );
+            break;
+        }
+        Vec_IntPush( vTypes, Type );
+    }
+    ABC_FREE( pCopy );
+    if ( vTypes && Vec_IntSize(vTypes) == 0 )
+        Vec_IntFreeP( &vTypes );
+    return vTypes;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Starts and stops the solver.]
+
+  Description [Reset removes all variables and clauses. The portfolio
+  started by Sat_IfaceStart() contains two instances of Satoko and two
+  instances of Glucose. Sat_IfaceStartPortfolio() takes the list of 
+  solver types.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Sat_Iface_t * Sat_IfaceStart( int Type )
+{
+    Sat_Iface_t * p = ABC_CALLOC( Sat_Iface_t, 1 );
+    p->Type = Type;
+    if ( Type == SAT_IFACE_BSAT )
+        p->pSat = sat_solver_new();
+    else if ( Type == SAT_IFACE_SATOKO )
+        p->pSat = satoko_create();
+    else if ( Type == SAT_IFACE_GLUCOSE )
+        p->pSat = bmcg_sat_solver_start();
+    else if ( Type == SAT_IFACE_PORT )
+        p->pSat = Sat_PortStart( NULL );
+    else assert( 0 );
+    return p;
+}
+Sat_Iface_t * Sat_IfaceStartPortfolio( Vec_Int_t * vTypes )
+{
+    Sat_Iface_t * p = ABC_CALLOC( Sat_Iface_t, 1 );
+    p->Type = SAT_IFACE_PORT;
+    p->pSat = Sat_PortStart( vTypes );
+    return p;
+}
+void Sat_IfaceStop( Sat_Iface_t * p )
+{
+    if ( p->Type == SAT_IFACE_BSAT )
+        sat_solver_delete( Sat_IfaceBsat(p) );
+    else if ( p->Type == SAT_IFACE_SATOKO )
+        satoko_destroy( Sat_IfaceSatoko(p) );
+    else if ( p->Type == SAT_IFACE_GLUCOSE )
+        bmcg_sat_solver_stop( Sat_IfaceGlucose(p) );
+    else if ( p->Type == SAT_IFACE_PORT )
+        Sat_PortStop( Sat_IfacePort(p) );
+    ABC_FREE( p );
+}
+void Sat_IfaceReset( Sat_Iface_t * p )
+{
+    if ( p->Type == SAT_IFACE_BSAT )
+        sat_solver_restart( Sat_IfaceBsat(p) );
+    else if ( p->Type == SAT_IFACE_SATOKO )
+        satoko_reset( Sat_IfaceSatoko(p) );
+    else if ( p->Type == SAT_IFACE_GLUCOSE )
+        bmcg_sat_solver_reset( Sat_IfaceGlucose(p) );
+    else if ( p->Type == SAT_IFACE_PORT )
+        Sat_PortReset( Sat_IfacePort(p) );
+}
+int Sat_IfaceType( Sat_Iface_t * p )
+{
+    return p->Type;
+}
+void * Sat_IfaceSolver( Sat_Iface_t * p )
+{
+    return p->pSat;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Adds variables and clauses.]
+
+  Description [Sat_IfaceAddVar() returns the new variable.
+  Sat_IfaceAddClause() returns 0 if the problem is found to be UNSAT.
+  The variables of the clause are added if needed.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Sat_IfaceAddVar( Sat_Iface_t * p )
+{
+    if ( p->Type == SAT_IFACE_BSAT )
+        return sat_solver_addvar( Sat_IfaceBsat(p) );
+    if ( p->Type == SAT_IFACE_SATOKO )
+        return satoko_add_variable( Sat_IfaceSatoko(p), 0 );
+    if ( p->Type == SAT_IFACE_PORT )
+        return Sat_PortAddVar( Sat_IfacePort(p) );
+    return bmcg_sat_solver_addvar( Sat_IfaceGlucose(p) );
+}
+void Sat_IfaceSetVarNum( Sat_Iface_t * p, int nVars )
+{
+    if ( p->Type == SAT_IFACE_BSAT )
+        sat_solver_setnvars( Sat_IfaceBsat(p), nVars );
+    else if ( p->Type == SAT_IFACE_SATOKO )
+        satoko_setnvars( Sat_IfaceSatoko(p), nVars );
+    else if ( p->Type == SAT_IFACE_PORT )
+    {
+        int i;
+        for ( i = 0; i < Sat_PortSolverNum(Sat_IfacePort(p)); i++ )
+            Sat_IfaceSetVarNum( Sat_PortSolver(Sat_IfacePort(p), i), nVars );
+    }
+    else
+        while ( bmcg_sat_solver_varnum(Sat_IfaceGlucose(p)) < nVars )
+            bmcg_sat_solver_addvar( Sat_IfaceGlucose(p) );
+}
+int Sat_IfaceVarNum( Sat_Iface_t * p )
+{
+    if ( p->Type == SAT_IFACE_BSAT )
+        return sat_solver_nvars( Sat_IfaceBsat(p) );
+    if ( p->Type == SAT_IFACE_SATOKO )
+        return satoko_varnum( Sat_IfaceSatoko(p) );
+    if ( p->Type == SAT_IFACE_PORT )
+        return Sat_IfaceVarNum( Sat_PortSolver(Sat_IfacePort(p), 0) );
+    return bmcg_sat_solver_varnum( Sat_IfaceGlucose(p) );
+}
+int Sat_IfaceAddClause( Sat_Iface_t * p, int * pLits, int nLits )
+{
+    assert( nLits > 0 );
+    if ( p->Type == SAT_IFACE_BSAT )
+        return sat_solver_addclause( Sat_IfaceBsat(p), pLits, pLits + nLits );
+    if ( p->Type == SAT_IFACE_SATOKO )
+        return satoko_add_clause( Sat_IfaceSatoko(p), pLits, nLits ) == SATOKO_OK;
+    if ( p->Type == SAT_IFACE_PORT )
+        return Sat_PortAddClause( Sat_IfacePort(p), pLits, nLits );
+    return bmcg_sat_solver_addclause( Sat_IfaceGlucose(p), pLits, nLits );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Solves the problem under assumptions.]
+
+  Description [Returns SAT_IFACE_SAT/UNSAT/UNDEC. The conflict limit
+  set by Sat_IfaceSetConflictLimit() applies to each call. If the problem
+  is UNSAT, Sat_IfaceFinal() returns the assumptions responsible for it,
+  in the complemented form. If the problem is SAT, Sat_IfaceVarValue()
+  returns the values of the variables.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Sat_IfaceSolve( Sat_Iface_t * p, int * pLits, int nLits )
+{
+    if ( p->Type == SAT_IFACE_BSAT )
+        return sat_solver_solve( Sat_IfaceBsat(p), pLits, pLits + nLits, (ABC_INT64_T)p->nConfLimit, 0, 0, 0 );
+    if ( p->Type == SAT_IFACE_SATOKO )
+    {
+        if ( p->nConfLimit == 0 )
+            return satoko_solve_assumptions( Sat_IfaceSatoko(p), pLits, nLits );
+        return satoko_solve_assumptions_limit( Sat_IfaceSatoko(p), pLits, nLits, p->nConfLimit );
+    }
+    if ( p->Type == SAT_IFACE_PORT )
+    {
+        int i;
+        for ( i = 0; i < Sat_PortSolverNum(Sat_IfacePort(p)); i++ )
+            Sat_IfaceSetConflictLimit( Sat_PortSolver(Sat_IfacePort(p), i), p->nConfLimit );
+        return Sat_PortSolve( Sat_IfacePort(p), pLits, nLits );
+    }
+    bmcg_sat_solver_set_conflict_budget( Sat_IfaceGlucose(p), p->nConfLimit );
+    return bmcg_sat_solver_solve( Sat_IfaceGlucose(p), pLits, nLits );
+}
+int Sat_IfaceFinal( Sat_Iface_t * p, int ** ppLits )
+{
+    if ( p->Type == SAT_IFACE_BSAT )
+        return sat_solver_final( Sat_IfaceBsat(p), ppLits );
+    if ( p->Type == SAT_IFACE_SATOKO )
+        return satoko_final_conflict( Sat_IfaceSatoko(p), ppLits );
+    if ( p->Type == SAT_IFACE_PORT )
+        return Sat_IfaceFinal( Sat_IfacePortBest(p), ppLits );
+    return bmcg_sat_solver_final( Sat_IfaceGlucose(p), ppLits );
+}
+int Sat_IfaceVarValue( Sat_Iface_t * p, int iVar )
+{
+    if ( p->Type == SAT_IFACE_BSAT )
+        return sat_solver_var_value( Sat_IfaceBsat(p), iVar );
+    if ( p->Type == SAT_IFACE_SATOKO )
+        return satoko_read_cex_varvalue( Sat_IfaceSatoko(p), iVar );
+    if ( p->Type == SAT_IFACE_PORT )
+        return Sat_IfaceVarValue( Sat_IfacePortBest(p), iVar );
+    return bmcg_sat_solver_read_cex_varvalue( Sat_IfaceGlucose(p), iVar );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Records the state of the solver and returns to it.]
+
+  Description [The rollback removes the variables and clauses added
+  after the bookmark. Returns 0 if the solver does not support it.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Sat_IfaceBookmark( Sat_Iface_t * p )
+{
+    if ( p->Type == SAT_IFACE_BSAT )
+        sat_solver_bookmark( Sat_IfaceBsat(p) );
+    else if ( p->Type == SAT_IFACE_SATOKO )
+        satoko_bookmark( Sat_IfaceSatoko(p) );
+    else
+        return 0;
+    return 1;
+}
+int Sat_IfaceRollback( Sat_Iface_t * p )
+{
+    if ( p->Type == SAT_IFACE_BSAT )
+        sat_solver_rollback( Sat_IfaceBsat(p) );
+    else if ( p->Type == SAT_IFACE_SATOKO )
+        satoko_rollback( Sat_IfaceSatoko(p) );
+    else
+        return 0;
+    return 1;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Restricts the decisions to the cone of the given variables.]
+
+  Description [This is a hint, which is ignored by the solvers that
+  do not support it.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Sat_IfaceMarkCone( Sat_Iface_t * p, int * pVars, int nVars )
+{
+    if ( p->Type == SAT_IFACE_SATOKO )
+        satoko_mark_cone( Sat_IfaceSatoko(p), pVars, nVars );
+}
+void Sat_IfaceUnmarkCone( Sat_Iface_t * p, int * pVars, int nVars )
+{
+    if ( p->Type == SAT_IFACE_SATOKO )
+        satoko_unmark_cone( Sat_IfaceSatoko(p), pVars, nVars );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Sets the resource limits.]
+
+  Description [The runtime limit is the absolute time, as in the solvers.
+  The stop flag is checked by the solvers when they restart.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Sat_IfaceSetConflictLimit( Sat_Iface_t * p, int nConfLimit )
+{
+    p->nConfLimit = nConfLimit;
+}
+abctime Sat_IfaceSetRuntimeLimit( Sat_Iface_t * p, abctime Limit )
+{
+    if ( p->Type == SAT_IFACE_BSAT )
+        return sat_solver_set_runtime_limit( Sat_IfaceBsat(p), Limit );
+    if ( p->Type == SAT_IFACE_SATOKO )
+        return satoko_set_runtime_limit( Sat_IfaceSatoko(p), Limit );
+    if ( p->Type == SAT_IFACE_PORT )
+    {
+        int i; abctime LimitOld = 0;
+        for ( i = 0; i < Sat_PortSolverNum(Sat_IfacePort(p)); i++ )
+            LimitOld = Sat_IfaceSetRuntimeLimit( Sat_PortSolver(Sat_IfacePort(p), i), Limit );
+        return LimitOld;
+    }
+    return bmcg_sat_solver_set_runtime_limit( Sat_IfaceGlucose(p), Limit );
+}
+void Sat_IfaceSetStop( Sat_Iface_t * p, int * pStop )
+{
+    if ( p->Type == SAT_IFACE_BSAT )
+        sat_solver_set_stop( Sat_IfaceBsat(p), pStop );
+    else if ( p->Type == SAT_IFACE_SATOKO )
+        satoko_set_stop( Sat_IfaceSatoko(p), pStop );
+    else if ( p->Type == SAT_IFACE_PORT )
+        Sat_PortSetStop( Sat_IfacePort(p), pStop );
+    else
+        bmcg_sat_solver_set_stop( Sat_IfaceGlucose(p), pStop );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Diversifies the solvers working on the same problem.]
+
+  Description [Seed 0 keeps the default settings. Other seeds change
+  the restart and decision heuristics. Should be called before adding
+  the clauses.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Sat_IfaceSetSeed( Sat_Iface_t * p, int Seed )
+{
+    if ( p->Type == SAT_IFACE_BSAT )
+        Sat_IfaceBsat(p)->random_seed = 91648253 + 7919 * Seed;
+    else if ( p->Type == SAT_IFACE_SATOKO )
+    {
+        satoko_opts_t opts;
+        satoko_default_opts( &opts );
+        if ( Seed )
+        {
+            opts.var_decay = 0.95 - 0.02 * (Seed % 3);
+            opts.f_rst     = 0.8 - 0.05 * (Seed % 2);
+            opts.b_rst     = 1.4 + 0.1 * (Seed % 3);
+        }
+        satoko_configure( Sat_IfaceSatoko(p), &opts );
+    }
+    else if ( p->Type == SAT_IFACE_GLUCOSE )
+        bmcg_sat_solver_set_seed( Sat_IfaceGlucose(p), Seed );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Attaches the solver to the buffer of shared learnt clauses.]
+
+  Description [The solvers attached to the same buffer should be given
+  the same variables and clauses in the same order. Returns 0 if the 
+  solver cannot share clauses. Detaches the solver if pShare is NULL.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Sat_IfaceSetShare( Sat_Iface_t * p, Sat_Share_t * pShare, int iSolver )
+{
+    void * pData = pShare ? Sat_ShareSolverData( pShare, iSolver ) : NULL;
+    if ( p->Type == SAT_IFACE_SATOKO )
+        satoko_set_share( Sat_IfaceSatoko(p), pData, pShare ? Sat_ShareExport : NULL, pShare ? Sat_ShareImport : NULL );
+    else if ( p->Type == SAT_IFACE_GLUCOSE )
+        bmcg_sat_solver_set_share( Sat_IfaceGlucose(p), pData, pShare ? Sat_ShareExport : NULL, pShare ? Sat_ShareImport : NULL );
+    else
+        return 0;
+    return 1;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Returns the statistics of the solver.]
+
+  Description [For the portfolio, the conflicts of all solvers are counted,
+  while the clauses are those of the solver that returned the last answer.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Sat_IfaceClauseNum( Sat_Iface_t * p )
+{
+    if ( p->Type == SAT_IFACE_BSAT )
+        return sat_solver_nclauses( Sat_IfaceBsat(p) );
+    if ( p->Type == SAT_IFACE_SATOKO )
+        return satoko_clausenum( Sat_IfaceSatoko(p) );
+    if ( p->Type == SAT_IFACE_PORT )
+        return Sat_IfaceClauseNum( Sat_IfacePortBest(p) );
+    return bmcg_sat_solver_clausenum( Sat_IfaceGlucose(p) );
+}
+int Sat_IfaceLearntNum( Sat_Iface_t * p )
+{
+    if ( p->Type == SAT_IFACE_BSAT )
+        return (int)Sat_IfaceBsat(p)->stats.learnts;
+    if ( p->Type == SAT_IFACE_SATOKO )
+        return satoko_learntnum( Sat_IfaceSatoko(p) );
+    if ( p->Type == SAT_IFACE_PORT )
+        return Sat_IfaceLearntNum( Sat_IfacePortBest(p) );
+    return bmcg_sat_solver_learntnum( Sat_IfaceGlucose(p) );
+}
+int Sat_IfaceConflictNum( Sat_Iface_t * p )
+{
+    if ( p->Type == SAT_IFACE_BSAT )
+        return sat_solver_nconflicts( Sat_IfaceBsat(p) );
+    if ( p->Type == SAT_IFACE_SATOKO )
+        return satoko_conflictnum( Sat_IfaceSatoko(p) );
+    if ( p->Type == SAT_IFACE_PORT )
+    {
+        int i, nConfs = 0;
+        for ( i = 0; i < Sat_PortSolverNum(Sat_IfacePort(p)); i++ )
+            nConfs += Sat_IfaceConflictNum( Sat_PortSolver(Sat_IfacePort(p), i) );
+        return nConfs;
+    }
+    return bmcg_sat_solver_conflictnum( Sat_IfaceGlucose(p) );
+}
+
+////////////////////////////////////////////////////////////////////////
+///                       END OF FILE                                ///
+////////////////////////////////////////////////////////////////////////
+
+
+ABC_NAMESPACE_IMPL_END
+
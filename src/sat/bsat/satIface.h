@@ -0,0 +1,131 @@
+/**CFile****************************************************************
+
+  FileName    [satIface.h]
+
+  SystemName  [ABC: Logic synthesis and verification system.]
+
+  PackageName [SAT solver.]
+
+  Synopsis    [Common interface to the incremental SAT solvers.]
+
+  Author      [Alan Mishchenko]
+
+  Affiliation [UC Berkeley]
+
+  Date        [Ver. 1.0. Started - June 20, 2005.]
+
+  Revision    [$Id: satIface.h,v 1.00 2005/06/20 00:00:00 alanmi Exp $]
+
+***********************************************************************/
+
+#ifndef ABC__sat__bsat__satIface_h
+#define ABC__sat__bsat__satIface_h
+
+
+////////////////////////////////////////////////////////////////////////
+///                          INCLUDES                                ///
+////////////////////////////////////////////////////////////////////////
+
+#include "misc/util/abc_global.h"
+#include "misc/vec/vec.h"
+
+////////////////////////////////////////////////////////////////////////
+///                         PARAMETERS                               ///
+////////////////////////////////////////////////////////////////////////
+
+ABC_NAMESPACE_HEADER_START
+
+#define SAT_IFACE_UNSAT -1
+#define SAT_IFACE_UNDEC  0
+#define SAT_IFACE_SAT    1
+
+// the solvers available through the interface
+typedef enum {
+    SAT_IFACE_BSAT = 0,        // 0: MiniSat-based solver (sat/bsat)
+    SAT_IFACE_SATOKO,          // 1: Satoko (sat/satoko)
+    SAT_IFACE_GLUCOSE,         // 2: Glucose 3.0 (sat/glucose)
+    SAT_IFACE_PORT,            // 3: portfolio of the above solvers sharing learnt clauses
+    SAT_IFACE_NUM              // 4: unused
+} Sat_IfaceType_t;
+
+////////////////////////////////////////////////////////////////////////
+///                         BASIC TYPES                              ///
+////////////////////////////////////////////////////////////////////////
+
+// The solver is selected when it is started. The variables are numbered
+// from 0 and the literals are encoded as in Abc_Var2Lit() for all solvers.
+// The solvers may reorder the literals of the clauses added by the user.
+typedef struct Sat_Iface_t_ Sat_Iface_t;
+
+// The learnt clauses are exchanged through a ring buffer. Each solver 
+// attached to the buffer exports its short learnt clauses and imports 
+// the clauses exported by the other solvers when it restarts.
+typedef struct Sat_Share_t_ Sat_Share_t;
+
+// The portfolio runs several solvers on the same problem in parallel.
+// The solvers share learnt clauses and the first definite answer stops
+// the other solvers.
+typedef struct Sat_Port_t_  Sat_Port_t;
+
+////////////////////////////////////////////////////////////////////////
+///                    FUNCTION DECLARATIONS                         ///
+////////////////////////////////////////////////////////////////////////
+
+/*=== satIface.c ==========================================================*/
+extern char *        Sat_IfaceTypeName( int Type );
+extern int           Sat_IfaceTypeByName( char * pName );
+extern Vec_Int_t *   Sat_IfaceTypesByNames( char * pNames );
+extern Sat_Iface_t * Sat_IfaceStart( int Type );
+extern Sat_Iface_t * Sat_IfaceStartPortfolio( Vec_Int_t * vTypes );
+extern void          Sat_IfaceStop( Sat_Iface_t * p );
+extern void          Sat_IfaceReset( Sat_Iface_t * p );
+extern int           Sat_IfaceType( Sat_Iface_t * p );
+extern void *        Sat_IfaceSolver( Sat_Iface_t * p );
+extern int           Sat_IfaceAddVar( Sat_Iface_t * p );
+extern void          Sat_IfaceSetVarNum( Sat_Iface_t * p, int nVars );
+extern int           Sat_IfaceVarNum( Sat_Iface_t * p );
+extern int           Sat_IfaceAddClause( Sat_Iface_t * p, int * pLits, int nLits );
+extern int           Sat_IfaceSolve( Sat_Iface_t * p, int * pLits, int nLits );
+extern int           Sat_IfaceFinal( Sat_Iface_t * p, int ** ppLits );
+extern int           Sat_IfaceVarValue( Sat_Iface_t * p, int iVar );
+extern int           Sat_IfaceBookmark( Sat_Iface_t * p );
+extern int           Sat_IfaceRollback( Sat_Iface_t * p );
+extern void          Sat_IfaceMarkCone( Sat_Iface_t * p, int * pVars, int nVars );
+extern void          Sat_IfaceUnmarkCone( Sat_Iface_t * p, int * pVars, int nVars );
+extern void          Sat_IfaceSetConflictLimit( Sat_Iface_t * p, int nConfLimit );
+extern abctime       Sat_IfaceSetRuntimeLimit( Sat_Iface_t * p, abctime Limit );
+extern void          Sat_IfaceSetStop( Sat_Iface_t * p, int * pStop );
+extern void          Sat_IfaceSetSeed( Sat_Iface_t * p, int Seed );
+extern int           Sat_IfaceSetShare( Sat_Iface_t * p, Sat_Share_t * pShare, int iSolver );
+extern int           Sat_IfaceClauseNum( Sat_Iface_t * p );
+extern int           Sat_IfaceLearntNum( Sat_Iface_t * p );
+extern int           Sat_IfaceConflictNum( Sat_Iface_t * p );
+/*=== satPort.c ==========================================================*/
+extern Sat_Share_t * Sat_ShareStart( int nSolvers );
+extern void          Sat_ShareStop( Sat_Share_t * p );
+extern void          Sat_ShareReset( Sat_Share_t * p );
+extern void          Sat_ShareSetStop( Sat_Share_t * p, int * pStopUser, int * pStopAll );
+extern void *        Sat_ShareSolverData( Sat_Share_t * p, int iSolver );
+extern void          Sat_ShareExport( void * pData, int * pLits, int nLits, int Lbd );
+extern int           Sat_ShareImport( void * pData, int ** ppLits );
+extern void          Sat_SharePrintStats( Sat_Share_t * p );
+extern Sat_Port_t *  Sat_PortStart( Vec_Int_t * vTypes );
+extern void          Sat_PortStop( Sat_Port_t * p );
+extern void          Sat_PortReset( Sat_Port_t * p );
+extern int           Sat_PortSolverNum( Sat_Port_t * p );
+extern Sat_Iface_t * Sat_PortSolver( Sat_Port_t * p, int i );
+extern int           Sat_PortWinner( Sat_Port_t * p );
+extern int           Sat_PortAddVar( Sat_Port_t * p );
+extern int           Sat_PortAddClause( Sat_Port_t * p, int * pLits, int nLits );
+extern int           Sat_PortSolve( Sat_Port_t * p, int * pLits, int nLits );
+extern void          Sat_PortSetStop( Sat_Port_t * p, int * pStop );
+extern void          Sat_PortPrintStats( Sat_Port_t * p );
+
+ABC_NAMESPACE_HEADER_END
+
+#endif
+
+////////////////////////////////////////////////////////////////////////
+///                       END OF FILE                                ///
+////////////////////////////////////////////////////////////////////////
+
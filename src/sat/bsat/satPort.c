@@ -0,0 +1,436 @@
+/**CFile****************************************************************
+
+  FileName    [satPort.c]
+
+  SystemName  [ABC: Logic synthesis and verification system.]
+
+  PackageName [SAT solver.]
+
+  Synopsis    [Portfolio of incremental SAT solvers sharing learnt clauses.]
+
+  Author      [Alan Mishchenko]
+
+  Affiliation [UC Berkeley]
+
+  Date        [Ver. 1.0. Started - June 20, 2005.]
+
+  Revision    [$Id: satPort.c,v 1.00 2005/06/20 00:00:00 alanmi Exp $]
+
+***********************************************************************/
+
+#include "satIface.h"
+#include "misc/util/utilTask.h"
+
+#if defined(_MSC_VER)
+#include <windows.h>
+#endif
+
+ABC_NAMESPACE_IMPL_START
+
+////////////////////////////////////////////////////////////////////////
+///                        DECLARATIONS                              ///
+////////////////////////////////////////////////////////////////////////
+
+#define SAT_SHARE_LOG      14               // the log2 of the number of entries in the ring
+#define SAT_SHARE_SIZE    (1 << SAT_SHARE_LOG)
+#define SAT_SHARE_MASK    (SAT_SHARE_SIZE - 1)
+#define SAT_SHARE_LITS     16               // the max number of literals in a shared clause
+#define SAT_PORT_MAX       16               // the max number of solvers in the portfolio
+
+// atomic operations used by the lock-free ring buffer
+#if defined(__GNUC__)
+#define Sat_AtomicInc( p )          __sync_fetch_and_add( (p), 1 )
+#define Sat_AtomicCas( p, o, n )    __sync_bool_compare_and_swap( (p), (o), (n) )
+#define Sat_AtomicBarrier()         __sync_synchronize()
+#elif defined(_MSC_VER)
+#define Sat_AtomicInc( p )          ((unsigned)InterlockedIncrement( (volatile LONG *)(p) ) - 1)
+#define Sat_AtomicCas( p, o, n )    (InterlockedCompareExchange( (volatile LONG *)(p), (LONG)(n), (LONG)(o) ) == (LONG)(o))
+#define Sat_AtomicBarrier()         MemoryBarrier()
+#else
+static inline unsigned Sat_AtomicInc( volatile unsigned * p )                 { return (*p)++;                         }
+static inline int      Sat_AtomicCas( volatile unsigned * p, unsigned o, unsigned n ) { if ( *p != o ) return 0; *p = n; return 1; }
+#define Sat_AtomicBarrier()
+#endif
+
+// The entry of the ring is written by one solver at a time. The writer
+// makes the sequence number odd while it copies the clause and then
+// sets it to 2*(Pos+1), where Pos is the position of the clause in the
+// stream of clauses. The reader checks the sequence number before and
+// after copying the clause and drops the clause if it was overwritten.
+typedef struct Sat_ShareEntry_t_ Sat_ShareEntry_t;
+struct Sat_ShareEntry_t_
+{
+    volatile unsigned Seq;              // the sequence number
+    int               iSolver;          // the solver that exported the clause
+    int               nLits;            // the number of literals
+    int               pLits[SAT_SHARE_LITS]; // the literals
+};
+
+typedef struct Sat_ShareSolver_t_ Sat_ShareSolver_t;
+struct Sat_ShareSolver_t_
+{
+    Sat_Share_t *     pShare;           // the buffer
+    int               iSolver;          // the solver
+    unsigned          iRead;            // the position of the next clause to import
+    int               pLits[SAT_SHARE_LITS]; // the literals of the imported clause
+    int               nExported;        // statistics
+    int               nImported;        // statistics
+};
+
+struct Sat_Share_t_
+{
+    int               nSolvers;         // the number of solvers
+    int               nSizeMax;         // the clauses of this size or smaller are shared
+    int               nLbdMax;          // the clauses with this LBD or smaller are shared
+    volatile unsigned iWrite;           // the position of the next clause to export
+    Sat_ShareEntry_t * pEntries;        // the ring
+    Sat_ShareSolver_t * pSolvers;       // the solvers
+    int *             pStopUser;        // the user's flag to stop the solvers
+    int *             pStopAll;         // the flag checked by the solvers
+};
+
+typedef struct Sat_PortTask_t_ Sat_PortTask_t;
+struct Sat_PortTask_t_
+{
+    Sat_Port_t *      pPort;            // the portfolio
+    int               iSolver;          // the solver
+    int               Status;           // the result of the last call
+};
+
+struct Sat_Port_t_
+{
+    int               nSolvers;         // the number of solvers
+    Sat_Iface_t *     pSats[SAT_PORT_MAX];   // the solvers
+    Sat_PortTask_t    pTasks[SAT_PORT_MAX];  // the tasks
+    Sat_Share_t *     pShare;           // the shared clauses
+    Util_Pool_t *     pPool;            // the threads
+    int *             pLits;            // the assumptions of the current call
+    int               nLits;            // the number of assumptions
+    volatile int      fStop;            // the flag to stop the solvers
+    volatile unsigned iWinner;          // the solver that returned the answer
+    int               nWins[SAT_PORT_MAX];   // statistics
+    int               nCalls;           // statistics
+};
+
+////////////////////////////////////////////////////////////////////////
+///                     FUNCTION DEFINITIONS                         ///
+////////////////////////////////////////////////////////////////////////
+
+/**Function*************************************************************
+
+  Synopsis    [Starts and stops the buffer of shared clauses.]
+
+  Description [By default, the learnt clauses with at most 8 literals
+  or with LBD at most 2 are shared.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Sat_Share_t * Sat_ShareStart( int nSolvers )
+{
+    Sat_Share_t * p = ABC_CALLOC( Sat_Share_t, 1 );
+    int i;
+    p->nSolvers = nSolvers;
+    p->nSizeMax = 8;
+    p->nLbdMax  = 2;
+    p->pEntries = ABC_CALLOC( Sat_ShareEntry_t, SAT_SHARE_SIZE );
+    p->pSolvers = ABC_CALLOC( Sat_ShareSolver_t, nSolvers );
+    for ( i = 0; i < nSolvers; i++ )
+    {
+        p->pSolvers[i].pShare  = p;
+        p->pSolvers[i].iSolver = i;
+    }
+    return p;
+}
+void Sat_ShareStop( Sat_Share_t * p )
+{
+    ABC_FREE( p->pEntries );
+    ABC_FREE( p->pSolvers );
+    ABC_FREE( p );
+}
+void Sat_ShareReset( Sat_Share_t * p )
+{
+    int i;
+    p->iWrite = 0;
+    memset( p->pEntries, 0, sizeof(Sat_ShareEntry_t) * SAT_SHARE_SIZE );
+    for ( i = 0; i < p->nSolvers; i++ )
+        p->pSolvers[i].iRead = 0;
+}
+void Sat_ShareSetStop( Sat_Share_t * p, int * pStopUser, int * pStopAll )
+{
+    p->pStopUser = pStopUser;
+    p->pStopAll  = pStopAll;
+}
+void * Sat_ShareSolverData( Sat_Share_t * p, int iSolver )
+{
+    assert( iSolver >= 0 && iSolver < p->nSolvers );
+    return (void *)(p->pSolvers + iSolver);
+}
+void Sat_SharePrintStats( Sat_Share_t * p )
+{
+    int i;
+    printf( "Shared clauses:" );
+    for ( i = 0; i < p->nSolvers; i++ )
+        printf( "  S%d = %d/%d", i, p->pSolvers[i].nExported, p->pSolvers[i].nImported );
+    printf( "  (exported/imported)\n" );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Exports and imports the learnt clauses.]
+
+  Description [These are the callbacks called by the solvers.
+  The export drops the clause if the entry is being written by another
+  solver or already holds a clause from a later lap (a faster writer has 
+  wrapped around the buffer). The import returns the size of the next clause exported by
+  the other solvers, or -1 if there are no more clauses. It stops at the
+  first entry whose position is reserved but not yet written (the entry
+  still holds a sequence number from an earlier lap), and resumes there
+  next time. The clauses overwritten before being imported are lost
+  (the entry holds a sequence number from a later lap). The import also passes
+  the user's request to stop to the solvers.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Sat_ShareExport( void * pData, int * pLits, int nLits, int Lbd )
+{
+    Sat_ShareSolver_t * pSol = (Sat_ShareSolver_t *)pData;
+    Sat_Share_t * p = pSol->pShare;
+    Sat_ShareEntry_t * pEntry;
+    unsigned iPos, Seq;
+    if ( nLits > SAT_SHARE_LITS || (nLits > p->nSizeMax && Lbd > p->nLbdMax) )
+        return;
+    iPos = Sat_AtomicInc( &p->iWrite );
+    pEntry = p->pEntries + (iPos & SAT_SHARE_MASK);
+    Seq = pEntry->Seq;
+    if ( (Seq & 1) || (int)(Seq - 2 * iPos) > 0 ) // being written or from a later lap
+        return;
+    if ( !Sat_AtomicCas( &pEntry->Seq, Seq, 2 * iPos + 1 ) )
+        return;
+    pEntry->iSolver = pSol->iSolver;
+    pEntry->nLits   = nLits;
+    memcpy( pEntry->pLits, pLits, sizeof(int) * nLits );
+    Sat_AtomicBarrier();
+    pEntry->Seq = 2 * iPos + 2;
+    pSol->nExported++;
+}
+int Sat_ShareImport( void * pData, int ** ppLits )
+{
+    Sat_ShareSolver_t * pSol = (Sat_ShareSolver_t *)pData;
+    Sat_Share_t * p = pSol->pShare;
+    Sat_ShareEntry_t * pEntry;
+    unsigned iWrite = p->iWrite, Seq;
+    int nLits;
+    if ( iWrite - pSol->iRead > SAT_SHARE_SIZE )
+        pSol->iRead = iWrite - SAT_SHARE_SIZE;
+    for ( ; pSol->iRead != iWrite; pSol->iRead++ )
+    {
+        pEntry = p->pEntries + (pSol->iRead & SAT_SHARE_MASK);
+        Seq = pEntry->Seq;
+        if ( (int)(Seq - (2 * pSol->iRead + 2)) < 0 ) // not yet written or still being written
+            break;
+        if ( Seq != 2 * pSol->iRead + 2 || pEntry->iSolver == pSol->iSolver ) // overwritten or own
+            continue;
+        Sat_AtomicBarrier();
+        nLits = pEntry->nLits;
+        if ( nLits > SAT_SHARE_LITS )
+            continue;
+        memcpy( pSol->pLits, pEntry->pLits, sizeof(int) * nLits );
+        Sat_AtomicBarrier();
+        if ( pEntry->Seq != Seq )
+            continue;
+        pSol->iRead++;
+        pSol->nImported++;
+        *ppLits = pSol->pLits;
+        return nLits;
+    }
+    if ( p->pStopUser && *p->pStopUser && p->pStopAll )
+        *p->pStopAll = 1;
+    return -1;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Starts and stops the portfolio.]
+
+  Description [If vTypes is NULL, the portfolio contains two instances
+  of Satoko and two instances of Glucose. The instances of the same
+  solver use different seeds. The bsat solvers take part in the race
+  but do not share the clauses.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Sat_Port_t * Sat_PortStart( Vec_Int_t * vTypes )
+{
+    int pTypesDef[4] = { SAT_IFACE_SATOKO, SAT_IFACE_GLUCOSE, SAT_IFACE_SATOKO, SAT_IFACE_GLUCOSE };
+    int pSeeds[SAT_IFACE_NUM] = {0};
+    Sat_Port_t * p = ABC_CALLOC( Sat_Port_t, 1 );
+    int i, Type;
+    p->nSolvers = vTypes ? Abc_MinInt( Vec_IntSize(vTypes), SAT_PORT_MAX ) : 4;
+    p->pShare   = Sat_ShareStart( p->nSolvers );
+    Sat_ShareSetStop( p->pShare, NULL, (int *)&p->fStop );
+    for ( i = 0; i < p->nSolvers; i++ )
+    {
+        Type = vTypes ? Vec_IntEntry(vTypes, i) : pTypesDef[i];
+        assert( Type != SAT_IFACE_PORT );
+        p->pSats[i] = Sat_IfaceStart( Type );
+        Sat_IfaceSetSeed( p->pSats[i], pSeeds[Type]++ );
+        Sat_IfaceSetShare( p->pSats[i], p->pShare, i );
+        Sat_IfaceSetStop( p->pSats[i], (int *)&p->fStop );
+        p->pTasks[i].pPort   = p;
+        p->pTasks[i].iSolver = i;
+    }
+    p->iWinner = ~0;
+#ifdef ABC_USE_PTHREADS
+    if ( p->nSolvers > 1 )
+        p->pPool = Util_PoolStart( p->nSolvers );
+#endif
+    return p;
+}
+void Sat_PortStop( Sat_Port_t * p )
+{
+    int i;
+    if ( p->pPool )
+        Util_PoolStop( p->pPool );
+    for ( i = 0; i < p->nSolvers; i++ )
+        Sat_IfaceStop( p->pSats[i] );
+    Sat_ShareStop( p->pShare );
+    ABC_FREE( p );
+}
+void Sat_PortReset( Sat_Port_t * p )
+{
+    int pSeeds[SAT_IFACE_NUM] = {0};
+    int i, Type;
+    for ( i = 0; i < p->nSolvers; i++ )
+    {
+        Type = Sat_IfaceType( p->pSats[i] );
+        Sat_IfaceReset( p->pSats[i] );
+        Sat_IfaceSetSeed( p->pSats[i], pSeeds[Type]++ );
+    }
+    Sat_ShareReset( p->pShare );
+    p->iWinner = ~0;
+}
+int Sat_PortSolverNum( Sat_Port_t * p )
+{
+    return p->nSolvers;
+}
+Sat_Iface_t * Sat_PortSolver( Sat_Port_t * p, int i )
+{
+    assert( i >= 0 && i < p->nSolvers );
+    return p->pSats[i];
+}
+int Sat_PortWinner( Sat_Port_t * p )
+{
+    return (int)p->iWinner;
+}
+void Sat_PortSetStop( Sat_Port_t * p, int * pStop )
+{
+    Sat_ShareSetStop( p->pShare, pStop, (int *)&p->fStop );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Adds variables and clauses to all solvers.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Sat_PortAddVar( Sat_Port_t * p )
+{
+    int i, iVar = Sat_IfaceAddVar( p->pSats[0] );
+    for ( i = 1; i < p->nSolvers; i++ )
+    {
+        int iVar2 = Sat_IfaceAddVar( p->pSats[i] );
+        assert( iVar2 == iVar ); (void)iVar2;
+    }
+    return iVar;
+}
+int Sat_PortAddClause( Sat_Port_t * p, int * pLits, int nLits )
+{
+    // the solvers may reorder the literals
+    int i, RetValue = 1, pTemp[SAT_SHARE_LITS], * pCopy = nLits <= SAT_SHARE_LITS ? pTemp : ABC_ALLOC( int, nLits );
+    for ( i = 0; i < p->nSolvers; i++ )
+    {
+        memcpy( pCopy, pLits, sizeof(int) * nLits );
+        RetValue &= Sat_IfaceAddClause( p->pSats[i], pCopy, nLits );
+    }
+    if ( pCopy != pTemp )
+        ABC_FREE( pCopy );
+    return RetValue;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Solves the problem using all solvers in parallel.]
+
+  Description [The first solver that returns SAT or UNSAT stops the
+  other solvers. Its results are returned by Sat_IfaceVarValue() and
+  Sat_IfaceFinal(). The solvers are not stopped immediately, but when
+  they restart. Returns SAT_IFACE_UNDEC if all solvers reached the
+  resource limits.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static void * Sat_PortSolveTask( void * pArg )
+{
+    Sat_PortTask_t * pTask = (Sat_PortTask_t *)pArg;
+    Sat_Port_t * p = pTask->pPort;
+    pTask->Status = Sat_IfaceSolve( p->pSats[pTask->iSolver], p->pLits, p->nLits );
+    if ( pTask->Status != SAT_IFACE_UNDEC && Sat_AtomicCas( &p->iWinner, ~0, (unsigned)pTask->iSolver ) )
+        p->fStop = 1;
+    return NULL;
+}
+int Sat_PortSolve( Sat_Port_t * p, int * pLits, int nLits )
+{
+    int i;
+    p->pLits   = pLits;
+    p->nLits   = nLits;
+    p->fStop   = 0;
+    p->iWinner = ~0;
+    p->nCalls++;
+    if ( p->pPool == NULL )
+        Sat_PortSolveTask( p->pTasks );
+    else
+    {
+        for ( i = 0; i < p->nSolvers; i++ )
+            Util_PoolSpawn( p->pPool, Sat_PortSolveTask, (void *)(p->pTasks + i) );
+        Util_PoolWaitIdle( p->pPool );
+    }
+    p->fStop = 0;
+    if ( p->iWinner == ~0 )
+        return SAT_IFACE_UNDEC;
+    p->nWins[p->iWinner]++;
+    return p->pTasks[p->iWinner].Status;
+}
+void Sat_PortPrintStats( Sat_Port_t * p )
+{
+    int i;
+    printf( "Portfolio: %d calls.  Answers:", p->nCalls );
+    for ( i = 0; i < p->nSolvers; i++ )
+        printf( "  S%d (%s) = %d", i, Sat_IfaceTypeName(Sat_IfaceType(p->pSats[i])), p->nWins[i] );
+    printf( "\n" );
+    Sat_SharePrintStats( p->pShare );
+}
+
+////////////////////////////////////////////////////////////////////////
+///                       END OF FILE                                ///
+////////////////////////////////////////////////////////////////////////
+
+
+ABC_NAMESPACE_IMPL_END
+
@@ -131,6 +131,11 @@ int sat_solver_get_var_value(sat_solver* s, int v)
 
 static inline int      sat_solver_dl(sat_solver* s)                { return veci_size(&s->trail_lim); }
 static inline veci*    sat_solver_read_wlist(sat_solver* s, lit l) { return &s->wlists[l];            }
+static inline veci*    sat_solver_read_bwlist(sat_solver* s, lit l){ return &s->bwlists[l];           }
+
+// the watcher of a long clause is the clause handle followed by the blocker literal,
+// which is one of the clause literals; if the blocker is true, the clause is not visited
+static inline void     sat_solver_watch(sat_solver* s, lit l, cla h, lit blocker) { veci_push(&s->wlists[l], h); veci_push(&s->wlists[l], blocker); }
 
 //=================================================================================================
 // Variable order functions:
@@ -526,8 +531,8 @@ int sat_solver_clause_new(sat_solver* s, lit* begin, lit* end, int learnt)
     // do not allocate memory for the two-literal problem clause
     if ( fUseBinaryClauses && size == 2 && !learnt )
     {
-        veci_push(sat_solver_read_wlist(s,lit_neg(begin[0])),(clause_from_lit(begin[1])));
-        veci_push(sat_solver_read_wlist(s,lit_neg(begin[1])),(clause_from_lit(begin[0])));
+        veci_push(sat_solver_read_bwlist(s,lit_neg(begin[0])),begin[1]);
+        veci_push(sat_solver_read_bwlist(s,lit_neg(begin[1])),begin[0]);
         s->stats.clauses++;
         s->stats.clauses_literals += size;
         return 0;
@@ -567,10 +572,16 @@ int sat_solver_clause_new(sat_solver* s, lit* begin, lit* end, int learnt)
     assert(lit_neg(begin[0]) < s->size*2);
     assert(lit_neg(begin[1]) < s->size*2);
 
-    //veci_push(sat_solver_read_wlist(s,lit_neg(begin[0])),c);
-    //veci_push(sat_solver_read_wlist(s,lit_neg(begin[1])),c);
-    veci_push(sat_solver_read_wlist(s,lit_neg(begin[0])),(size > 2 ? h : clause_from_lit(begin[1])));
-    veci_push(sat_solver_read_wlist(s,lit_neg(begin[1])),(size > 2 ? h : clause_from_lit(begin[0])));
+    if ( size > 2 )
+    {
+        sat_solver_watch(s,lit_neg(begin[0]),h,begin[1]);
+        sat_solver_watch(s,lit_neg(begin[1]),h,begin[0]);
+    }
+    else
+    {
+        veci_push(sat_solver_read_bwlist(s,lit_neg(begin[0])),begin[1]);
+        veci_push(sat_solver_read_bwlist(s,lit_neg(begin[1])),begin[0]);
+    }
 
     return h;
 }
@@ -1032,7 +1043,7 @@ int sat_solver_propagate(sat_solver* s)
         {
 #endif
 
-        veci* ws    = sat_solver_read_wlist(s,p);
+        veci* ws    = sat_solver_read_bwlist(s,p);
         int*  begin = veci_begin(ws);
         int*  end   = begin + veci_size(ws);
         int*i, *j;
@@ -1040,70 +1051,79 @@ int sat_solver_propagate(sat_solver* s)
         s->stats.propagations++;
 //        s->simpdb_props--;
 
+        // binary clauses are propagated first without visiting the clause memory
+        for (i = begin; i < end; i++){
+            if (var_value(s, lit_var(*i)) == lit_sign(*i))
+                continue;
+            if (!sat_solver_enqueue(s,*i,clause_from_lit(p))){
+                hConfl = s->hBinary;
+                (clause_begin(s->binary))[1] = lit_neg(p);
+                (clause_begin(s->binary))[0] = *i;
+                break;
+            }
+        }
+        s->stats.inspects += i - begin;
+        if ( hConfl )
+            break;
+
+        ws    = sat_solver_read_wlist(s,p);
+        begin = veci_begin(ws);
+        end   = begin + veci_size(ws);
+
         //printf("checking lit %d: "L_LIT"\n", veci_size(ws), L_lit(p));
-        for (i = j = begin; i < end; ){
-            if (clause_is_lit(*i)){
+        for (i = j = begin; i < end; i += 2){
+            clause* c;
+            lit blocker = i[1];
 
-                int Lit = clause_read_lit(*i);
-                if (var_value(s, lit_var(Lit)) == lit_sign(Lit)){
-                    *j++ = *i++;
-                    continue;
-                }
+            // If the blocker is true, then clause is already satisfied.
+            if (var_value(s, lit_var(blocker)) == lit_sign(blocker)){
+                *j++ = i[0]; *j++ = blocker;
+                continue;
+            }
 
-                *j++ = *i;
-                if (!sat_solver_enqueue(s,clause_read_lit(*i),clause_from_lit(p))){
-                    hConfl = s->hBinary;
-                    (clause_begin(s->binary))[1] = lit_neg(p);
-                    (clause_begin(s->binary))[0] = clause_read_lit(*i++);
-                    // Copy the remaining watches:
-                    while (i < end)
-                        *j++ = *i++;
-                }
-            }else{
+            c = clause_read(s,i[0]);
+            lits = clause_begin(c);
 
-                clause* c = clause_read(s,*i);
-                lits = clause_begin(c);
+            // Make sure the false literal is data[1]:
+            false_lit = lit_neg(p);
+            if (lits[0] == false_lit){
+                lits[0] = lits[1];
+                lits[1] = false_lit;
+            }
+            assert(lits[1] == false_lit);
 
-                // Make sure the false literal is data[1]:
-                false_lit = lit_neg(p);
-                if (lits[0] == false_lit){
-                    lits[0] = lits[1];
-                    lits[1] = false_lit;
+            // If 0th watch is true, then clause is already satisfied.
+            if (lits[0] != blocker && var_value(s, lit_var(lits[0])) == lit_sign(lits[0])){
+                *j++ = i[0]; *j++ = lits[0];
+            }
+            else{
+                // Look for new watch:
+                lit* stop = lits + clause_size(c);
+                lit* k;
+                for (k = lits + 2; k < stop; k++){
+                    if (var_value(s, lit_var(*k)) != !lit_sign(*k)){
+                        lits[1] = *k;
+                        *k = false_lit;
+                        sat_solver_watch(s,lit_neg(lits[1]),i[0],lits[0]);
+                        goto next; }
                 }
-                assert(lits[1] == false_lit);
 
-                // If 0th watch is true, then clause is already satisfied.
-                if (var_value(s, lit_var(lits[0])) == lit_sign(lits[0]))
-                    *j++ = *i;
-                else{
-                    // Look for new watch:
-                    lit* stop = lits + clause_size(c);
-                    lit* k;
-                    for (k = lits + 2; k < stop; k++){
-                        if (var_value(s, lit_var(*k)) != !lit_sign(*k)){
-                            lits[1] = *k;
-                            *k = false_lit;
-                            veci_push(sat_solver_read_wlist(s,lit_neg(lits[1])),*i);
-                            goto next; }
-                    }
-
-                    *j++ = *i;
-                    // Clause is unit under assignment:
-                    if ( c->lrn )
-                        c->lbd = sat_clause_compute_lbd(s, c);
-                    if (!sat_solver_enqueue(s,lits[0], *i)){
-                        hConfl = *i++;
-                        // Copy the remaining watches:
-                        while (i < end)
-                            *j++ = *i++;
-                    }
+                *j++ = i[0]; *j++ = lits[0];
+                // Clause is unit under assignment:
+                if ( c->lrn )
+                    c->lbd = sat_clause_compute_lbd(s, c);
+                if (!sat_solver_enqueue(s,lits[0], i[0])){
+                    hConfl = i[0];
+                    // Copy the remaining watches:
+                    for (i += 2; i < end; )
+                        *j++ = *i++;
+                    break;
                 }
             }
-        next:
-            i++;
+        next:;
         }
 
-        s->stats.inspects += j - veci_begin(ws);
+        s->stats.inspects += (j - veci_begin(ws)) / 2;
         veci_resize(ws,j - veci_begin(ws));
 #ifdef TEST_CNF_LOAD
         }
@@ -1145,6 +1165,7 @@ sat_solver* sat_solver_new(void)
 
     // initialize arrays
     s->wlists    = 0;
+    s->bwlists   = 0;
     s->activity  = 0;
     s->orderpos  = 0;
     s->reasons   = 0;
@@ -1210,6 +1231,7 @@ sat_solver* zsat_solver_new_seed(double seed)
 
     // initialize arrays
     s->wlists    = 0;
+    s->bwlists   = 0;
     s->activity  = 0;
     s->orderpos  = 0;
     s->reasons   = 0;
@@ -1262,6 +1284,7 @@ void sat_solver_setnvars(sat_solver* s,int n)
             s->cap = 50000;
 
         s->wlists    = ABC_REALLOC(veci,   s->wlists,   s->cap*2);
+        s->bwlists   = ABC_REALLOC(veci,   s->bwlists,  s->cap*2);
 //        s->vi        = ABC_REALLOC(varinfo,s->vi,       s->cap);
         s->levels    = ABC_REALLOC(int,    s->levels,   s->cap);
         s->assigns   = ABC_REALLOC(char,   s->assigns,  s->cap);
@@ -1279,6 +1302,7 @@ void sat_solver_setnvars(sat_solver* s,int n)
         s->trail     = ABC_REALLOC(lit,    s->trail,    s->cap);
         s->model     = ABC_REALLOC(int,    s->model,    s->cap);
         memset( s->wlists + 2*old_cap, 0, 2*(s->cap-old_cap)*sizeof(veci) );
+        memset( s->bwlists + 2*old_cap, 0, 2*(s->cap-old_cap)*sizeof(veci) );
     } 
 
     for (var = s->size; var < n; var++){
@@ -1288,6 +1312,12 @@ void sat_solver_setnvars(sat_solver* s,int n)
             veci_new(&s->wlists[2*var]);
         if ( s->wlists[2*var+1].ptr == NULL )
             veci_new(&s->wlists[2*var+1]);
+        assert(!s->bwlists[2*var].size);
+        assert(!s->bwlists[2*var+1].size);
+        if ( s->bwlists[2*var].ptr == NULL )
+            veci_new(&s->bwlists[2*var]);
+        if ( s->bwlists[2*var+1].ptr == NULL )
+            veci_new(&s->bwlists[2*var+1]);
 
         if ( s->VarActType == 0 )
             s->activity[var] = (1<<10);
@@ -1346,8 +1376,12 @@ void sat_solver_delete(sat_solver* s)
     if (s->reasons != 0){
         int i;
         for (i = 0; i < s->cap*2; i++)
+        {
             veci_delete(&s->wlists[i]);
+            veci_delete(&s->bwlists[i]);
+        }
         ABC_FREE(s->wlists   );
+        ABC_FREE(s->bwlists  );
 //        ABC_FREE(s->vi       );
         ABC_FREE(s->levels   );
         ABC_FREE(s->assigns  );
@@ -1379,7 +1413,10 @@ void sat_solver_restart( sat_solver* s )
     veci_resize(&s->trail_lim, 0);
     veci_resize(&s->order, 0);
     for ( i = 0; i < s->size*2; i++ )
+    {
         s->wlists[i].size = 0;
+        s->bwlists[i].size = 0;
+    }
 
     s->nDBreduces = 0;
 
@@ -1425,7 +1462,10 @@ void zsat_solver_restart_seed( sat_solver* s, double seed )
     veci_resize(&s->trail_lim, 0);
     veci_resize(&s->order, 0);
     for ( i = 0; i < s->size*2; i++ )
+    {
         s->wlists[i].size = 0;
+        s->bwlists[i].size = 0;
+    }
 
     s->nDBreduces = 0;
 
@@ -1463,8 +1503,9 @@ double sat_solver_memory( sat_solver* s )
     int i;
     double Mem = sizeof(sat_solver);
     for (i = 0; i < s->cap*2; i++)
-        Mem += s->wlists[i].cap * sizeof(int);
+        Mem += (s->wlists[i].cap + s->bwlists[i].cap) * sizeof(int);
     Mem += s->cap * sizeof(veci);     // ABC_FREE(s->wlists   );
+    Mem += s->cap * sizeof(veci);     // ABC_FREE(s->bwlists  );
     Mem += s->cap * sizeof(int);      // ABC_FREE(s->levels   );
     Mem += s->cap * sizeof(char);     // ABC_FREE(s->assigns  );
     Mem += s->cap * sizeof(char);     // ABC_FREE(s->polarity );
@@ -1502,6 +1543,14 @@ int sat_solver_simplify(sat_solver* s)
     return true;
 }
 
+static int sat_solver_watch_compare( int * pW1, int * pW2 )
+{
+    if ( pW1[0] < pW2[0] )
+        return -1;
+    if ( pW1[0] > pW2[0] )
+        return 1;
+    return 0;
+}
 void sat_solver_reducedb(sat_solver* s)
 {
     static abctime TimeTotal = 0;
@@ -1586,24 +1635,31 @@ void sat_solver_reducedb(sat_solver* s)
         s->reasons[i] = clause_id(c); // updating handle here!!!
     }
 
-    // update watches
+    // update watches (binary clauses are never removed)
     for ( i = 0; i < s->size*2; i++ )
     {
         pArray = veci_begin(&s->wlists[i]);
-        for ( j = k = 0; k < veci_size(&s->wlists[i]); k++ )
+        for ( j = k = 0; k < veci_size(&s->wlists[i]); k += 2 )
         {
-            if ( clause_is_lit(pArray[k]) ) // 2-lit clause
-                pArray[j++] = pArray[k];
-            else if ( !clause_learnt_h(pMem, pArray[k]) ) // problem clause
+            if ( !clause_learnt_h(pMem, pArray[k]) ) // problem clause
+            {
                 pArray[j++] = pArray[k];
+                pArray[j++] = pArray[k+1];
+            }
             else 
             {
                 c = clause_read(s, pArray[k]);
                 if ( !c->mark ) // useful learned clause
+                {
                    pArray[j++] = clause_id(c); // updating handle here!!!
+                   pArray[j++] = pArray[k+1];
+                }
             }
         }
         veci_resize(&s->wlists[i],j);
+        // visit the clauses in the order of their placement in memory
+        if ( j > 2 )
+            qsort( (void *)pArray, (size_t)(j/2), 2*sizeof(int), (int (*)(const void *, const void *))sat_solver_watch_compare );
     }
 
     // perform final move of the clauses
@@ -1654,21 +1710,27 @@ void sat_solver_rollback( sat_solver* s )
     for ( i = 0; i < s->iVarPivot*2; i++ )
     {
         cla* pArray = veci_begin(&s->wlists[i]);
-        for ( j = k = 0; k < veci_size(&s->wlists[i]); k++ )
+        for ( j = k = 0; k < veci_size(&s->wlists[i]); k += 2 )
         {
-            if ( clause_is_lit(pArray[k]) )
+            if ( Sat_MemClauseUsed(pMem, pArray[k]) )
             {
-                if ( clause_read_lit(pArray[k]) < s->iVarPivot*2 )
-                    pArray[j++] = pArray[k];
-            }
-            else if ( Sat_MemClauseUsed(pMem, pArray[k]) )
                 pArray[j++] = pArray[k];
+                pArray[j++] = pArray[k+1];
+            }
         }
         veci_resize(&s->wlists[i],j);
+        pArray = veci_begin(&s->bwlists[i]);
+        for ( j = k = 0; k < veci_size(&s->bwlists[i]); k++ )
+            if ( pArray[k] < s->iVarPivot*2 )
+                pArray[j++] = pArray[k];
+        veci_resize(&s->bwlists[i],j);
     }
     // reset watcher lists
     for ( i = 2*s->iVarPivot; i < 2*s->size; i++ )
+    {
         s->wlists[i].size = 0;
+        s->bwlists[i].size = 0;
+    }
 
     // reset clause counts
     s->stats.clauses = pMem->BookMarkE[0];
@@ -1862,7 +1924,7 @@ static lbool sat_solver_search(sat_solver* s, ABC_INT64_T nof_conflicts)
             int next;
 
             // Reached bound on number of conflicts:
-            if ( (!s->fNoRestarts && nof_conflicts >= 0 && conflictC >= nof_conflicts) || (s->nRuntimeLimit && (s->stats.conflicts & 63) == 0 && Abc_Clock() > s->nRuntimeLimit)){
+            if ( (!s->fNoRestarts && nof_conflicts >= 0 && conflictC >= nof_conflicts) || (s->nRuntimeLimit && (s->stats.conflicts & 63) == 0 && Abc_Clock() > s->nRuntimeLimit) || (s->pstop && *s->pstop)){
                 s->progress_estimate = sat_solver_progress(s);
                 sat_solver_canceluntil(s,s->root_level);
                 veci_delete(&learnt_clause);
@@ -1965,6 +2027,8 @@ int sat_solver_solve_internal(sat_solver* s)
             break;
         if ( s->pFuncStop && s->pFuncStop(s->RunId) )
             break;
+        if ( s->pstop && *s->pstop )
+            break;
     }
     if (s->verbosity >= 1)
         printf("==============================================================================\n");
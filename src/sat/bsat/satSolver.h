@@ -109,7 +109,8 @@ struct sat_solver_t
     int         hLearnts;      // the first learnt clause
     int         hBinary;       // the special binary clause
     clause *    binary;
-    veci*       wlists;        // watcher lists
+    veci*       wlists;        // watcher lists of long clauses (pairs of handle and blocker literal)
+    veci*       bwlists;       // watcher lists of binary clauses (the other literal)
 
     // rollback
     int         iVarPivot;     // the pivot for variables
@@ -206,6 +207,7 @@ struct sat_solver_t
     // termination callback
     int         RunId;          // SAT id in this run
     int(*pFuncStop)(int);       // callback to terminate
+    int *       pstop;          // external flag to terminate
 };
 
 static inline clause * clause_read( sat_solver * s, cla h )          
@@ -339,6 +341,10 @@ static inline void sat_solver_set_runid( sat_solver *s, int id )
 { 
     s->RunId      = id;  
 }
+static inline void sat_solver_set_stop( sat_solver *s, int * pstop )
+{
+    s->pstop = pstop;
+}
 static inline void sat_solver_set_stop_func( sat_solver *s, int (*fnct)(int) ) 
 { 
     s->pFuncStop = fnct; 
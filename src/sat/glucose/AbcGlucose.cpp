@@ -218,6 +218,23 @@ void bmcg_sat_solver_set_stop(bmcg_sat_solver* s, int * pstop)
     glucose_solver_setstop((Gluco::SimpSolver*)s, pstop);
 }
 
+void bmcg_sat_solver_set_share(bmcg_sat_solver* s, void * pdata, void(*pexport)(void*, int*, int, int), int(*pimport)(void*, int**))
+{
+    Gluco::SimpSolver * S = (Gluco::SimpSolver*)s;
+    S->pShareData  = pdata;
+    S->pFuncExport = pexport;
+    S->pFuncImport = pimport;
+}
+
+void bmcg_sat_solver_set_seed(bmcg_sat_solver* s, int seed)
+{
+    // seed 0 keeps the default behavior; other seeds add random decisions and vary the restarts
+    Gluco::SimpSolver * S = (Gluco::SimpSolver*)s;
+    S->random_seed     = 91648253 + 7919 * seed;
+    S->random_var_freq = seed ? 0.005 * (1 + seed % 4) : 0;
+    S->K               = seed % 2 ? 0.7 : 0.8;
+}
+
 abctime bmcg_sat_solver_set_runtime_limit(bmcg_sat_solver* s, abctime Limit)
 {
     abctime nRuntimeLimit = ((Gluco::SimpSolver*)s)->nRuntimeLimit;
@@ -480,6 +497,23 @@ void bmcg_sat_solver_set_stop(bmcg_sat_solver* s, int * pstop)
     glucose_solver_setstop((Gluco::Solver*)s, pstop);
 }
 
+void bmcg_sat_solver_set_share(bmcg_sat_solver* s, void * pdata, void(*pexport)(void*, int*, int, int), int(*pimport)(void*, int**))
+{
+    Gluco::Solver * S = (Gluco::Solver*)s;
+    S->pShareData  = pdata;
+    S->pFuncExport = pexport;
+    S->pFuncImport = pimport;
+}
+
+void bmcg_sat_solver_set_seed(bmcg_sat_solver* s, int seed)
+{
+    // seed 0 keeps the default behavior; other seeds add random decisions and vary the restarts
+    Gluco::Solver * S = (Gluco::Solver*)s;
+    S->random_seed     = 91648253 + 7919 * seed;
+    S->random_var_freq = seed ? 0.005 * (1 + seed % 4) : 0;
+    S->K               = seed % 2 ? 0.7 : 0.8;
+}
+
 abctime bmcg_sat_solver_set_runtime_limit(bmcg_sat_solver* s, abctime Limit)
 {
     abctime nRuntimeLimit = ((Gluco::Solver*)s)->nRuntimeLimit;
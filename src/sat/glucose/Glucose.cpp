@@ -97,6 +97,9 @@ Solver::Solver() :
     , terminate_search_early(false)
     , pstop(NULL)
     , nRuntimeLimit(0)
+    , pShareData(NULL)
+    , pFuncExport(NULL)
+    , pFuncImport(NULL)
 
     , verbosity      (0)
     , verbEveryConflicts(10000)
@@ -1071,6 +1074,9 @@ lbool Solver::search(int nof_conflicts)
 
             lbdQueue.push(nblevels);
             sumLBD += nblevels;
+
+            if (pFuncExport)
+                pFuncExport(pShareData, (int *)&learnt_clause[0], learnt_clause.size(), nblevels);
  
             cancelUntil(backtrack_level);
 
@@ -1200,6 +1206,51 @@ void Solver::printIncrementalStats() {
 
 
 // NOTE: assumptions passed in member-variable 'assumptions'.
+/*_________________________________________________________________________________________________
+|
+|  importClauses : ()  ->  [bool]
+|  
+|  Description:
+|    Adds the learnt clauses received from other solvers working on the same problem.
+|    The clauses are implied by the problem clauses, so they are added as learnt clauses,
+|    without the literals assigned at the top level. Returns false if a conflict is found.
+|________________________________________________________________________________________________@*/
+bool Solver::importClauses()
+{
+    vec<Lit> lits;
+    int * pLits, nLits, i;
+    cancelUntil(0);
+    while ( (nLits = pFuncImport(pShareData, &pLits)) >= 0 )
+    {
+        lits.clear();
+        for ( i = 0; i < nLits; i++ )
+        {
+            Lit p = toLit(pLits[i]);
+            if ( var(p) >= nVars() || value(p) == l_True )
+                break;
+            if ( value(p) == l_Undef )
+                lits.push(p);
+        }
+        if ( i < nLits )
+            continue;
+        if ( lits.size() == 0 )
+            return ok = false;
+        if ( lits.size() == 1 )
+        {
+            uncheckedEnqueue(lits[0]);
+            continue;
+        }
+        CRef cr = ca.alloc(lits, true);
+        ca[cr].setLBD(lits.size());
+        ca[cr].setSizeWithoutSelectors(lits.size());
+        learnts.push(cr);
+        attachClause(cr);
+    }
+    if ( propagate() != CRef_Undef )
+        return ok = false;
+    return true;
+}
+
 lbool Solver::solve_()
 {
 
@@ -1244,6 +1295,7 @@ printf("c ==================================[ Search Statistics (every %6d confl
       status = search(0); // the parameter is useless in glucose, kept to allow modifications
         if (!withinBudget() || terminate_search_early || (pstop && *pstop)) break;
         if (nRuntimeLimit && Abc_Clock() > nRuntimeLimit)                   break;
+        if (status == l_Undef && pFuncImport && !importClauses())         { status = l_False; break; }
         curr_restarts++;
     }
 
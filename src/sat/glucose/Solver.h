@@ -61,6 +61,9 @@ public:
     bool terminate_search_early;         // used to stop the solver early if it as instructed by an external caller
     int * pstop;                         // another callback
     uint64_t nRuntimeLimit;              // runtime limit
+    void * pShareData;                   // external manager exchanging learnt clauses
+    void(*pFuncExport)(void * p, int * pLits, int nLits, int Lbd); // called for each learnt clause
+    int(*pFuncImport)(void * p, int ** ppLits); // returns the size of the next clause to add or -1
     vec<int> user_vec;
     vec<Lit> user_lits;
 
@@ -303,6 +306,7 @@ protected:
     bool     litRedundant     (Lit p, uint32_t abstract_levels);                       // (helper method for 'analyze()')
     lbool    search           (int nof_conflicts);                                     // Search for a given number of conflicts.
     lbool    solve_           ();                                                      // Main solve method (assumptions given in 'assumptions').
+    bool     importClauses    ();                                                      // Adds the learnt clauses received from other solvers.
     void     reduceDB         ();                                                      // Reduce the set of learnt clauses.
     void     removeSatisfied  (vec<CRef>& cs);                                         // Shrink 'cs' to contain only non-satisfied clauses.
     void     rebuildOrderHeap ();
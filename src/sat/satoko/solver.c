@@ -349,6 +349,8 @@ static inline void solver_handle_conflict(solver_t *s, unsigned confl_cref)
 	solver_analyze(s, confl_cref, s->temp_lits, &bt_level, &lbd);
 	s->sum_lbd += lbd;
 	b_queue_push(s->bq_lbd, lbd);
+	if (s->pFuncExport)
+		s->pFuncExport(s->pShareData, (int *) vec_uint_data(s->temp_lits), vec_uint_size(s->temp_lits), lbd);
 	solver_cancel_until(s, bt_level);
 	cref = UNDEF;
 	if (vec_uint_size(s->temp_lits) > 1) {
@@ -512,6 +514,42 @@ unsigned solver_clause_create(solver_t *s, vec_uint_t *lits, unsigned f_learnt)
 	return cref;
 }
 
+/* Adds the learnt clauses received from other solvers. The clauses are
+ * implied by the problem clauses, so they are added as learnt clauses,
+ * without the literals assigned at the top level. Should be called at
+ * the top level. Returns SATOKO_ERR if a conflict is found. */
+int solver_import_clauses(solver_t *s)
+{
+	int i, size, *lits;
+	unsigned cref;
+
+	assert(solver_dlevel(s) == 0);
+	while ((size = s->pFuncImport(s->pShareData, &lits)) >= 0) {
+		vec_uint_clear(s->temp_lits);
+		for (i = 0; i < size; i++) {
+			if ((unsigned)lit2var(lits[i]) >= vec_char_size(s->assigns))
+				break;
+			if (var_value(s, lit2var(lits[i])) == SATOKO_VAR_UNASSING)
+				vec_uint_push_back(s->temp_lits, lits[i]);
+			else if (lit_value(s, lits[i]) == SATOKO_LIT_TRUE)
+				break;
+		}
+		if (i < size)
+			continue;
+		if (vec_uint_size(s->temp_lits) == 0)
+			return SATOKO_ERR;
+		if (vec_uint_size(s->temp_lits) == 1) {
+			solver_enqueue(s, vec_uint_at(s->temp_lits, 0), UNDEF);
+			continue;
+		}
+		cref = solver_clause_create(s, s->temp_lits, 1);
+		clause_watch(s, cref);
+	}
+	if (solver_propagate(s) != UNDEF)
+		return SATOKO_ERR;
+	return SATOKO_OK;
+}
+
 void solver_cancel_until(solver_t *s, unsigned level)
 {
 	unsigned i;
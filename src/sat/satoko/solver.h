@@ -106,6 +106,11 @@ struct solver_t_ {
 	int     RunId;           
 	int   (*pFuncStop)(int);  
 
+	/* Callbacks to exchange learnt clauses with other solvers */
+	void   *pShareData;
+	void  (*pFuncExport)(void *, int *, int, int); /* called for each learnt clause */
+	int   (*pFuncImport)(void *, int **);          /* returns the size of the next clause or -1 */
+
 	struct satoko_stats stats;
 	struct satoko_opts opts;
 };
@@ -114,6 +119,7 @@ struct solver_t_ {
 extern unsigned solver_clause_create(solver_t *, vec_uint_t *, unsigned);
 extern char solver_search(solver_t *);
 extern void solver_cancel_until(solver_t *, unsigned);
+extern int solver_import_clauses(solver_t *);
 extern unsigned solver_propagate(solver_t *);
 
 /* Debuging */
@@ -328,6 +328,11 @@ int satoko_solve(solver_t *s)
 			break;
 		if (s->pFuncStop && s->pFuncStop(s->RunId))
 			break;
+		if (status == SATOKO_UNDEC && s->pFuncImport && solver_import_clauses(s) == SATOKO_ERR) {
+			s->status = SATOKO_ERR;
+			vec_uint_clear(s->final_conflict);
+			status = SATOKO_UNSAT;
+		}
 	}
 	if (s->opts.verbose)
 		print_stats(s);
@@ -649,6 +654,13 @@ void satoko_set_runid(satoko_t *s, int id)
 	s->RunId = id;
 }
 
+void satoko_set_share(satoko_t *s, void * pdata, void (*pexport)(void *, int *, int, int), int (*pimport)(void *, int **))
+{
+	s->pShareData = pdata;
+	s->pFuncExport = pexport;
+	s->pFuncImport = pimport;
+}
+
 int satoko_read_cex_varvalue(satoko_t *s, int ivar)
 {
 	return satoko_var_polarity(s, ivar) == SATOKO_LIT_TRUE;